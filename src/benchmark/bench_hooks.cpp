@@ -0,0 +1,108 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/runner.h"
+#include "benchmark/suites.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/properties/copyable_property.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/wrappers/bound_function.h"
+
+using namespace unrealsdk::unreal;
+
+namespace unrealsdk::benchmark {
+
+namespace {
+
+const constexpr auto HOOK_IDENTIFIER = L"unrealsdk_benchmark";
+const constexpr uint32_t SAMPLE_RATE = 100;
+const constexpr size_t NUM_BATCHED_HOOKS = 32;
+
+}  // namespace
+
+void bench_hooks(const Runner& runner, const MockHook::Graph& graph) {
+    BoundFunction bound{.func = graph.func, .object = graph.instances.front()};
+    auto call = [&bound]() {
+        do_not_optimize(bound.call<ZIntProperty, ZIntProperty, ZFloatProperty>(1, 2.0F));
+    };
+
+    const auto func_path = graph.func->get_path_name();
+    const hook_manager::Callback noop_callback = [](hook_manager::Details&) { return false; };
+
+    runner.run("hooks/call/unhooked", call);
+
+    // Same function name, different path, so this needs to fall through to the full path check
+    const auto collision_path = L"Bench.Colliding:" + std::wstring{graph.func->Name()};
+    hook_manager::add_hook(collision_path, hook_manager::Type::PRE, HOOK_IDENTIFIER,
+                           noop_callback);
+    runner.run("hooks/call/name_collision", call);
+    hook_manager::remove_hook(collision_path, hook_manager::Type::PRE, HOOK_IDENTIFIER);
+
+    // Hooked, but filtered out before extracting any args
+    hook_manager::add_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER, noop_callback,
+                           {.name = FName{L"unrealsdk_benchmark_no_match"}});
+    runner.run("hooks/call/filtered_out", call);
+    hook_manager::remove_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER);
+
+    // Hooked, but only runs on a small fraction of calls
+    hook_manager::add_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER, noop_callback, {},
+                           {.sample_every = SAMPLE_RATE});
+    runner.run("hooks/call/sampled", call);
+    hook_manager::remove_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER);
+
+    // A wildcard hook elsewhere, which this function gets checked against once, then skips
+    hook_manager::add_wildcard_hook(L"Bench.Colliding:*", hook_manager::Type::PRE, HOOK_IDENTIFIER,
+                                    noop_callback);
+    runner.run("hooks/call/wildcard_unmatched", call);
+    hook_manager::remove_wildcard_hook(L"Bench.Colliding:*", hook_manager::Type::PRE,
+                                       HOOK_IDENTIFIER);
+
+    hook_manager::add_wildcard_hook(L"*", hook_manager::Type::PRE, HOOK_IDENTIFIER, noop_callback);
+    runner.run("hooks/call/wildcard_pre", call);
+    hook_manager::remove_wildcard_hook(L"*", hook_manager::Type::PRE, HOOK_IDENTIFIER);
+
+    hook_manager::add_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER, noop_callback);
+    runner.run("hooks/call/pre", call);
+
+    hook_manager::add_hook(func_path, hook_manager::Type::POST, HOOK_IDENTIFIER, noop_callback);
+    runner.run("hooks/call/pre_post", call);
+
+    hook_manager::remove_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER);
+    hook_manager::remove_hook(func_path, hook_manager::Type::POST, HOOK_IDENTIFIER);
+
+    runner.run("hooks/add_remove", [&]() {
+        hook_manager::add_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER, noop_callback);
+        hook_manager::remove_hook(func_path, hook_manager::Type::PRE, HOOK_IDENTIFIER);
+    });
+
+    // Simulate toggling a mod which hooks a bunch of functions at once
+    std::vector<std::wstring> many_paths{};
+    for (size_t i = 0; i < NUM_BATCHED_HOOKS; i++) {
+        many_paths.push_back(std::format(L"Bench.Batched:Func{}", i));
+    }
+
+    runner.run("hooks/add_remove_many", [&]() {
+        for (const auto& path : many_paths) {
+            hook_manager::add_hook(path, hook_manager::Type::PRE, HOOK_IDENTIFIER, noop_callback);
+        }
+        for (const auto& path : many_paths) {
+            hook_manager::remove_hook(path, hook_manager::Type::PRE, HOOK_IDENTIFIER);
+        }
+    });
+
+    runner.run("hooks/batch_add_remove_many", [&]() {
+        hook_manager::HookBatch add_batch{};
+        for (const auto& path : many_paths) {
+            add_batch.add(path, hook_manager::Type::PRE, HOOK_IDENTIFIER, noop_callback);
+        }
+        add_batch.commit();
+
+        hook_manager::HookBatch remove_batch{};
+        for (const auto& path : many_paths) {
+            remove_batch.remove(path, hook_manager::Type::PRE, HOOK_IDENTIFIER);
+        }
+        remove_batch.commit();
+    });
+}
+
+}  // namespace unrealsdk::benchmark
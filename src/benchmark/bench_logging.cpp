@@ -0,0 +1,14 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/runner.h"
+#include "benchmark/suites.h"
+
+namespace unrealsdk::benchmark {
+
+void bench_logging(const Runner& runner) {
+    // Misc is below the default console level, so only goes to the log file
+    runner.run("logging/misc", []() { LOG(MISC, "Benchmark log message {}", 1234); });
+    runner.run("logging/info", []() { LOG(INFO, "Benchmark log message {}", 1234); });
+}
+
+}  // namespace unrealsdk::benchmark
@@ -0,0 +1,91 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/runner.h"
+#include "benchmark/suites.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/find_class.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/wrappers/gobjects.h"
+#include "unrealsdk/unrealsdk.h"
+
+using namespace unrealsdk::unreal;
+
+namespace unrealsdk::benchmark {
+
+void bench_objects(const Runner& runner, const MockHook::Graph& graph) {
+    auto obj = graph.instances.back();
+    auto cls = graph.derived_class;
+
+    runner.run("objects/gobjects/scan", [&]() {
+        size_t count = 0;
+        for (auto gobj : unrealsdk::gobjects()) {
+            if (gobj != nullptr && gobj->Class() == cls) {
+                count++;
+            }
+        }
+        do_not_optimize(count);
+    });
+    runner.run("objects/gobjects/scan_is_instance", [&]() {
+        size_t count = 0;
+        for (auto gobj : unrealsdk::gobjects()) {
+            if (gobj != nullptr && gobj->is_instance(graph.base_class)) {
+                count++;
+            }
+        }
+        do_not_optimize(count);
+    });
+
+    // Raw field access, which is entirely down to how fast we can look up offsets
+    runner.run("objects/fields/uobject", [&]() {
+        do_not_optimize(obj->Class());
+        do_not_optimize(obj->Outer());
+        do_not_optimize(obj->InternalIndex());
+    });
+    runner.run("objects/fields/iter_properties", [&]() {
+        int32_t total = 0;
+        for (auto prop : cls->properties()) {
+            total += prop->Offset_Internal() + (prop->ElementSize() * prop->ArrayDim());
+        }
+        do_not_optimize(total);
+    });
+    runner.run("objects/fields/walk_superfields", [&]() {
+        size_t depth = 0;
+        for (const UStruct* sup = cls; sup != nullptr; sup = sup->SuperField()) {
+            depth++;
+        }
+        do_not_optimize(depth);
+    });
+
+    runner.run("objects/find_class/fname",
+               [&]() { do_not_optimize(find_class(L"BenchDerived"_fn)); });
+
+    const auto path_name = obj->get_path_name();
+    runner.run("objects/find_object", [&]() {
+        do_not_optimize(unrealsdk::find_object(cls, path_name));
+    });
+    runner.run("objects/get_path_name", [&]() { do_not_optimize(obj->get_path_name()); });
+
+    // Own properties come first, so the inherited array property is one of the worst cases
+    runner.run("objects/find_prop/own",
+               [&]() { do_not_optimize(cls->find_prop(L"DerivedInt"_fn)); });
+    runner.run("objects/find_prop/inherited",
+               [&]() { do_not_optimize(cls->find_prop(L"IntArray"_fn)); });
+
+    auto prop = cls->find_prop(L"IntArray"_fn);
+    runner.run("objects/cast/property", [&]() {
+        cast(prop, []<typename T>(const T* casted) { do_not_optimize(casted); });
+    });
+
+    runner.run("fname/construct", [&]() { do_not_optimize(FName{L"IntVal"}); });
+    runner.run("fname/find", [&]() { do_not_optimize(FName::find(L"intval")); });
+    runner.run("fname/find_missing", [&]() { do_not_optimize(FName::find(L"NotAName")); });
+    const auto name = obj->Name();
+    runner.run("fname/to_string", [&]() { do_not_optimize(std::string{name}); });
+    runner.run("fname/format", [&]() { do_not_optimize(std::format("{}", name)); });
+}
+
+}  // namespace unrealsdk::benchmark
@@ -0,0 +1,75 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/runner.h"
+#include "benchmark/suites.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/uobject_funcs.h"
+#include "unrealsdk/unreal/classes/uscriptstruct.h"
+#include "unrealsdk/unreal/classes/ustruct_funcs.h"
+#include "unrealsdk/unreal/properties/copyable_property.h"
+#include "unrealsdk/unreal/properties/zarrayproperty.h"
+#include "unrealsdk/unreal/properties/zstrproperty.h"
+#include "unrealsdk/unreal/properties/zstructproperty.h"
+#include "unrealsdk/unreal/wrappers/wrapped_array.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+
+using namespace unrealsdk::unreal;
+
+namespace unrealsdk::benchmark {
+
+void bench_properties(const Runner& runner, const MockHook::Graph& graph) {
+    auto obj = graph.instances.back();
+    auto cls = graph.derived_class;
+
+    auto int_prop = cls->find_prop_and_validate<ZIntProperty>(L"IntVal"_fn);
+    auto str_prop = cls->find_prop_and_validate<ZStrProperty>(L"StrVal"_fn);
+    auto struct_prop = cls->find_prop_and_validate<ZStructProperty>(L"VecVal"_fn);
+    auto array_prop = cls->find_prop_and_validate<ZArrayProperty>(L"IntArray"_fn);
+
+    runner.run("properties/int/get", [&]() { do_not_optimize(obj->get<ZIntProperty>(int_prop)); });
+    runner.run("properties/int/get_by_name",
+               [&]() { do_not_optimize(obj->get<ZIntProperty>(L"IntVal"_fn)); });
+    runner.run("properties/int/set", [&]() { obj->set<ZIntProperty>(int_prop, 1); });
+
+    const std::wstring str_value = L"The quick brown fox jumps over the lazy dog";
+    runner.run("properties/str/set", [&]() { obj->set<ZStrProperty>(str_prop, str_value); });
+    runner.run("properties/str/get", [&]() { do_not_optimize(obj->get<ZStrProperty>(str_prop)); });
+
+    runner.run("properties/struct/get",
+               [&]() { do_not_optimize(obj->get<ZStructProperty>(struct_prop)); });
+
+    runner.run("properties/array/resize_and_fill", [&]() {
+        auto arr = obj->get<ZArrayProperty>(array_prop);
+        arr.resize(0);
+        for (int32_t i = 0; i < 16; i++) {
+            arr.set_at<ZIntProperty>(arr.emplace_back_n(1), i);
+        }
+    });
+
+    runner.run("structs/iterate_properties", [&]() {
+        for (auto prop : cls->properties()) {
+            do_not_optimize(prop);
+        }
+    });
+    runner.run("structs/iterate_fields", [&]() {
+        for (auto field : cls->fields()) {
+            do_not_optimize(field);
+        }
+    });
+
+    runner.run("structs/construct", [&]() { do_not_optimize(WrappedStruct{graph.func}); });
+
+    const WrappedStruct vector_src{graph.vector_struct};
+    const WrappedStruct vector_dest{graph.vector_struct};
+    runner.run("structs/copy_struct", [&]() {
+        copy_struct(reinterpret_cast<uintptr_t>(vector_dest.base.get()), vector_src);
+    });
+
+    const WrappedStruct params{graph.func};
+    runner.run("structs/copy_params_only",
+               [&]() { do_not_optimize(params.copy_params_only()); });
+}
+
+}  // namespace unrealsdk::benchmark
@@ -0,0 +1,23 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/runner.h"
+#include "benchmark/suites.h"
+#include "unrealsdk/utils.h"
+
+namespace unrealsdk::benchmark {
+
+void bench_utils(const Runner& runner) {
+    // A typical object path name
+    const std::wstring ascii_wide = L"/Game/PlayerCharacters/_Shared/_Design/Character/Default";
+    const std::string ascii = utils::narrow(ascii_wide);
+    // The same, but with a non-ascii char part way through
+    const std::wstring non_ascii_wide = L"/Game/PlayerCharacters/_Shared/\u00C9/Character/Default";
+    const std::string non_ascii = utils::narrow(non_ascii_wide);
+
+    runner.run("utils/narrow/ascii", [&]() { do_not_optimize(utils::narrow(ascii_wide)); });
+    runner.run("utils/narrow/non_ascii", [&]() { do_not_optimize(utils::narrow(non_ascii_wide)); });
+    runner.run("utils/widen/ascii", [&]() { do_not_optimize(utils::widen(ascii)); });
+    runner.run("utils/widen/non_ascii", [&]() { do_not_optimize(utils::widen(non_ascii)); });
+}
+
+}  // namespace unrealsdk::benchmark
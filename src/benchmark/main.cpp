@@ -0,0 +1,48 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/mock_hook.h"
+#include "benchmark/runner.h"
+#include "benchmark/suites.h"
+#include "unrealsdk/unrealsdk.h"
+
+/*
+Standalone benchmarks for the sdk's hot paths.
+
+These run the sdk against a mock game hook, serving a synthetic object graph, so they don't require
+any game to be running (or installed) - meaning they can be run directly on CI, including under
+Wine when cross compiling.
+
+Usage:
+    unrealsdk_benchmark [--filter <substring>] [--objects <n>] [--repetitions <n>]
+                        [--min-time <ms>] [--csv]
+*/
+
+using namespace unrealsdk::benchmark;
+
+int main(int argc, char* argv[]) {
+    try {
+        const Runner runner{argc, argv};
+
+        const MockHook* mock = nullptr;
+        unrealsdk::init([&runner, &mock]() {
+            // Always create at least one instance, the benchmarks need something to work on
+            auto hook =
+                std::make_unique<MockHook>(std::max<size_t>(1, runner.get_options().num_objects));
+            mock = hook.get();
+            return hook;
+        });
+        const auto& graph = mock->get_graph();
+
+        runner.print_header();
+        bench_hooks(runner, graph);
+        bench_properties(runner, graph);
+        bench_objects(runner, graph);
+        bench_logging(runner);
+        bench_utils(runner);
+    } catch (const std::exception& ex) {
+        std::cerr << "Benchmark failed: " << ex.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,516 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/mock_hook.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/uobject_funcs.h"
+#include "unrealsdk/unreal/classes/uscriptstruct.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/classes/ustruct_funcs.h"
+#include "unrealsdk/unreal/properties/copyable_property.h"
+#include "unrealsdk/unreal/properties/zarrayproperty.h"
+#include "unrealsdk/unreal/properties/zobjectproperty.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/properties/zstructproperty.h"
+#include "unrealsdk/unreal/structs/ffield.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/structs/fstring.h"
+#include "unrealsdk/unreal/structs/tarray.h"
+#include "unrealsdk/unreal/wrappers/property_proxy.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+
+#if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW
+#include "unrealsdk/game/bl1/bl1.h"
+#include "unrealsdk/game/bl1/offsets.h"
+#include "unrealsdk/game/bl1e/bl1e.h"
+#include "unrealsdk/game/bl1e/offsets.h"
+#include "unrealsdk/game/bl2/bl2.h"
+#include "unrealsdk/game/bl2/offsets.h"
+#include "unrealsdk/game/tps/offsets.h"
+#include "unrealsdk/game/tps/tps.h"
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK
+#include "unrealsdk/game/bl3/bl3.h"
+#include "unrealsdk/game/bl3/offsets.h"
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK2
+#include "unrealsdk/game/bl4/bl4.h"
+#include "unrealsdk/game/bl4/offsets.h"
+#else
+#error Unknown sdk flavour
+#endif
+
+using namespace unrealsdk::unreal;
+
+namespace unrealsdk::benchmark {
+
+namespace {
+
+// The mock doesn't need to match any real game, it only needs to be internally consistent - so
+// just borrow the layouts of a game which is always compiled into this flavour. If offsets are
+// baked in, we must use that game.
+#if defined(UNREALSDK_STATIC_OFFSETS) && UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1
+namespace layout = game::bl1;
+using LayoutHook = game::BL1Hook;
+#elif defined(UNREALSDK_STATIC_OFFSETS) && UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1E
+namespace layout = game::bl1e;
+using LayoutHook = game::BL1EHook;
+#elif defined(UNREALSDK_STATIC_OFFSETS) && UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_TPS
+namespace layout = game::tps;
+using LayoutHook = game::TPSHook;
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW
+namespace layout = game::bl2;
+using LayoutHook = game::BL2Hook;
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK
+namespace layout = game::bl3;
+using LayoutHook = game::BL3Hook;
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK2
+namespace layout = game::bl4;
+using LayoutHook = game::BL4Hook;
+#else
+#error Unknown sdk flavour
+#endif
+
+/**
+ * @brief Recursive helper to generate full object path name.
+ *
+ * @param obj The object to get the path name of.
+ * @param stream The stream to push the object name onto.
+ */
+void iter_path_name(const UObject* obj, std::wstringstream& stream) {
+    if (obj->Outer() != nullptr) {
+        iter_path_name(obj->Outer(), stream);
+
+        static const FName package_name = L"Package"_fn;
+        if (obj->Outer()->Class()->Name() != package_name && obj->Outer()->Outer() != nullptr
+            && obj->Outer()->Outer()->Class()->Name() == package_name) {
+            stream << L':';
+        } else {
+            stream << L'.';
+        }
+    }
+    stream << obj->Name();
+}
+
+/**
+ * @brief Appends a field onto the end of a struct's children list.
+ *
+ * @param owner The struct to append to.
+ * @param field The field to append.
+ */
+void append_child(UStruct* owner, UField* field) {
+    if (owner->Children() == nullptr) {
+        owner->Children() = field;
+        return;
+    }
+    auto tail = owner->Children();
+    for (; tail->Next() != nullptr; tail = tail->Next()) {}
+    tail->Next() = field;
+}
+
+}  // namespace
+
+MockHook::MockHook(size_t num_instances)
+    : num_instances(num_instances), gobjects_wrapper(&this->gobjects_array) {}
+
+const MockHook::Graph& MockHook::get_graph(void) const {
+    return this->graph;
+}
+
+void MockHook::hook(void) {
+    // Nothing to hook - the object graph needs the sdk globals to build, so waits for post init
+    LOG(MISC, "Using mock game hook");
+}
+
+void MockHook::post_init(void) {
+    this->build_graph();
+    LOG(MISC, "Built mock object graph with {} objects", this->gobjects_wrapper.size());
+}
+
+bool MockHook::is_console_ready(void) const {
+    return false;
+}
+
+const GObjects& MockHook::gobjects(void) const {
+    return this->gobjects_wrapper;
+}
+
+void* MockHook::u_malloc(size_t len) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    return calloc(1, len);
+}
+void* MockHook::u_realloc(void* original, size_t len) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    return realloc(original, len);
+}
+void MockHook::u_free(void* data) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    free(data);
+}
+
+UObject* MockHook::find_object(UClass* cls, const std::wstring& name) const {
+    for (auto obj : this->gobjects_wrapper) {
+        if (obj != nullptr && obj->is_instance(cls) && obj->get_path_name() == name) {
+            return obj;
+        }
+    }
+    return nullptr;
+}
+
+void MockHook::fname_init(FName* name, const wchar_t* str, uint32_t number) const {
+    const std::scoped_lock lock{this->names_mutex};
+
+    const std::wstring_view view{str};
+    auto iter = this->name_lookup.find(view);
+    if (iter == this->name_lookup.end()) {
+        auto idx = static_cast<uint32_t>(this->names.size());
+        // Deque never moves it's elements, so we can safely keep views to them
+        const auto& stored = this->names.emplace_back(view);
+        iter = this->name_lookup.emplace(stored, idx).first;
+    }
+
+    name->index = iter->second;
+    name->number = number;
+}
+
+std::variant<const std::string_view, const std::wstring_view> MockHook::fname_get_str(
+    const FName& name) const {
+    const std::scoped_lock lock{this->names_mutex};
+    return std::wstring_view{this->names.at(name.index)};
+}
+
+size_t MockHook::fname_iterate(size_t start,
+                               const std::function<void(uint32_t)>& callback,
+                               const std::function<void(uint32_t)>& /*empty_callback*/) const {
+    size_t count{};
+    {
+        // Don't hold the lock while running the callback, it'll likely want to get the string
+        const std::scoped_lock lock{this->names_mutex};
+        count = this->names.size();
+    }
+
+    for (auto idx = start; idx < count; idx++) {
+        callback(static_cast<uint32_t>(idx));
+    }
+    return std::max(start, count);
+}
+
+void MockHook::process_event(UObject* object, UFunction* func, void* params) const {
+    // Follow the same flow as the real process event hooks, there's just no native function to
+    // call in the middle
+    auto data = hook_manager::impl::preprocess_hook(L"ProcessEvent", func, object);
+    if (data == nullptr) {
+        return;
+    }
+
+    const WrappedStruct args_base{func, params};
+    WrappedStruct args = args_base.copy_params_only();
+    hook_manager::Details hook{.obj = object,
+                               .args = &args,
+                               .ret = {func->find_return_param()},
+                               .func = {.func = func, .object = object}};
+
+    const bool block_execution =
+        hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::PRE, hook);
+
+    if (hook.ret.has_value()) {
+        hook.ret.copy_to(reinterpret_cast<uintptr_t>(params));
+    }
+
+    if (!hook_manager::impl::has_post_hooks(data)) {
+        return;
+    }
+
+    if (hook.ret.prop != nullptr && !hook.ret.has_value() && !block_execution) {
+        hook.ret.copy_from(reinterpret_cast<uintptr_t>(params));
+    }
+
+    if (!block_execution) {
+        hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST, hook);
+        hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
+    }
+
+    hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL, hook);
+}
+
+void MockHook::uconsole_output_text(const std::wstring& /*str*/) const {}
+
+std::wstring MockHook::uobject_path_name(const UObject* obj) const {
+    std::wstringstream stream;
+    iter_path_name(obj, stream);
+    return stream.str();
+}
+
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+std::wstring MockHook::ffield_path_name(const FField* field) const {
+    // All our fields are directly owned by an object, don't need to worry about separators
+    const auto& owner = field->Owner();
+    std::wstring prefix = owner.is_ffield() ? this->ffield_path_name(owner.as_ffield())
+                                            : this->uobject_path_name(owner.as_uobject());
+    return prefix + L':' + std::wstring{field->Name()};
+}
+#endif
+
+const offsets::OffsetList& MockHook::get_offsets(void) const {
+    static const LayoutHook layout_hook{};
+    return layout_hook.get_offsets();
+}
+
+#pragma region Object Graph
+
+UObject* MockHook::new_object(size_t size, UClass* cls, const wchar_t* name, UObject* outer) {
+    auto obj = reinterpret_cast<UObject*>(this->u_malloc(size));
+    obj->Class() = cls;
+    obj->Name() = FName{name};
+    obj->Outer() = outer;
+
+#if UNREALSDK_GOBJECTS_FORMAT == UNREALSDK_GOBJECTS_FORMAT_FUOBJECTARRAY
+    auto& objects = this->gobjects_array.ObjObjects;
+    auto idx = static_cast<size_t>(objects.Count);
+
+    static constexpr size_t chunk_size = FChunkedFixedUObjectArray::NumElementsPerChunk;
+    if (idx / chunk_size >= this->gobjects_chunks.size()) {
+        this->gobjects_chunks.emplace_back(new FUObjectItem[chunk_size]());
+        this->gobjects_chunk_table.push_back(this->gobjects_chunks.back().get());
+
+        objects.Objects = this->gobjects_chunk_table.data();
+        objects.NumChunks = static_cast<int32_t>(this->gobjects_chunks.size());
+        objects.MaxChunks = objects.NumChunks;
+        objects.Max = static_cast<int32_t>(objects.NumChunks * chunk_size);
+    }
+
+    objects.Count++;
+    objects.at(idx)->Object = obj;
+#elif UNREALSDK_GOBJECTS_FORMAT == UNREALSDK_GOBJECTS_FORMAT_TARRAY
+    auto idx = this->gobjects_array.size();
+    this->gobjects_array.resize(idx + 1);
+    this->gobjects_array[idx] = obj;
+#else
+#error Unknown GObjects format
+#endif
+
+    obj->InternalIndex() = static_cast<int32_t>(idx);
+    return obj;
+}
+
+UStruct* MockHook::new_struct(size_t size,
+                              UClass* cls,
+                              const wchar_t* name,
+                              UObject* outer,
+                              UStruct* super_field) {
+    auto obj = reinterpret_cast<UStruct*>(this->new_object(size, cls, name, outer));
+    obj->SuperField() = super_field;
+    if (super_field != nullptr) {
+        obj->PropertySize() = super_field->PropertySize();
+        obj->PropertyLink() = super_field->PropertyLink();
+#if UNREALSDK_USTRUCT_HAS_ALIGNMENT
+        obj->MinAlignment() = super_field->MinAlignment();
+#endif
+    }
+    return obj;
+}
+
+MockHook::property_class_type* MockHook::new_property_class(const wchar_t* name,
+                                                            property_class_type* super_field) {
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+    auto cls = reinterpret_cast<FFieldClass*>(this->u_malloc(sizeof(layout::FFieldClass)));
+    cls->Name() = FName{name};
+    cls->SuperField() = super_field;
+    return cls;
+#else
+    return reinterpret_cast<UClass*>(
+        this->new_struct(sizeof(layout::UClass), this->class_class, name, this->core_package,
+                         super_field));
+#endif
+}
+
+ZProperty* MockHook::new_property(size_t size,
+                                  property_class_type* cls,
+                                  const wchar_t* name,
+                                  UStruct* owner,
+                                  int32_t element_size) {
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+    auto prop = reinterpret_cast<ZProperty*>(this->u_malloc(size));
+    prop->Class() = cls;
+    prop->Owner() = owner;
+    prop->Name() = FName{name};
+#else
+    auto prop = reinterpret_cast<ZProperty*>(this->new_object(size, cls, name, owner));
+#endif
+
+    prop->ArrayDim() = 1;
+    prop->ElementSize() = element_size;
+    return prop;
+}
+
+ZProperty* MockHook::add_property(size_t size,
+                                  property_class_type* cls,
+                                  const wchar_t* name,
+                                  UStruct* owner,
+                                  int32_t element_size) {
+    auto prop = this->new_property(size, cls, name, owner, element_size);
+
+    // All our element sizes are multiples of 4, so this always ends up a power of two
+    auto alignment = std::min(element_size, static_cast<int32_t>(alignof(void*)));
+    auto offset = (static_cast<int32_t>(owner->PropertySize()) + alignment - 1) & ~(alignment - 1);
+
+    prop->Offset_Internal() = offset;
+    owner->PropertySize() = static_cast<UStruct::property_size_type>(offset + element_size);
+#if UNREALSDK_USTRUCT_HAS_ALIGNMENT
+    owner->MinAlignment() = std::max(owner->MinAlignment(), alignment);
+#endif
+
+    // The property link chain continues on into the super field's properties, insert just before
+    // them
+    auto super_link =
+        owner->SuperField() == nullptr ? nullptr : owner->SuperField()->PropertyLink();
+    prop->PropertyLinkNext() = super_link;
+    if (owner->PropertyLink() == super_link) {
+        owner->PropertyLink() = prop;
+    } else {
+        auto tail = owner->PropertyLink();
+        for (; tail->PropertyLinkNext() != super_link; tail = tail->PropertyLinkNext()) {}
+        tail->PropertyLinkNext() = prop;
+    }
+
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+    if (owner->ChildProperties() == nullptr) {
+        owner->ChildProperties() = prop;
+    } else {
+        auto tail = owner->ChildProperties();
+        for (; tail->Next() != nullptr; tail = tail->Next()) {}
+        tail->Next() = prop;
+    }
+#else
+    append_child(owner, prop);
+#endif
+
+    return prop;
+}
+
+void MockHook::build_graph(void) {
+    // Core classes. UClass is the only class whose class is itself.
+    this->class_class = reinterpret_cast<UClass*>(
+        this->new_struct(sizeof(layout::UClass), nullptr, L"Class", nullptr, nullptr));
+    this->class_class->Class() = this->class_class;
+
+    auto package_class = reinterpret_cast<UClass*>(
+        this->new_struct(sizeof(layout::UClass), this->class_class, L"Package", nullptr, nullptr));
+    this->core_package =
+        this->new_object(sizeof(layout::UObject), package_class, L"Core", nullptr);
+    this->class_class->Outer() = this->core_package;
+    package_class->Outer() = this->core_package;
+
+    auto new_class = [this](const wchar_t* name, UStruct* super_field) {
+        return reinterpret_cast<UClass*>(this->new_struct(
+            sizeof(layout::UClass), this->class_class, name, this->core_package, super_field));
+    };
+
+    auto object_class = new_class(L"Object", nullptr);
+    object_class->PropertySize() =
+        static_cast<UStruct::property_size_type>(sizeof(layout::UObject));
+    auto field_class = new_class(L"Field", object_class);
+    auto struct_class = new_class(L"Struct", field_class);
+    auto script_struct_class = new_class(L"ScriptStruct", struct_class);
+    auto function_class = new_class(L"Function", struct_class);
+    this->class_class->SuperField() = struct_class;
+    package_class->SuperField() = object_class;
+
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+    this->property_class =
+        this->new_property_class(L"Property", this->new_property_class(L"Field", nullptr));
+#else
+    this->property_class = new_class(L"Property", field_class);
+#endif
+    auto int_prop_class = this->new_property_class(L"IntProperty", this->property_class);
+    auto float_prop_class = this->new_property_class(L"FloatProperty", this->property_class);
+    auto str_prop_class = this->new_property_class(L"StrProperty", this->property_class);
+    auto name_prop_class = this->new_property_class(L"NameProperty", this->property_class);
+    auto object_prop_class = this->new_property_class(L"ObjectProperty", this->property_class);
+    auto struct_prop_class = this->new_property_class(L"StructProperty", this->property_class);
+    auto array_prop_class = this->new_property_class(L"ArrayProperty", this->property_class);
+
+    // Benchmark types
+    auto bench_package =
+        this->new_object(sizeof(layout::UObject), package_class, L"Bench", nullptr);
+
+    auto vector_struct = reinterpret_cast<UScriptStruct*>(
+        this->new_struct(sizeof(layout::UScriptStruct), script_struct_class, L"BenchVector",
+                         bench_package, nullptr));
+    for (const auto* name : {L"X", L"Y", L"Z"}) {
+        this->add_property(sizeof(layout::ZFloatProperty), float_prop_class, name, vector_struct,
+                           sizeof(float));
+    }
+
+    auto base_class = new_class(L"BenchBase", object_class);
+    base_class->Outer() = bench_package;
+    this->add_property(sizeof(layout::ZIntProperty), int_prop_class, L"IntVal", base_class,
+                       sizeof(int32_t));
+    this->add_property(sizeof(layout::ZFloatProperty), float_prop_class, L"FloatVal", base_class,
+                       sizeof(float));
+    this->add_property(sizeof(layout::ZProperty), str_prop_class, L"StrVal", base_class,
+                       sizeof(UnmanagedFString));
+    this->add_property(sizeof(layout::ZProperty), name_prop_class, L"NameVal", base_class,
+                       sizeof(FName));
+
+    auto obj_prop = reinterpret_cast<ZObjectProperty*>(
+        this->add_property(sizeof(layout::ZObjectProperty), object_prop_class, L"ObjVal",
+                           base_class, sizeof(UObject*)));
+    obj_prop->PropertyClass() = base_class;
+
+    auto struct_prop = reinterpret_cast<ZStructProperty*>(this->add_property(
+        sizeof(layout::ZStructProperty), struct_prop_class, L"VecVal", base_class,
+        static_cast<int32_t>(vector_struct->PropertySize())));
+    struct_prop->Struct() = vector_struct;
+
+    auto array_prop = reinterpret_cast<ZArrayProperty*>(
+        this->add_property(sizeof(layout::ZArrayProperty), array_prop_class, L"IntArray",
+                           base_class, sizeof(TArray<uint8_t>)));
+    array_prop->Inner() = this->new_property(sizeof(layout::ZIntProperty), int_prop_class,
+                                             L"IntArray", base_class, sizeof(int32_t));
+
+    auto func = reinterpret_cast<UFunction*>(this->new_struct(
+        sizeof(layout::UFunction), function_class, L"BenchFunc", base_class, nullptr));
+    this->add_property(sizeof(layout::ZIntProperty), int_prop_class, L"Arg1", func,
+                       sizeof(int32_t))
+        ->PropertyFlags() |= ZProperty::PROP_FLAG_PARAM;
+    this->add_property(sizeof(layout::ZFloatProperty), float_prop_class, L"Arg2", func,
+                       sizeof(float))
+        ->PropertyFlags() |= ZProperty::PROP_FLAG_PARAM;
+    auto ret = this->add_property(sizeof(layout::ZIntProperty), int_prop_class, L"ReturnValue",
+                                  func, sizeof(int32_t));
+    ret->PropertyFlags() |= ZProperty::PROP_FLAG_PARAM | ZProperty::PROP_FLAG_RETURN;
+    func->NumParams() = 3;
+    func->ParamsSize() = static_cast<uint16_t>(func->PropertySize());
+    func->ReturnValueOffset() = static_cast<uint16_t>(ret->Offset_Internal());
+    append_child(base_class, func);
+
+    auto derived_class = new_class(L"BenchDerived", base_class);
+    derived_class->Outer() = bench_package;
+    this->add_property(sizeof(layout::ZIntProperty), int_prop_class, L"DerivedInt", derived_class,
+                       sizeof(int32_t));
+
+    // Instances, each pointing at the previous one
+    this->graph.instances.reserve(this->num_instances);
+    for (size_t i = 0; i < this->num_instances; i++) {
+        auto obj = this->new_object(static_cast<size_t>(derived_class->PropertySize()),
+                                    derived_class, L"BenchDerived", bench_package);
+        obj->Name() = FName{L"BenchDerived", static_cast<uint32_t>(i + 1)};
+
+        obj->set<ZIntProperty>(L"IntVal"_fn, static_cast<int32_t>(i));
+        if (!this->graph.instances.empty()) {
+            obj->set<ZObjectProperty>(L"ObjVal"_fn, this->graph.instances.back());
+        }
+
+        this->graph.instances.push_back(obj);
+    }
+
+    this->graph.base_class = base_class;
+    this->graph.derived_class = derived_class;
+    this->graph.vector_struct = vector_struct;
+    this->graph.func = func;
+}
+
+#pragma endregion
+
+}  // namespace unrealsdk::benchmark
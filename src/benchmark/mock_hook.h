@@ -0,0 +1,201 @@
+#ifndef BENCHMARK_MOCK_HOOK_H
+#define BENCHMARK_MOCK_HOOK_H
+
+#include "unrealsdk/pch.h"
+
+#include <deque>
+
+#include "unrealsdk/game/abstract_hook.h"
+#include "unrealsdk/unreal/wrappers/gobjects.h"
+
+#if UNREALSDK_GOBJECTS_FORMAT == UNREALSDK_GOBJECTS_FORMAT_FUOBJECTARRAY
+#include "unrealsdk/unreal/structs/gobjects.h"
+#elif UNREALSDK_GOBJECTS_FORMAT == UNREALSDK_GOBJECTS_FORMAT_TARRAY
+#include "unrealsdk/unreal/structs/tarray.h"
+#else
+#error Unknown GObjects format
+#endif
+
+namespace unrealsdk::unreal {
+
+class UClass;
+class UFunction;
+class UObject;
+class UScriptStruct;
+class UStruct;
+class ZProperty;
+struct FFieldClass;
+
+}  // namespace unrealsdk::unreal
+
+namespace unrealsdk::benchmark {
+
+/**
+ * @brief A game hook which doesn't hook anything, and instead serves a synthetic object graph.
+ * @note Reuses the memory layouts of one of the real games of the current flavour, so all field
+ *       accesses go through the same offset machinery they would in game.
+ */
+class MockHook : public game::AbstractHook {
+   public:
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+    using property_class_type = unreal::FFieldClass;
+#else
+    using property_class_type = unreal::UClass;
+#endif
+
+    /// Pointers into the synthetic object graph, for benchmarks to work on.
+    struct Graph {
+        unreal::UClass* base_class;
+        unreal::UClass* derived_class;
+        unreal::UScriptStruct* vector_struct;
+        unreal::UFunction* func;
+        std::vector<unreal::UObject*> instances;
+    };
+
+   private:
+    size_t num_instances;
+    Graph graph{};
+
+    mutable std::mutex names_mutex;
+    mutable std::deque<std::wstring> names;
+    mutable std::unordered_map<std::wstring_view, uint32_t> name_lookup;
+
+#if UNREALSDK_GOBJECTS_FORMAT == UNREALSDK_GOBJECTS_FORMAT_FUOBJECTARRAY
+    unreal::FUObjectArray gobjects_array{};
+    std::vector<std::unique_ptr<unreal::FUObjectItem[]>> gobjects_chunks;
+    std::vector<unreal::FUObjectItem*> gobjects_chunk_table;
+#elif UNREALSDK_GOBJECTS_FORMAT == UNREALSDK_GOBJECTS_FORMAT_TARRAY
+    unreal::TArray<unreal::UObject*> gobjects_array{};
+#else
+#error Unknown GObjects format
+#endif
+    unreal::GObjects gobjects_wrapper;
+
+    unreal::UClass* class_class = nullptr;
+    unreal::UObject* core_package = nullptr;
+    property_class_type* property_class = nullptr;
+
+    /**
+     * @brief Allocates a new zero-initialized object, and adds it to GObjects.
+     *
+     * @param size The size of the object to allocate.
+     * @param cls The object's class.
+     * @param name The object's name.
+     * @param outer The object's outer.
+     * @return The new object.
+     */
+    unreal::UObject* new_object(size_t size,
+                                unreal::UClass* cls,
+                                const wchar_t* name,
+                                unreal::UObject* outer);
+
+    /**
+     * @brief Creates a new struct-derived object, inheriting the layout of it's super field.
+     *
+     * @param size The size of the object to allocate.
+     * @param cls The object's class.
+     * @param name The object's name.
+     * @param outer The object's outer.
+     * @param super_field The struct to inherit from, may be null.
+     * @return The new struct.
+     */
+    unreal::UStruct* new_struct(size_t size,
+                                unreal::UClass* cls,
+                                const wchar_t* name,
+                                unreal::UObject* outer,
+                                unreal::UStruct* super_field);
+
+    /**
+     * @brief Creates a new property class.
+     *
+     * @param name The class name.
+     * @param super_field The class to inherit from.
+     * @return The new property class.
+     */
+    property_class_type* new_property_class(const wchar_t* name, property_class_type* super_field);
+
+    /**
+     * @brief Creates a new property, without linking it into any struct.
+     *
+     * @param size The size of the property object to allocate.
+     * @param cls The property's class.
+     * @param name The property's name.
+     * @param owner The object which owns this property.
+     * @param element_size The size of a single element of the property's value.
+     * @return The new property.
+     */
+    unreal::ZProperty* new_property(size_t size,
+                                    property_class_type* cls,
+                                    const wchar_t* name,
+                                    unreal::UStruct* owner,
+                                    int32_t element_size);
+
+    /**
+     * @brief Creates a new property, and links it onto the end of a struct.
+     *
+     * @param size The size of the property object to allocate.
+     * @param cls The property's class.
+     * @param name The property's name.
+     * @param owner The struct to add the property to.
+     * @param element_size The size of a single element of the property's value.
+     * @return The new property.
+     */
+    unreal::ZProperty* add_property(size_t size,
+                                    property_class_type* cls,
+                                    const wchar_t* name,
+                                    unreal::UStruct* owner,
+                                    int32_t element_size);
+
+    /**
+     * @brief Builds the synthetic object graph.
+     */
+    void build_graph(void);
+
+   public:
+    /**
+     * @brief Constructs a new mock hook.
+     *
+     * @param num_instances How many instance objects to add to GObjects.
+     */
+    MockHook(size_t num_instances);
+
+    /**
+     * @brief Gets the synthetic object graph.
+     * @note Only valid after the sdk has been initialized.
+     *
+     * @return The object graph.
+     */
+    [[nodiscard]] const Graph& get_graph(void) const;
+
+    void hook(void) override;
+    void post_init(void) override;
+
+    [[nodiscard]] bool is_console_ready(void) const override;
+
+    [[nodiscard]] const unreal::GObjects& gobjects(void) const override;
+    [[nodiscard]] void* u_malloc(size_t len) const override;
+    [[nodiscard]] void* u_realloc(void* original, size_t len) const override;
+    void u_free(void* data) const override;
+    [[nodiscard]] unreal::UObject* find_object(unreal::UClass* cls,
+                                               const std::wstring& name) const override;
+
+    void fname_init(unreal::FName* name, const wchar_t* str, uint32_t number) const override;
+    [[nodiscard]] std::variant<const std::string_view, const std::wstring_view> fname_get_str(
+        const unreal::FName& name) const override;
+    size_t fname_iterate(size_t start,
+                         const std::function<void(uint32_t)>& callback,
+                         const std::function<void(uint32_t)>& empty_callback) const override;
+    void process_event(unreal::UObject* object,
+                       unreal::UFunction* func,
+                       void* params) const override;
+    void uconsole_output_text(const std::wstring& str) const override;
+    [[nodiscard]] std::wstring uobject_path_name(const unreal::UObject* obj) const override;
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+    [[nodiscard]] std::wstring ffield_path_name(const unreal::FField* field) const override;
+#endif
+    [[nodiscard]] const unreal::offsets::OffsetList& get_offsets(void) const override;
+};
+
+}  // namespace unrealsdk::benchmark
+
+#endif /* BENCHMARK_MOCK_HOOK_H */
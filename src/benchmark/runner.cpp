@@ -0,0 +1,91 @@
+#include "unrealsdk/pch.h"
+
+#include "benchmark/runner.h"
+
+namespace unrealsdk::benchmark {
+
+namespace impl {
+
+volatile char optimization_sink{};
+
+}  // namespace impl
+
+namespace {
+
+/**
+ * @brief Parses an unsigned integer command line arg.
+ *
+ * @param name The arg's name, for error messages.
+ * @param value The arg's value.
+ * @return The parsed value.
+ */
+size_t parse_size(std::string_view name, std::string_view value) {
+    size_t ret{};
+    auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), ret);
+    if (ec != std::errc{} || ptr != value.data() + value.size()) {
+        throw std::invalid_argument(std::format("Invalid value for {}: '{}'", name, value));
+    }
+    return ret;
+}
+
+}  // namespace
+
+Runner::Runner(int argc, char* argv[]) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const std::vector<std::string_view> args{argv + 1, argv + argc};
+
+    for (size_t i = 0; i < args.size(); i++) {
+        const auto arg = args[i];
+        if (arg == "--csv") {
+            this->options.csv = true;
+            continue;
+        }
+
+        if (i + 1 >= args.size()) {
+            throw std::invalid_argument(std::format("Unknown or incomplete argument '{}'", arg));
+        }
+        const auto value = args[++i];
+
+        if (arg == "--filter") {
+            this->options.filter = value;
+        } else if (arg == "--objects") {
+            this->options.num_objects = parse_size(arg, value);
+        } else if (arg == "--repetitions") {
+            this->options.repetitions = std::max<size_t>(1, parse_size(arg, value));
+        } else if (arg == "--min-time") {
+            this->options.min_time = std::chrono::milliseconds{parse_size(arg, value)};
+        } else {
+            throw std::invalid_argument(std::format("Unknown argument '{}'", arg));
+        }
+    }
+}
+
+const Runner::Options& Runner::get_options(void) const {
+    return this->options;
+}
+
+bool Runner::matches(std::string_view name) const {
+    return name.find(this->options.filter) != std::string_view::npos;
+}
+
+void Runner::print_header(void) const {
+    if (this->options.csv) {
+        std::cout << "name,iterations,min_ns,median_ns\n";
+    } else {
+        std::cout << std::format("{:<48} {:>12} {:>14} {:>14}\n", "benchmark", "iterations",
+                                 "min ns/op", "median ns/op");
+    }
+}
+
+void Runner::report(std::string_view name, const Result& result) const {
+    if (this->options.csv) {
+        std::cout << std::format("{},{},{:.2f},{:.2f}\n", name, result.iterations, result.min_ns,
+                                 result.median_ns);
+    } else {
+        std::cout << std::format("{:<48} {:>12} {:>14.2f} {:>14.2f}\n", name, result.iterations,
+                                 result.min_ns, result.median_ns);
+    }
+    std::cout.flush();
+}
+
+}  // namespace unrealsdk::benchmark
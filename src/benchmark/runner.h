@@ -0,0 +1,127 @@
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include "unrealsdk/pch.h"
+
+namespace unrealsdk::benchmark {
+
+namespace impl {
+
+extern volatile char optimization_sink;
+
+}  // namespace impl
+
+/**
+ * @brief Forces a value to be materialized, preventing the compiler from optimizing it away.
+ *
+ * @param value The value to keep.
+ */
+template <typename T>
+void do_not_optimize(const T& value) {
+    impl::optimization_sink = *reinterpret_cast<const volatile char*>(std::addressof(value));
+}
+
+class Runner {
+   public:
+    struct Options {
+        std::string filter;
+        size_t num_objects = 10000;
+        size_t repetitions = 5;
+        std::chrono::milliseconds min_time{100};
+        bool csv = false;
+    };
+
+    /// The results of a single benchmark.
+    struct Result {
+        size_t iterations;
+        double min_ns;
+        double median_ns;
+    };
+
+   private:
+    using clock = std::chrono::steady_clock;
+
+    Options options;
+
+    /**
+     * @brief Prints the result of a benchmark.
+     *
+     * @param name The benchmark's name.
+     * @param result The result.
+     */
+    void report(std::string_view name, const Result& result) const;
+
+   public:
+    /**
+     * @brief Constructs a new runner.
+     * @note Throws an invalid argument exception on unknown or malformed args.
+     *
+     * @param argc The number of command line args.
+     * @param argv The command line args.
+     */
+    Runner(int argc, char* argv[]);
+
+    /**
+     * @brief Gets the runner's options.
+     *
+     * @return The options.
+     */
+    [[nodiscard]] const Options& get_options(void) const;
+
+    /**
+     * @brief Checks if a benchmark should run, based on the filter.
+     *
+     * @param name The benchmark's name.
+     * @return True if the benchmark should run.
+     */
+    [[nodiscard]] bool matches(std::string_view name) const;
+
+    /**
+     * @brief Prints the header for all following results.
+     */
+    void print_header(void) const;
+
+    /**
+     * @brief Runs a benchmark, and reports it's results.
+     * @note The iteration count is calibrated to run for at least the min time, then the benchmark
+     *       is repeated, and the minimum and median per-iteration times are reported.
+     *
+     * @param name The benchmark's name.
+     * @param func The function to benchmark. Called once per iteration.
+     */
+    template <typename Func>
+    void run(std::string_view name, Func&& func) const {
+        if (!this->matches(name)) {
+            return;
+        }
+
+        auto time_iterations = [&func](size_t iterations) {
+            auto start = clock::now();
+            for (size_t i = 0; i < iterations; i++) {
+                func();
+            }
+            return clock::now() - start;
+        };
+
+        size_t iterations = 1;
+        while (time_iterations(iterations) < this->options.min_time) {
+            iterations *= 2;
+        }
+
+        std::vector<double> times{};
+        times.reserve(this->options.repetitions);
+        for (size_t i = 0; i < this->options.repetitions; i++) {
+            const std::chrono::duration<double, std::nano> elapsed = time_iterations(iterations);
+            times.push_back(elapsed.count() / static_cast<double>(iterations));
+        }
+        std::ranges::sort(times);
+
+        this->report(name, {.iterations = iterations,
+                            .min_ns = times.front(),
+                            .median_ns = times[times.size() / 2]});
+    }
+};
+
+}  // namespace unrealsdk::benchmark
+
+#endif /* BENCHMARK_RUNNER_H */
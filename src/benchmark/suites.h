@@ -0,0 +1,52 @@
+#ifndef BENCHMARK_SUITES_H
+#define BENCHMARK_SUITES_H
+
+#include "unrealsdk/pch.h"
+
+#include "benchmark/mock_hook.h"
+
+namespace unrealsdk::benchmark {
+
+class Runner;
+
+/**
+ * @brief Benchmarks dispatching calls through the hook manager.
+ *
+ * @param runner The runner to run benchmarks with.
+ * @param graph The mock object graph.
+ */
+void bench_hooks(const Runner& runner, const MockHook::Graph& graph);
+
+/**
+ * @brief Benchmarks getting and setting properties, and copying structs.
+ *
+ * @param runner The runner to run benchmarks with.
+ * @param graph The mock object graph.
+ */
+void bench_properties(const Runner& runner, const MockHook::Graph& graph);
+
+/**
+ * @brief Benchmarks object lookups - GObjects scans, finding classes/objects/props, and casting.
+ *
+ * @param runner The runner to run benchmarks with.
+ * @param graph The mock object graph.
+ */
+void bench_objects(const Runner& runner, const MockHook::Graph& graph);
+
+/**
+ * @brief Benchmarks logging throughput.
+ *
+ * @param runner The runner to run benchmarks with.
+ */
+void bench_logging(const Runner& runner);
+
+/**
+ * @brief Benchmarks string conversions.
+ *
+ * @param runner The runner to run benchmarks with.
+ */
+void bench_utils(const Runner& runner);
+
+}  // namespace unrealsdk::benchmark
+
+#endif /* BENCHMARK_SUITES_H */
@@ -0,0 +1,216 @@
+// This tool is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - it only links the pattern tables and the searching logic, so it can be built on any platform.
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sigscan_validator/pe_image.h"
+#include "unrealsdk/pattern.h"
+#include "unrealsdk/pattern_search.h"
+
+/*
+Offline sigscan validator.
+
+Runs every pattern registered via `UNREALSDK_REGISTER_PATTERN` against an executable read from
+disk, using the same scanning code as in game, and reports where each one matched, how many times it
+matched (patterns must be unique to be reliable), and how long the scan took. No game needs to be
+running, so this can be used to check a new game patch straight from a dumped binary.
+
+Every game's patterns are registered, regardless of flavour, so one build validates all games. Use
+`--game` to only check one of them.
+
+Usage:
+    unrealsdk_sigscan_validator <executable> [--game <name>] [--csv] [--strict]
+
+With `--strict`, exits with a non-zero code if any pattern doesn't have exactly one match. Note that
+some games deliberately have alternate patterns for different builds (e.g. PGO and non-PGO), where
+only one is expected to match.
+*/
+
+using namespace unrealsdk::memory;
+using namespace unrealsdk::sigscan_validator;
+
+namespace {
+
+struct Options {
+    std::filesystem::path executable;
+    std::string game;
+    bool csv = false;
+    bool strict = false;
+};
+
+/**
+ * @brief Parses the command line args.
+ * @note Throws an invalid argument exception on unknown or malformed args.
+ *
+ * @param argc The number of command line args.
+ * @param argv The command line args.
+ * @return The parsed options.
+ */
+Options parse_args(int argc, char* argv[]) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const std::vector<std::string_view> args{argv + 1, argv + argc};
+
+    Options options{};
+    for (size_t i = 0; i < args.size(); i++) {
+        const auto arg = args[i];
+        if (arg == "--csv") {
+            options.csv = true;
+        } else if (arg == "--strict") {
+            options.strict = true;
+        } else if (arg == "--game") {
+            if (i + 1 >= args.size()) {
+                throw std::invalid_argument("--game requires a value");
+            }
+            options.game = args[++i];
+        } else if (arg.starts_with("--") || !options.executable.empty()) {
+            throw std::invalid_argument("Unknown argument '" + std::string{arg} + "'");
+        } else {
+            options.executable = arg;
+        }
+    }
+
+    if (options.executable.empty()) {
+        throw std::invalid_argument("No executable given");
+    }
+    return options;
+}
+
+/// The result of validating a single pattern.
+struct Result {
+    uintptr_t first_match;
+    size_t match_count;
+    std::chrono::nanoseconds scan_time;
+};
+
+/**
+ * @brief Scans for a pattern across a region of memory.
+ *
+ * @param pattern The pattern to scan for.
+ * @param start The address to start scanning at.
+ * @param size The size of the region.
+ * @return The scan results.
+ */
+Result validate_pattern(const RegisteredPattern& pattern, uintptr_t start, size_t size) {
+    // Time just the first scan, since that's what we actually do in game
+    auto scan_start = std::chrono::steady_clock::now();
+    auto first_match = find_pattern(pattern.bytes, pattern.mask, pattern.pattern_size,
+                                    *pattern.search, start, size);
+    auto scan_time = std::chrono::steady_clock::now() - scan_start;
+
+    size_t match_count = 0;
+    auto end = start + size;
+    for (auto match = first_match; match != 0;) {
+        match_count++;
+
+        auto next = match + 1;
+        if (end - next < pattern.pattern_size) {
+            break;
+        }
+        match = find_pattern(pattern.bytes, pattern.mask, pattern.pattern_size, *pattern.search,
+                             next, end - next);
+    }
+
+    return {.first_match = first_match,
+            .match_count = match_count,
+            .scan_time = std::chrono::duration_cast<std::chrono::nanoseconds>(scan_time)};
+}
+
+/**
+ * @brief Prints a row of the human readable results table.
+ *
+ * @param game The game column.
+ * @param pattern The pattern column.
+ * @param address The address column.
+ * @param matches The matches column.
+ * @param scan_us The scan time column.
+ */
+void print_row(std::string_view game,
+               std::string_view pattern,
+               std::string_view address,
+               std::string_view matches,
+               std::string_view scan_us) {
+    // NOLINTBEGIN(readability-magic-numbers)
+    std::cout << std::left << std::setw(6) << game << ' ' << std::setw(40) << pattern << ' '
+              << std::right << std::setw(18) << address << ' ' << std::setw(8) << matches << ' '
+              << std::setw(12) << scan_us << '\n';
+    // NOLINTEND(readability-magic-numbers)
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        auto options = parse_args(argc, argv);
+        const PEImage image{options.executable};
+        auto [start, size] = image.range();
+
+        if (options.csv) {
+            std::cout << "game,pattern,address,matches,scan_us\n";
+        } else {
+            print_row("game", "pattern", "address", "matches", "scan us");
+        }
+
+        size_t num_patterns = 0;
+        size_t num_failed = 0;
+        std::chrono::nanoseconds total_time{};
+
+        for (const auto& pattern : registered_patterns()) {
+            if (!options.game.empty() && pattern.game != options.game) {
+                continue;
+            }
+
+            auto result = validate_pattern(pattern, start, size);
+            num_patterns++;
+            total_time += result.scan_time;
+            if (result.match_count != 1) {
+                num_failed++;
+            }
+
+            std::string address = "not found";
+            if (result.first_match != 0) {
+                std::ostringstream stream{};
+                stream << std::hex << std::showbase
+                       << image.to_game_address(result.first_match)
+                              + static_cast<uint64_t>(pattern.offset);
+                address = stream.str();
+            }
+
+            std::ostringstream scan_us{};
+            scan_us << std::fixed << std::setprecision(1)
+                    << std::chrono::duration<double, std::micro>(result.scan_time).count();
+
+            if (options.csv) {
+                std::cout << pattern.game << ',' << pattern.name << ',' << address << ','
+                          << result.match_count << ',' << scan_us.str() << '\n';
+            } else {
+                print_row(pattern.game, pattern.name, address, std::to_string(result.match_count),
+                          scan_us.str());
+            }
+        }
+
+        if (num_patterns == 0) {
+            std::cerr << "No patterns registered for game '" << options.game << "'\n";
+            return 1;
+        }
+
+        std::cerr << num_patterns << " patterns, " << num_failed
+                  << " without exactly one match, " << std::fixed << std::setprecision(1)
+                  << std::chrono::duration<double, std::milli>(total_time).count()
+                  << "ms total scan time\n";
+
+        return options.strict && num_failed > 0 ? 1 : 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "Validation failed: " << ex.what() << "\n";
+        return 1;
+    }
+}
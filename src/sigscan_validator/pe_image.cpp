@@ -0,0 +1,301 @@
+// Deliberately doesn't include the pch, see the header
+#include "sigscan_validator/pe_image.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace unrealsdk::sigscan_validator {
+
+namespace {
+
+/*
+Our own definitions of the PE structures we need, so that we don't depend on windows.h. Only the
+fields we actually use are named. Everything in a PE file is little endian, as are all platforms we
+care about, so these can be read directly.
+*/
+
+const constexpr uint16_t DOS_SIGNATURE = 0x5A4D;     // "MZ"
+const constexpr uint32_t NT_SIGNATURE = 0x00004550;  // "PE\0\0"
+const constexpr uint16_t OPTIONAL_HDR32_MAGIC = 0x10B;
+const constexpr uint16_t OPTIONAL_HDR64_MAGIC = 0x20B;
+
+struct DosHeader {
+    uint16_t magic;
+    std::array<uint8_t, 0x3A> unused;
+    int32_t nt_offset;
+};
+static_assert(sizeof(DosHeader) == 0x40);
+
+struct FileHeader {
+    uint16_t machine;
+    uint16_t num_sections;
+    uint32_t timestamp;
+    uint32_t symbol_table_offset;
+    uint32_t num_symbols;
+    uint16_t optional_header_size;
+    uint16_t characteristics;
+};
+static_assert(sizeof(FileHeader) == 20);
+
+// The optional headers only include the fields up to the ones we need
+struct OptionalHeader32 {
+    uint16_t magic;
+    std::array<uint8_t, 0x1A> unused_1;
+    uint32_t image_base;
+    std::array<uint8_t, 0x18> unused_2;
+    uint32_t image_size;
+    uint32_t headers_size;
+};
+static_assert(sizeof(OptionalHeader32) == 0x40);
+
+struct OptionalHeader64 {
+    uint16_t magic;
+    std::array<uint8_t, 0x16> unused_1;
+    uint64_t image_base;
+    std::array<uint8_t, 0x18> unused_2;
+    uint32_t image_size;
+    uint32_t headers_size;
+};
+static_assert(sizeof(OptionalHeader64) == 0x40);
+
+struct SectionHeader {
+    std::array<char, 8> name;
+    uint32_t virtual_size;
+    uint32_t virtual_address;
+    uint32_t raw_data_size;
+    uint32_t raw_data_offset;
+    uint32_t relocations_offset;
+    uint32_t line_numbers_offset;
+    uint16_t num_relocations;
+    uint16_t num_line_numbers;
+    uint32_t characteristics;
+};
+static_assert(sizeof(SectionHeader) == 40);
+
+/**
+ * @brief A read only, memory mapped, file.
+ * @note Executables can be hundreds of megabytes, and we only copy out the sections, so this avoids
+ *       ever holding a second full copy of the file.
+ */
+class MappedFile {
+   private:
+#ifdef _WIN32
+    HANDLE file_handle = nullptr;
+    HANDLE mapping_handle = nullptr;
+#else
+    int file_descriptor = -1;
+#endif
+    const uint8_t* data = nullptr;
+    size_t file_size = 0;
+
+    /**
+     * @brief Unmaps and closes the file.
+     */
+    void close(void) {
+#ifdef _WIN32
+        if (this->data != nullptr) {
+            UnmapViewOfFile(this->data);
+        }
+        if (this->mapping_handle != nullptr) {
+            CloseHandle(this->mapping_handle);
+        }
+        if (this->file_handle != nullptr) {
+            CloseHandle(this->file_handle);
+        }
+        this->mapping_handle = nullptr;
+        this->file_handle = nullptr;
+#else
+        if (this->data != nullptr) {
+            munmap(const_cast<uint8_t*>(this->data), this->file_size);
+        }
+        if (this->file_descriptor >= 0) {
+            ::close(this->file_descriptor);
+        }
+        this->file_descriptor = -1;
+#endif
+
+        this->data = nullptr;
+        this->file_size = 0;
+    }
+
+   public:
+    MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        this->file_handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (this->file_handle == INVALID_HANDLE_VALUE) {
+            this->file_handle = nullptr;
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+
+        LARGE_INTEGER size{};
+        if (GetFileSizeEx(this->file_handle, &size) == 0) {
+            this->close();
+            throw std::runtime_error("Failed to get size of " + path.string());
+        }
+        this->file_size = static_cast<size_t>(size.QuadPart);
+
+        if (this->file_size > 0) {
+            this->mapping_handle =
+                CreateFileMappingW(this->file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (this->mapping_handle == nullptr) {
+                this->close();
+                throw std::runtime_error("Failed to map " + path.string());
+            }
+            this->data = static_cast<const uint8_t*>(
+                MapViewOfFile(this->mapping_handle, FILE_MAP_READ, 0, 0, 0));
+        }
+#else
+        this->file_descriptor = open(path.c_str(), O_RDONLY);
+        if (this->file_descriptor < 0) {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+
+        struct stat info{};
+        if (fstat(this->file_descriptor, &info) != 0) {
+            this->close();
+            throw std::runtime_error("Failed to get size of " + path.string());
+        }
+        this->file_size = static_cast<size_t>(info.st_size);
+
+        if (this->file_size > 0) {
+            auto mapped =
+                mmap(nullptr, this->file_size, PROT_READ, MAP_PRIVATE, this->file_descriptor, 0);
+            this->data = mapped == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(mapped);
+        }
+#endif
+
+        if (this->data == nullptr) {
+            this->close();
+            throw std::runtime_error("Failed to read " + path.string());
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+    ~MappedFile() { this->close(); }
+
+    /**
+     * @brief Gets a pointer to a structure within the file, with bounds checking.
+     *
+     * @tparam T The type of the structure.
+     * @param offset The file offset of the structure.
+     * @param count How many contiguous structures to check are within bounds.
+     * @return A pointer to the structure.
+     */
+    template <typename T>
+    [[nodiscard]] const T* at(size_t offset, size_t count = 1) const {
+        if (offset > this->file_size || (this->file_size - offset) / sizeof(T) < count) {
+            throw std::runtime_error("PE file is truncated");
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return reinterpret_cast<const T*>(this->data + offset);
+    }
+
+    [[nodiscard]] size_t size(void) const { return this->file_size; }
+};
+
+/**
+ * @brief Gets the image layout values we need out of the optional header.
+ *
+ * @tparam T The type of the optional header to read, either the 32 or 64-bit version.
+ * @param file The mapped file.
+ * @param optional_offset The file offset of the optional header.
+ * @return A tuple of the image base, the size of the image, and the size of the headers.
+ */
+template <typename T>
+std::tuple<uint64_t, size_t, size_t> read_optional_header(const MappedFile& file,
+                                                          size_t optional_offset) {
+    auto header = file.at<T>(optional_offset);
+    return {header->image_base, header->image_size, header->headers_size};
+}
+
+}  // namespace
+
+PEImage::PEImage(const std::filesystem::path& path) {
+    const MappedFile file{path};
+
+    auto dos_header = file.at<DosHeader>(0);
+    if (dos_header->magic != DOS_SIGNATURE || dos_header->nt_offset < 0) {
+        throw std::runtime_error("Not a PE file: " + path.string());
+    }
+    auto nt_offset = static_cast<size_t>(dos_header->nt_offset);
+
+    if (*file.at<uint32_t>(nt_offset) != NT_SIGNATURE) {
+        throw std::runtime_error("Not a PE file: " + path.string());
+    }
+
+    // The file header is the same across bitnesses, only the optional header changes
+    auto file_header = file.at<FileHeader>(nt_offset + sizeof(uint32_t));
+    auto optional_offset = nt_offset + sizeof(uint32_t) + sizeof(FileHeader);
+
+    size_t image_size{};
+    size_t headers_size{};
+    switch (*file.at<uint16_t>(optional_offset)) {
+        case OPTIONAL_HDR32_MAGIC:
+            std::tie(this->image_base, image_size, headers_size) =
+                read_optional_header<OptionalHeader32>(file, optional_offset);
+            break;
+        case OPTIONAL_HDR64_MAGIC:
+            std::tie(this->image_base, image_size, headers_size) =
+                read_optional_header<OptionalHeader64>(file, optional_offset);
+            break;
+        default:
+            throw std::runtime_error("Unknown PE optional header format: " + path.string());
+    }
+
+    this->image.resize(image_size);
+
+    auto copy_into_image = [&](size_t file_offset, size_t rva, size_t size) {
+        if (rva > image_size || size > image_size - rva) {
+            throw std::runtime_error("PE section lies outside of the image");
+        }
+        std::memcpy(this->image.data() + rva, file.at<uint8_t>(file_offset, size), size);
+    };
+
+    copy_into_image(0, 0, std::min({headers_size, image_size, file.size()}));
+
+    auto sections = file.at<SectionHeader>(optional_offset + file_header->optional_header_size,
+                                           file_header->num_sections);
+    for (size_t i = 0; i < file_header->num_sections; i++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto& section = sections[i];
+
+        // Anything past the raw data is zero-initialized (e.g. bss), which our vector already is
+        // Some linkers leave the virtual size empty, in which case the raw size is accurate
+        auto size = section.virtual_size == 0
+                        ? section.raw_data_size
+                        : std::min<size_t>(section.raw_data_size, section.virtual_size);
+        if (size == 0) {
+            continue;
+        }
+        copy_into_image(section.raw_data_offset, section.virtual_address, size);
+    }
+}
+
+std::pair<uintptr_t, size_t> PEImage::range(void) const {
+    return {reinterpret_cast<uintptr_t>(this->image.data()), this->image.size()};
+}
+
+uint64_t PEImage::to_game_address(uintptr_t addr) const {
+    return this->image_base + (addr - reinterpret_cast<uintptr_t>(this->image.data()));
+}
+
+}  // namespace unrealsdk::sigscan_validator
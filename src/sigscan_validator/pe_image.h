@@ -0,0 +1,51 @@
+#ifndef SIGSCAN_VALIDATOR_PE_IMAGE_H
+#define SIGSCAN_VALIDATOR_PE_IMAGE_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that executables can be read, and the reader tested, on any platform.
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+namespace unrealsdk::sigscan_validator {
+
+/**
+ * @brief A PE executable read from disk, with it's sections laid out as they would be once loaded.
+ * @note Supports both 32 and 64-bit executables, independent of our own bitness.
+ */
+class PEImage {
+   private:
+    std::vector<uint8_t> image;
+    uint64_t image_base{};
+
+   public:
+    /**
+     * @brief Reads an executable, and reconstructs it's loaded image layout.
+     * @note Throws a runtime error if the file can't be read, or isn't a valid PE file.
+     *
+     * @param path The path to the executable.
+     */
+    PEImage(const std::filesystem::path& path);
+
+    /**
+     * @brief Gets the address range covered by the image, in our own memory.
+     *
+     * @return A pair of the start address and the length.
+     */
+    [[nodiscard]] std::pair<uintptr_t, size_t> range(void) const;
+
+    /**
+     * @brief Converts an address within our copy of the image to the address it would have in game.
+     * @note Assumes the image gets loaded at it's preferred base address.
+     *
+     * @param addr The address within our copy of the image.
+     * @return The equivalent in-game address.
+     */
+    [[nodiscard]] uint64_t to_game_address(uintptr_t addr) const;
+};
+
+}  // namespace unrealsdk::sigscan_validator
+
+#endif /* SIGSCAN_VALIDATOR_PE_IMAGE_H */
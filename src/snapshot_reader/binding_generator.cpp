@@ -0,0 +1,375 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "snapshot_reader/snapshot_reader.h"
+
+/*
+Typed binding generator.
+
+Reads a snapshot written by `unrealsdk::snapshot::dump`, and emits a header containing accessors for
+all of the given structs' own properties, which read directly at the dumped offsets. See
+`unrealsdk/unreal/bindings.h` for how these are validated at runtime.
+
+Only properties which can be accessed by a simple reference (plus bools) are bound, anything else
+is listed in a comment, and should continue to be accessed through reflection. Inherited properties
+are not bound, include the parent struct to access them.
+
+Usage:
+    unrealsdk_binding_generator <snapshot> <output header> <namespace> <struct path>...
+*/
+
+using namespace unrealsdk::snapshot;
+
+namespace {
+
+struct BoundType {
+    std::string_view property;
+    std::string_view cpp_type;
+};
+
+const constexpr std::array BOUND_TYPES{
+    BoundType{"Int8Property", "int8_t"},
+    BoundType{"Int16Property", "int16_t"},
+    BoundType{"IntProperty", "int32_t"},
+    BoundType{"Int64Property", "int64_t"},
+    BoundType{"ByteProperty", "uint8_t"},
+    BoundType{"UInt16Property", "uint16_t"},
+    BoundType{"UInt32Property", "uint32_t"},
+    BoundType{"UInt64Property", "uint64_t"},
+    BoundType{"FloatProperty", "float32_t"},
+    BoundType{"DoubleProperty", "float64_t"},
+    BoundType{"NameProperty", "unrealsdk::unreal::FName"},
+    BoundType{"StrProperty", "unrealsdk::unreal::UnmanagedFString"},
+    BoundType{"ObjectProperty", "unrealsdk::unreal::UObject*"},
+    BoundType{"ComponentProperty", "unrealsdk::unreal::UObject*"},
+    BoundType{"ClassProperty", "unrealsdk::unreal::UClass*"},
+};
+
+const constexpr std::string_view BOOL_PROPERTY = "BoolProperty";
+
+// Appended to the name of each accessor's variant which skips all checks
+const constexpr std::string_view UNCHECKED_SUFFIX = "_unchecked";
+// The unchecked accessors are static, since they don't depend on the binding set's state
+const constexpr std::string_view UNCHECKED_BINDINGS = "unrealsdk::unreal::BindingSet::";
+
+/**
+ * @brief Formats a number as hex.
+ *
+ * @param value The value to format.
+ * @return The formatted string.
+ */
+std::string hex(uint64_t value) {
+    std::array<char, 16> buf{};
+    auto [end, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), value, 16);
+    return "0x" + std::string{buf.data(), end};
+}
+
+/**
+ * @brief Converts a utf-8 string into a wide string literal.
+ *
+ * @param str The string to convert.
+ * @return The literal, including the `L` prefix and quotes.
+ */
+std::string wide_literal(std::string_view str) {
+    std::string output = "L\"";
+
+    for (size_t i = 0; i < str.size();) {
+        auto lead = static_cast<uint8_t>(str[i]);
+        if (lead < 0x80) {
+            if (lead == '"' || lead == '\\') {
+                output.push_back('\\');
+            }
+            if (lead < 0x20 || lead == 0x7F) {
+                output += "\\x" + hex(lead).substr(2) + "\"L\"";
+            } else {
+                output.push_back(static_cast<char>(lead));
+            }
+            i++;
+            continue;
+        }
+
+        size_t len = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+        if (i + len > str.size()) {
+            throw std::runtime_error("String contained invalid utf-8");
+        }
+        uint32_t code_point = lead & (0x7F >> len);
+        for (size_t j = 1; j < len; j++) {
+            code_point = (code_point << 6) | (static_cast<uint8_t>(str[i + j]) & 0x3F);
+        }
+        i += len;
+
+        auto digits = hex(code_point).substr(2);
+        output += "\\U" + std::string(8 - digits.size(), '0') + digits;
+    }
+
+    return output + "\"";
+}
+
+/**
+ * @brief Converts a name into a valid C++ identifier.
+ *
+ * @param name The name to convert.
+ * @return The identifier.
+ */
+std::string identifier(std::string_view name) {
+    std::string output{};
+    for (auto chr : name) {
+        auto byte = static_cast<uint8_t>(chr);
+        bool valid = (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z')
+                     || (byte >= '0' && byte <= '9') || byte == '_';
+        output.push_back(valid ? chr : '_');
+    }
+    if (output.empty() || (output.front() >= '0' && output.front() <= '9')) {
+        output.insert(output.begin(), '_');
+    }
+    return output;
+}
+
+class Generator {
+   private:
+    const Snapshot& snapshot;
+    std::string namespace_name;
+
+    std::ostringstream structs{};
+    std::ostringstream fields{};
+    std::ostringstream accessors{};
+    size_t num_structs = 0;
+    size_t num_fields = 0;
+    std::unordered_set<std::string> identifiers{};
+
+    /**
+     * @brief Reserves an identifier, throwing if it's already been used.
+     *
+     * @param name The identifier to reserve.
+     */
+    void reserve(const std::string& name) {
+        if (!this->identifiers.insert(name).second) {
+            throw std::runtime_error("Multiple bindings would be called " + name
+                                     + ", try generating the colliding structs separately");
+        }
+    }
+
+    /**
+     * @brief Adds a field to the expected layouts.
+     *
+     * @param struct_index The index of the struct holding the property.
+     * @param prop The property.
+     */
+    void add_field(size_t struct_index, const format::Property& prop) {
+        this->fields << "    {" << struct_index << ", "
+                     << wide_literal(this->snapshot.name(prop.name)) << ", "
+                     << wide_literal(this->snapshot.name(prop.type)) << ", " << hex(prop.offset)
+                     << ", " << hex(prop.element_size) << ", " << prop.array_dim << ", "
+                     << hex(prop.field_mask) << "},\n";
+        this->num_fields++;
+    }
+
+   public:
+    Generator(const Snapshot& snapshot, std::string namespace_name)
+        : snapshot(snapshot), namespace_name(std::move(namespace_name)) {}
+
+    /**
+     * @brief Adds accessors for all of a struct's own properties.
+     *
+     * @param ustruct The struct to add.
+     */
+    void add_struct(const format::Struct& ustruct) {
+        std::string_view base_type{};
+        std::string_view const_base_type{};
+        switch (ustruct.kind) {
+            case format::StructKind::CLASS:
+                base_type = "unrealsdk::unreal::UObject*";
+                const_base_type = "const unrealsdk::unreal::UObject*";
+                break;
+            case format::StructKind::STRUCT:
+            case format::StructKind::SCRIPT_STRUCT:
+                base_type = "unrealsdk::unreal::WrappedStruct&";
+                const_base_type = "const unrealsdk::unreal::WrappedStruct&";
+                break;
+            default:
+                throw std::runtime_error("Can't generate bindings for "
+                                         + std::string{this->snapshot.string(ustruct.path)}
+                                         + ", it's not a class or struct");
+        }
+
+        auto struct_index = this->num_structs++;
+        this->structs << "    {" << wide_literal(this->snapshot.name(ustruct.class_name)) << ", "
+                      << wide_literal(this->snapshot.string(ustruct.path)) << "},\n";
+
+        auto struct_name = identifier(this->snapshot.name(ustruct.name));
+        this->accessors << "\n// " << this->snapshot.string(ustruct.path) << "\n\n";
+
+        std::vector<std::string> skipped{};
+        for (const auto& prop : this->snapshot.properties_of(ustruct)) {
+            auto prop_name = this->snapshot.name(prop.name);
+            auto type = this->snapshot.name(prop.type);
+            auto accessor = struct_name + "_" + identifier(prop_name);
+
+            if (type == BOOL_PROPERTY && prop.array_dim == 1) {
+                this->reserve(accessor);
+                this->reserve("set_" + accessor);
+                this->reserve(accessor + std::string{UNCHECKED_SUFFIX});
+                this->reserve("set_" + accessor + std::string{UNCHECKED_SUFFIX});
+                this->add_field(struct_index, prop);
+
+                for (const bool unchecked : {false, true}) {
+                    auto suffix = unchecked ? UNCHECKED_SUFFIX : "";
+                    auto args = unchecked ? std::string{"(obj, "}
+                                          : "(obj, " + std::to_string(struct_index) + ", ";
+                    auto bindings = unchecked ? UNCHECKED_BINDINGS : "BINDINGS.";
+
+                    this->accessors << "[[nodiscard]] inline bool " << accessor << suffix << "("
+                                    << const_base_type << " obj) {\n"
+                                    << "    return " << bindings << "get_bool" << suffix << args
+                                    << hex(prop.offset) << ", " << hex(prop.field_mask) << ");\n"
+                                    << "}\n"
+                                    << "inline void set_" << accessor << suffix << "("
+                                    << base_type << " obj, bool value) {\n"
+                                    << "    " << bindings << "set_bool" << suffix << args
+                                    << hex(prop.offset) << ", " << hex(prop.field_mask)
+                                    << ", value);\n"
+                                    << "}\n";
+                }
+                continue;
+            }
+
+            auto bound = std::ranges::find(BOUND_TYPES, type, &BoundType::property);
+            if (bound == BOUND_TYPES.end()) {
+                skipped.push_back(std::string{type} + " " + std::string{prop_name});
+                continue;
+            }
+
+            this->reserve(accessor);
+            this->reserve(accessor + std::string{UNCHECKED_SUFFIX});
+            this->add_field(struct_index, prop);
+
+            // Emit both a mutable and a const overload, of both the checked and unchecked versions
+            for (const bool unchecked : {false, true}) {
+                auto suffix = unchecked ? UNCHECKED_SUFFIX : "";
+                auto args = unchecked ? std::string{"(obj, "}
+                                      : "(obj, " + std::to_string(struct_index) + ", ";
+                auto bindings = unchecked ? UNCHECKED_BINDINGS : "BINDINGS.";
+
+                for (const bool is_const : {false, true}) {
+                    this->accessors << "[[nodiscard]] inline " << bound->cpp_type
+                                    << (is_const ? " const& " : "& ") << accessor << suffix << "("
+                                    << (is_const ? const_base_type : base_type) << " obj";
+
+                    if (prop.array_dim == 1) {
+                        this->accessors << ") {\n"
+                                        << "    return " << bindings << "field" << suffix << "<"
+                                        << bound->cpp_type << ">" << args << hex(prop.offset)
+                                        << ");\n"
+                                        << "}\n";
+                        continue;
+                    }
+
+                    this->accessors << ", size_t idx) {\n";
+                    // The unchecked versions skip the bounds check too
+                    if (!unchecked) {
+                        this->accessors << "    if (idx >= " << prop.array_dim << ") {\n"
+                                        << "        throw std::out_of_range(\"Property index out "
+                                           "of range\");\n"
+                                        << "    }\n";
+                    }
+                    this->accessors << "    return " << bindings << "field" << suffix << "<"
+                                    << bound->cpp_type << ">" << args << hex(prop.offset)
+                                    << " + (static_cast<int32_t>(idx) * "
+                                    << hex(prop.element_size) << "));\n"
+                                    << "}\n";
+                }
+            }
+        }
+
+        for (const auto& name : skipped) {
+            this->accessors << "// Not bound: " << name << "\n";
+        }
+    }
+
+    /**
+     * @brief Writes the generated header.
+     *
+     * @param output The stream to write to.
+     */
+    void write(std::ostream& output) const {
+        auto guard = identifier(this->namespace_name) + "_BINDINGS_H";
+        std::ranges::transform(guard, guard.begin(), [](char chr) {
+            return chr >= 'a' && chr <= 'z' ? static_cast<char>(chr - 'a' + 'A') : chr;
+        });
+
+        output << "// Generated by unrealsdk_binding_generator, do not edit.\n"
+               << "// These bindings are only valid on the exact game build they were generated "
+                  "from.\n"
+               << "// Call `" << this->namespace_name
+               << "::BINDINGS.validate()` once initialized, before using any accessors.\n\n"
+               << "#ifndef " << guard << "\n"
+               << "#define " << guard << "\n\n"
+               << "#include \"unrealsdk/pch.h\"\n\n"
+               << "#include \"unrealsdk/unreal/bindings.h\"\n"
+               << "#include \"unrealsdk/unreal/classes/uclass.h\"\n"
+               << "#include \"unrealsdk/unreal/classes/uobject.h\"\n"
+               << "#include \"unrealsdk/unreal/structs/fname.h\"\n"
+               << "#include \"unrealsdk/unreal/structs/fstring.h\"\n"
+               << "#include \"unrealsdk/unreal/wrappers/wrapped_struct.h\"\n\n"
+               << "namespace " << this->namespace_name << " {\n\n"
+               << "// NOLINTBEGIN(readability-identifier-naming)\n\n"
+               << "inline constexpr std::array<unrealsdk::unreal::StructLayout, "
+               << this->num_structs << "> STRUCTS{{\n"
+               << this->structs.str() << "}};\n\n"
+               << "inline constexpr std::array<unrealsdk::unreal::FieldLayout, "
+               << this->num_fields << "> FIELDS{{\n"
+               << this->fields.str() << "}};\n\n"
+               << "inline unrealsdk::unreal::BindingSet BINDINGS{STRUCTS, FIELDS};\n"
+               << this->accessors.str() << "\n"
+               << "// NOLINTEND(readability-identifier-naming)\n\n"
+               << "}  // namespace " << this->namespace_name << "\n\n"
+               << "#endif /* " << guard << " */\n";
+    }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 5) {
+        std::cerr << "Usage: unrealsdk_binding_generator <snapshot> <output header> <namespace> "
+                     "<struct path>...\n";
+        return 1;
+    }
+
+    try {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const Snapshot snapshot{argv[1]};
+        Generator generator{snapshot, argv[3]};
+
+        for (int i = 4; i < argc; i++) {
+            const auto* ustruct = snapshot.find_struct(argv[i]);
+            if (ustruct == nullptr) {
+                std::cerr << "Couldn't find struct " << argv[i] << "\n";
+                return 1;
+            }
+            generator.add_struct(*ustruct);
+        }
+
+        std::ofstream output{argv[2]};
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (!output) {
+            std::cerr << "Failed to open output file\n";
+            return 1;
+        }
+        generator.write(output);
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "Failed to generate bindings: " << ex.what() << "\n";
+        return 1;
+    }
+}
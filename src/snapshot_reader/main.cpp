@@ -0,0 +1,153 @@
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "snapshot_reader/snapshot_reader.h"
+
+/*
+Reflection snapshot inspector.
+
+Opens a snapshot written by `unrealsdk::snapshot::dump`, and either prints a summary of what it
+contains, or the full layout of a single struct - including inherited properties. Doesn't depend on
+the rest of the sdk, so it builds on any platform.
+
+Usage:
+    unrealsdk_snapshot_inspector <snapshot> [struct path]
+*/
+
+using namespace unrealsdk::snapshot;
+
+namespace {
+
+/**
+ * @brief Gets a human readable name for a struct kind.
+ *
+ * @param kind The kind.
+ * @return The kind's name.
+ */
+std::string_view kind_name(format::StructKind kind) {
+    switch (kind) {
+        case format::StructKind::STRUCT:
+            return "struct";
+        case format::StructKind::SCRIPT_STRUCT:
+            return "script struct";
+        case format::StructKind::CLASS:
+            return "class";
+        case format::StructKind::FUNCTION:
+            return "function";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief Gets a struct by index, checking it's in bounds.
+ *
+ * @param snapshot The snapshot to read from.
+ * @param idx The struct's index.
+ * @return A pointer to the struct, or nullptr if the index is NONE or out of bounds.
+ */
+const format::Struct* struct_at(const Snapshot& snapshot, uint32_t idx) {
+    auto structs = snapshot.structs();
+    return idx < structs.size() ? &structs[idx] : nullptr;
+}
+
+/**
+ * @brief Prints a summary of a snapshot.
+ *
+ * @param snapshot The snapshot to print.
+ */
+void print_summary(const Snapshot& snapshot) {
+    size_t classes = 0;
+    size_t functions = 0;
+    for (const auto& ustruct : snapshot.structs()) {
+        if (ustruct.kind == format::StructKind::CLASS) {
+            classes++;
+        } else if (ustruct.kind == format::StructKind::FUNCTION) {
+            functions++;
+        }
+    }
+
+    std::cout << "pointer size: " << snapshot.header().pointer_size << "\n"
+              << "names:        " << snapshot.names().size() << "\n"
+              << "structs:      " << snapshot.structs().size() << " (" << classes << " classes, "
+              << functions << " functions)\n"
+              << "properties:   " << snapshot.properties().size() << "\n"
+              << "enums:        " << snapshot.enums().size() << " ("
+              << snapshot.enum_values().size() << " values)\n";
+}
+
+/**
+ * @brief Prints the layout of a single struct.
+ *
+ * @param snapshot The snapshot to read from.
+ * @param path The path name of the struct to print.
+ * @return True if the struct was found.
+ */
+bool print_struct(const Snapshot& snapshot, std::string_view path) {
+    const auto* ustruct = snapshot.find_struct(path);
+    if (ustruct == nullptr) {
+        std::cerr << "Couldn't find struct " << path << "\n";
+        return false;
+    }
+
+    std::cout << kind_name(ustruct->kind) << " " << snapshot.string(ustruct->path) << "\n"
+              << "size: 0x" << std::hex << ustruct->size << std::dec << "\n";
+
+    // Gather the chain from the base struct up, so properties print in offset order
+    std::vector<const format::Struct*> chain{};
+    for (const auto* current = ustruct; current != nullptr;
+         current = struct_at(snapshot, current->super)) {
+        // Guard against a corrupt file looping forever
+        if (chain.size() > snapshot.structs().size()) {
+            throw std::runtime_error("Struct has a circular super chain");
+        }
+        chain.insert(chain.begin(), current);
+    }
+
+    for (const auto* current : chain) {
+        std::cout << "\n// " << snapshot.name(current->name) << "\n";
+        for (const auto& prop : snapshot.properties_of(*current)) {
+            std::cout << "0x" << std::hex << std::setw(4) << std::setfill('0') << prop.offset
+                      << std::dec << std::setfill(' ') << "  " << std::left << std::setw(24)
+                      << snapshot.name(prop.type) << std::right << " " << snapshot.name(prop.name);
+            if (prop.array_dim > 1) {
+                std::cout << "[" << prop.array_dim << "]";
+            }
+            if (const auto* ref = struct_at(snapshot, prop.struct_ref); ref != nullptr) {
+                std::cout << " -> " << snapshot.name(ref->name);
+            } else if (prop.enum_ref < snapshot.enums().size()) {
+                std::cout << " -> " << snapshot.name(snapshot.enums()[prop.enum_ref].name);
+            }
+            std::cout << "\n";
+        }
+    }
+
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: unrealsdk_snapshot_inspector <snapshot> [struct path]\n";
+        return 1;
+    }
+
+    try {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const Snapshot snapshot{argv[1]};
+        if (argc == 3) {
+            return print_struct(snapshot, argv[2]) ? 0 : 1;
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        print_summary(snapshot);
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "Failed to read snapshot: " << ex.what() << "\n";
+        return 1;
+    }
+}
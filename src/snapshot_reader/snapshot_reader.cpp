@@ -0,0 +1,220 @@
+#include "snapshot_reader/snapshot_reader.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace unrealsdk::snapshot {
+
+namespace {
+
+/**
+ * @brief Checks that a section fits within the file, and is properly aligned.
+ * @note Throws a runtime error if invalid.
+ *
+ * @param section The section to check.
+ * @param record_size The size of each of the section's records.
+ * @param file_size The size of the file.
+ * @param name The name of the section, used in error messages.
+ */
+void validate_section(const format::Section& section,
+                      size_t record_size,
+                      size_t file_size,
+                      std::string_view name) {
+    if (section.offset % format::SECTION_ALIGNMENT != 0) {
+        throw std::runtime_error("Snapshot " + std::string{name} + " section is misaligned");
+    }
+    if (section.offset > file_size || section.count > (file_size - section.offset) / record_size) {
+        throw std::runtime_error("Snapshot " + std::string{name} + " section is out of bounds");
+    }
+}
+
+/**
+ * @brief Gets a sub range of a section, checking it's in bounds.
+ *
+ * @tparam T The type of the records.
+ * @param records The full section.
+ * @param first The index of the first record.
+ * @param count The number of records.
+ * @return The sub range.
+ */
+template <typename T>
+std::span<const T> checked_subspan(std::span<const T> records, uint32_t first, uint32_t count) {
+    if (first > records.size() || count > records.size() - first) {
+        throw std::out_of_range("Snapshot record range out of bounds");
+    }
+    return records.subspan(first, count);
+}
+
+}  // namespace
+
+Snapshot::Snapshot(const std::filesystem::path& path) {
+#ifdef _WIN32
+    this->file_handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (this->file_handle == INVALID_HANDLE_VALUE) {
+        this->file_handle = nullptr;
+        throw std::runtime_error("Failed to open " + path.string());
+    }
+
+    LARGE_INTEGER file_size{};
+    if (GetFileSizeEx(this->file_handle, &file_size) == 0) {
+        this->close();
+        throw std::runtime_error("Failed to get size of " + path.string());
+    }
+    this->size = static_cast<size_t>(file_size.QuadPart);
+
+    if (this->size > 0) {
+        this->mapping_handle =
+            CreateFileMappingW(this->file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (this->mapping_handle == nullptr) {
+            this->close();
+            throw std::runtime_error("Failed to map " + path.string());
+        }
+        this->data = static_cast<const uint8_t*>(
+            MapViewOfFile(this->mapping_handle, FILE_MAP_READ, 0, 0, 0));
+    }
+#else
+    this->file_descriptor = open(path.c_str(), O_RDONLY);
+    if (this->file_descriptor < 0) {
+        throw std::runtime_error("Failed to open " + path.string());
+    }
+
+    struct stat info{};
+    if (fstat(this->file_descriptor, &info) != 0) {
+        this->close();
+        throw std::runtime_error("Failed to get size of " + path.string());
+    }
+    this->size = static_cast<size_t>(info.st_size);
+
+    if (this->size > 0) {
+        auto mapped = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, this->file_descriptor, 0);
+        this->data = mapped == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(mapped);
+    }
+#endif
+
+    if (this->data == nullptr || this->size < sizeof(format::Header)) {
+        this->close();
+        throw std::runtime_error(path.string() + " is too small to be a snapshot");
+    }
+
+    const auto& hdr = this->header();
+    if (hdr.magic != format::MAGIC) {
+        this->close();
+        throw std::runtime_error(path.string() + " is not a snapshot");
+    }
+    if (hdr.version != format::VERSION) {
+        auto version = hdr.version;
+        this->close();
+        throw std::runtime_error("Unsupported snapshot version " + std::to_string(version));
+    }
+
+    try {
+        validate_section(hdr.strings, sizeof(char), this->size, "strings");
+        validate_section(hdr.names, sizeof(format::StringRef), this->size, "names");
+        validate_section(hdr.structs, sizeof(format::Struct), this->size, "structs");
+        validate_section(hdr.properties, sizeof(format::Property), this->size, "properties");
+        validate_section(hdr.enums, sizeof(format::Enum), this->size, "enums");
+        validate_section(hdr.enum_values, sizeof(format::EnumValue), this->size, "enum values");
+    } catch (...) {
+        this->close();
+        throw;
+    }
+}
+
+Snapshot::~Snapshot() {
+    this->close();
+}
+
+void Snapshot::close(void) {
+#ifdef _WIN32
+    if (this->data != nullptr) {
+        UnmapViewOfFile(this->data);
+    }
+    if (this->mapping_handle != nullptr) {
+        CloseHandle(this->mapping_handle);
+    }
+    if (this->file_handle != nullptr) {
+        CloseHandle(this->file_handle);
+    }
+    this->mapping_handle = nullptr;
+    this->file_handle = nullptr;
+#else
+    if (this->data != nullptr) {
+        munmap(const_cast<uint8_t*>(this->data), this->size);
+    }
+    if (this->file_descriptor >= 0) {
+        ::close(this->file_descriptor);
+    }
+    this->file_descriptor = -1;
+#endif
+
+    this->data = nullptr;
+    this->size = 0;
+}
+
+const format::Header& Snapshot::header(void) const {
+    return *reinterpret_cast<const format::Header*>(this->data);
+}
+
+std::span<const format::StringRef> Snapshot::names(void) const {
+    return this->section<format::StringRef>(this->header().names);
+}
+std::span<const format::Struct> Snapshot::structs(void) const {
+    return this->section<format::Struct>(this->header().structs);
+}
+std::span<const format::Property> Snapshot::properties(void) const {
+    return this->section<format::Property>(this->header().properties);
+}
+std::span<const format::Enum> Snapshot::enums(void) const {
+    return this->section<format::Enum>(this->header().enums);
+}
+std::span<const format::EnumValue> Snapshot::enum_values(void) const {
+    return this->section<format::EnumValue>(this->header().enum_values);
+}
+
+std::string_view Snapshot::string(format::StringRef ref) const {
+    const auto& strings = this->header().strings;
+    if (ref.offset > strings.count || ref.size > strings.count - ref.offset) {
+        throw std::out_of_range("Snapshot string out of bounds");
+    }
+    return {reinterpret_cast<const char*>(this->data + strings.offset + ref.offset), ref.size};
+}
+
+std::string_view Snapshot::name(uint32_t idx) const {
+    auto names = this->names();
+    if (idx >= names.size()) {
+        throw std::out_of_range("Snapshot name index out of bounds");
+    }
+    return this->string(names[idx]);
+}
+
+std::span<const format::Property> Snapshot::properties_of(const format::Struct& ustruct) const {
+    return checked_subspan(this->properties(), ustruct.first_property, ustruct.num_properties);
+}
+
+std::span<const format::EnumValue> Snapshot::values_of(const format::Enum& uenum) const {
+    return checked_subspan(this->enum_values(), uenum.first_value, uenum.num_values);
+}
+
+const format::Struct* Snapshot::find_struct(std::string_view path) const {
+    auto structs = this->structs();
+    auto iter = std::ranges::find_if(
+        structs, [this, path](const format::Struct& ustruct) {
+            return this->string(ustruct.path) == path;
+        });
+    return iter == structs.end() ? nullptr : &*iter;
+}
+
+}  // namespace unrealsdk::snapshot
@@ -0,0 +1,123 @@
+#ifndef SNAPSHOT_READER_SNAPSHOT_READER_H
+#define SNAPSHOT_READER_SNAPSHOT_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+#include "unrealsdk/snapshot_format.h"
+
+namespace unrealsdk::snapshot {
+
+/**
+ * @brief A read only, memory mapped, reflection snapshot.
+ * @note Validates the header and section bounds on open, so all sections may then be used directly.
+ * @note Builds on both windows and posix platforms, without depending on the rest of the sdk.
+ */
+class Snapshot {
+   private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+#ifdef _WIN32
+    void* file_handle = nullptr;
+    void* mapping_handle = nullptr;
+#else
+    int file_descriptor = -1;
+#endif
+
+    /**
+     * @brief Gets a section as a span of records.
+     *
+     * @tparam T The type of the records.
+     * @param section The section to get.
+     * @return The section's records.
+     */
+    template <typename T>
+    [[nodiscard]] std::span<const T> section(const format::Section& section) const {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return {reinterpret_cast<const T*>(this->data + section.offset),
+                static_cast<size_t>(section.count)};
+    }
+
+    /**
+     * @brief Unmaps and closes the file, if open.
+     */
+    void close(void);
+
+   public:
+    /**
+     * @brief Opens a snapshot file.
+     * @note Throws a runtime error if the file can't be opened, or isn't a valid snapshot.
+     *
+     * @param path The file to open.
+     */
+    explicit Snapshot(const std::filesystem::path& path);
+    ~Snapshot();
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot(Snapshot&&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+    Snapshot& operator=(Snapshot&&) = delete;
+
+    /**
+     * @brief Gets the snapshot's header.
+     *
+     * @return The header.
+     */
+    [[nodiscard]] const format::Header& header(void) const;
+
+    /**
+     * @brief Gets the records in each section.
+     *
+     * @return A span of the section's records.
+     */
+    [[nodiscard]] std::span<const format::StringRef> names(void) const;
+    [[nodiscard]] std::span<const format::Struct> structs(void) const;
+    [[nodiscard]] std::span<const format::Property> properties(void) const;
+    [[nodiscard]] std::span<const format::Enum> enums(void) const;
+    [[nodiscard]] std::span<const format::EnumValue> enum_values(void) const;
+
+    /**
+     * @brief Gets a string.
+     * @note Throws an out of range error if the reference is invalid.
+     *
+     * @param ref The string reference, or the index of a name.
+     * @return A view into the strings section.
+     */
+    [[nodiscard]] std::string_view string(format::StringRef ref) const;
+    [[nodiscard]] std::string_view name(uint32_t idx) const;
+
+    /**
+     * @brief Gets a struct's own properties, not including any inherited ones.
+     * @note Throws an out of range error if the struct's property range is invalid.
+     *
+     * @param ustruct The struct to get the properties of.
+     * @return The struct's properties.
+     */
+    [[nodiscard]] std::span<const format::Property> properties_of(
+        const format::Struct& ustruct) const;
+
+    /**
+     * @brief Gets an enum's values.
+     * @note Throws an out of range error if the enum's value range is invalid.
+     *
+     * @param uenum The enum to get the values of.
+     * @return The enum's values.
+     */
+    [[nodiscard]] std::span<const format::EnumValue> values_of(const format::Enum& uenum) const;
+
+    /**
+     * @brief Finds a struct by it's full path name.
+     *
+     * @param path The path name to look for.
+     * @return A pointer to the struct, or nullptr if not found.
+     */
+    [[nodiscard]] const format::Struct* find_struct(std::string_view path) const;
+};
+
+}  // namespace unrealsdk::snapshot
+
+#endif /* SNAPSHOT_READER_SNAPSHOT_READER_H */
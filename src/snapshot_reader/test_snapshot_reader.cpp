@@ -0,0 +1,386 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "snapshot_reader/snapshot_reader.h"
+#include "tests/check.h"
+
+using namespace unrealsdk::snapshot;
+using unrealsdk::tests::check;
+using unrealsdk::tests::check_throws;
+
+namespace {
+
+/**
+ * @brief Builds a small synthetic snapshot in memory.
+ */
+struct SnapshotBuilder {
+    std::string strings;
+    std::vector<format::StringRef> names;
+    std::vector<format::Struct> structs;
+    std::vector<format::Property> properties;
+    std::vector<format::Enum> enums;
+    std::vector<format::EnumValue> enum_values;
+
+    /**
+     * @brief Adds a string to the strings section.
+     *
+     * @param str The string to add.
+     * @return A reference to it.
+     */
+    format::StringRef add_string(std::string_view str) {
+        format::StringRef ref{.offset = static_cast<uint32_t>(this->strings.size()),
+                              .size = static_cast<uint32_t>(str.size())};
+        this->strings += str;
+        return ref;
+    }
+
+    /**
+     * @brief Adds a name.
+     *
+     * @param str The name's string.
+     * @return The name's index.
+     */
+    uint32_t add_name(std::string_view str) {
+        this->names.push_back(this->add_string(str));
+        return static_cast<uint32_t>(this->names.size() - 1);
+    }
+
+    /**
+     * @brief Serializes the snapshot.
+     *
+     * @return The snapshot's bytes.
+     */
+    [[nodiscard]] std::vector<uint8_t> build(void) const {
+        std::vector<uint8_t> data(sizeof(format::Header));
+        format::Header hdr{.magic = format::MAGIC,
+                           .version = format::VERSION,
+                           .pointer_size = sizeof(void*),
+                           .reserved = 0,
+                           .strings = {},
+                           .names = {},
+                           .structs = {},
+                           .properties = {},
+                           .enums = {},
+                           .enum_values = {}};
+
+        auto append = [&data](format::Section& section, const void* records, size_t count,
+                              size_t record_size) {
+            data.resize((data.size() + format::SECTION_ALIGNMENT - 1)
+                        & ~(format::SECTION_ALIGNMENT - 1));
+            section = {.offset = data.size(), .count = count};
+            const auto* bytes = static_cast<const uint8_t*>(records);
+            data.insert(data.end(), bytes, bytes + (count * record_size));
+        };
+        append(hdr.strings, this->strings.data(), this->strings.size(), sizeof(char));
+        append(hdr.names, this->names.data(), this->names.size(), sizeof(format::StringRef));
+        append(hdr.structs, this->structs.data(), this->structs.size(), sizeof(format::Struct));
+        append(hdr.properties, this->properties.data(), this->properties.size(),
+               sizeof(format::Property));
+        append(hdr.enums, this->enums.data(), this->enums.size(), sizeof(format::Enum));
+        append(hdr.enum_values, this->enum_values.data(), this->enum_values.size(),
+               sizeof(format::EnumValue));
+
+        std::memcpy(data.data(), &hdr, sizeof(hdr));
+        return data;
+    }
+};
+
+/**
+ * @brief Gets a mutable reference to the header of a serialized snapshot.
+ *
+ * @param data The serialized snapshot.
+ * @return The header.
+ */
+format::Header& header_of(std::vector<uint8_t>& data) {
+    return *reinterpret_cast<format::Header*>(data.data());
+}
+
+/**
+ * @brief A snapshot written to a temporary file, which gets deleted when done.
+ */
+class TempSnapshot {
+   private:
+    std::filesystem::path path;
+
+   public:
+    TempSnapshot(const std::vector<uint8_t>& data) {
+        static size_t counter = 0;
+        this->path = std::filesystem::temp_directory_path()
+                     / ("unrealsdk_test_snapshot_" + std::to_string(counter++) + ".snap");
+        std::ofstream file{this->path, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+    }
+
+    TempSnapshot(const TempSnapshot&) = delete;
+    TempSnapshot(TempSnapshot&&) = delete;
+    TempSnapshot& operator=(const TempSnapshot&) = delete;
+    TempSnapshot& operator=(TempSnapshot&&) = delete;
+
+    ~TempSnapshot() {
+        std::error_code err{};
+        std::filesystem::remove(this->path, err);
+    }
+
+    [[nodiscard]] const std::filesystem::path& get(void) const { return this->path; }
+};
+
+/**
+ * @brief Creates a small but complete snapshot - a class with a super class, an enum, and a few
+ *        properties between them.
+ *
+ * @return The builder holding the snapshot.
+ */
+SnapshotBuilder make_valid(void) {
+    SnapshotBuilder builder{};
+
+    auto class_name = builder.add_name("Class");
+    auto int_prop = builder.add_name("IntProperty");
+    auto byte_prop = builder.add_name("ByteProperty");
+
+    auto base_path = builder.add_string("Engine.Pawn");
+    auto derived_path = builder.add_string("WillowGame.WillowPawn");
+    auto enum_path = builder.add_string("Engine.Actor.ENetRole");
+
+    const format::Struct base{.name = builder.add_name("Pawn"),
+                              .class_name = class_name,
+                              .path = base_path,
+                              .kind = format::StructKind::CLASS,
+                              .super = format::NONE,
+                              .outer = format::NONE,
+                              .first_property = 0,
+                              .num_properties = 1,
+                              .size = 0x100,
+                              .alignment = 0,
+                              .function_flags = 0};
+    const format::Struct derived{.name = builder.add_name("WillowPawn"),
+                                 .class_name = class_name,
+                                 .path = derived_path,
+                                 .kind = format::StructKind::CLASS,
+                                 .super = 0,
+                                 .outer = format::NONE,
+                                 .first_property = 1,
+                                 .num_properties = 2,
+                                 .size = 0x200,
+                                 .alignment = 0,
+                                 .function_flags = 0};
+    builder.structs = {base, derived};
+
+    auto make_prop = [](uint32_t name, uint32_t type, uint32_t owner, int32_t offset) {
+        return format::Property{.name = name,
+                                .type = type,
+                                .offset = offset,
+                                .element_size = 4,
+                                .array_dim = 1,
+                                .field_mask = 0,
+                                .flags = 0,
+                                .owner = owner,
+                                .struct_ref = format::NONE,
+                                .meta_ref = format::NONE,
+                                .enum_ref = format::NONE,
+                                .inner = format::NONE,
+                                .reserved = 0};
+    };
+    builder.properties = {
+        make_prop(builder.add_name("Health"), int_prop, 0, 0x80),
+        make_prop(builder.add_name("Shield"), int_prop, 1, 0x100),
+        make_prop(builder.add_name("Role"), byte_prop, 1, 0x104),
+    };
+    builder.properties.back().enum_ref = 0;
+
+    builder.enums = {{.name = builder.add_name("ENetRole"),
+                      .reserved = 0,
+                      .path = enum_path,
+                      .first_value = 0,
+                      .num_values = 2}};
+    builder.enum_values = {
+        {.name = builder.add_name("ROLE_None"), .reserved = 0, .value = 0},
+        {.name = builder.add_name("ROLE_Authority"), .reserved = 0, .value = 4},
+    };
+
+    return builder;
+}
+
+void test_valid(void) {
+    const TempSnapshot file{make_valid().build()};
+    const Snapshot snapshot{file.get()};
+
+    check(snapshot.header().pointer_size == sizeof(void*), "reads the header");
+    check(snapshot.structs().size() == 2, "reads the structs section");
+    check(snapshot.properties().size() == 3, "reads the properties section");
+    check(snapshot.enums().size() == 1, "reads the enums section");
+    check(snapshot.enum_values().size() == 2, "reads the enum values section");
+
+    check(snapshot.name(0) == "Class", "reads names");
+    check(snapshot.string(snapshot.structs()[1].path) == "WillowGame.WillowPawn", "reads strings");
+
+    const auto* derived = snapshot.find_struct("WillowGame.WillowPawn");
+    check(derived == &snapshot.structs()[1], "finds structs by path");
+    check(snapshot.find_struct("WillowGame.Missing") == nullptr, "doesn't find missing structs");
+
+    auto props = snapshot.properties_of(*derived);
+    check(props.size() == 2 && snapshot.name(props[0].name) == "Shield"
+              && snapshot.name(props[1].name) == "Role",
+          "gets a struct's own properties");
+    auto base_props = snapshot.properties_of(snapshot.structs()[derived->super]);
+    check(base_props.size() == 1 && snapshot.name(base_props[0].name) == "Health",
+          "gets the super's properties separately");
+
+    auto values = snapshot.values_of(snapshot.enums()[0]);
+    check(values.size() == 2 && snapshot.name(values[1].name) == "ROLE_Authority"
+              && values[1].value == 4,
+          "gets an enum's values");
+}
+
+void test_invalid_files(void) {
+    check_throws<std::runtime_error>(
+        []() { const Snapshot snapshot{"unrealsdk_test_snapshot_missing.snap"}; },
+        "throws on a missing file");
+
+    {
+        const TempSnapshot file{std::vector<uint8_t>{}};
+        check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                         "throws on an empty file");
+    }
+    {
+        auto data = make_valid().build();
+        data.resize(sizeof(format::Header) - 1);
+        const TempSnapshot file{data};
+        check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                         "throws on a file smaller than the header");
+    }
+    {
+        auto data = make_valid().build();
+        header_of(data).magic = 0;
+        const TempSnapshot file{data};
+        check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                         "throws on a bad magic");
+    }
+    {
+        auto data = make_valid().build();
+        header_of(data).version = format::VERSION + 1;
+        const TempSnapshot file{data};
+        check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                         "throws on an unsupported version");
+    }
+}
+
+void test_invalid_sections(void) {
+    auto check_section = [](format::Section format::Header::* section, std::string_view name) {
+        {
+            auto data = make_valid().build();
+            (header_of(data).*section).offset += 1;
+            const TempSnapshot file{data};
+            check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                             "throws on a misaligned " + std::string{name});
+        }
+        {
+            auto data = make_valid().build();
+            (header_of(data).*section).count += 0x1000;
+            const TempSnapshot file{data};
+            check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                             "throws on an overlong " + std::string{name});
+        }
+        {
+            auto data = make_valid().build();
+            (header_of(data).*section).offset =
+                (data.size() + format::SECTION_ALIGNMENT) & ~(format::SECTION_ALIGNMENT - 1);
+            const TempSnapshot file{data};
+            check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                             "throws on an out of bounds " + std::string{name});
+        }
+        {
+            // Large enough that a naive `offset + count * size` check would overflow
+            auto data = make_valid().build();
+            (header_of(data).*section).count = ~0ULL / 2;
+            const TempSnapshot file{data};
+            check_throws<std::runtime_error>([&file]() { const Snapshot snapshot{file.get()}; },
+                                             "throws on an overflowing " + std::string{name});
+        }
+    };
+
+    check_section(&format::Header::strings, "strings section");
+    check_section(&format::Header::names, "names section");
+    check_section(&format::Header::structs, "structs section");
+    check_section(&format::Header::properties, "properties section");
+    check_section(&format::Header::enums, "enums section");
+    check_section(&format::Header::enum_values, "enum values section");
+}
+
+void test_invalid_references(void) {
+    auto builder = make_valid();
+    auto strings_size = static_cast<uint32_t>(builder.strings.size());
+    auto names_size = static_cast<uint32_t>(builder.names.size());
+
+    // Add some extra structs and enums with bad ranges
+    auto bad_struct = builder.structs[0];
+    bad_struct.first_property = 2;
+    bad_struct.num_properties = 2;
+    builder.structs.push_back(bad_struct);
+    bad_struct.first_property = format::NONE;
+    bad_struct.num_properties = 2;
+    builder.structs.push_back(bad_struct);
+    bad_struct.first_property = 4;
+    bad_struct.num_properties = 0;
+    builder.structs.push_back(bad_struct);
+    bad_struct.first_property = 3;
+    bad_struct.num_properties = 0;
+    builder.structs.push_back(bad_struct);
+
+    auto bad_enum = builder.enums[0];
+    bad_enum.first_value = 1;
+    bad_enum.num_values = 2;
+    builder.enums.push_back(bad_enum);
+    bad_enum.first_value = format::NONE;
+    bad_enum.num_values = 1;
+    builder.enums.push_back(bad_enum);
+
+    const TempSnapshot file{builder.build()};
+    const Snapshot snapshot{file.get()};
+
+    check(snapshot.string({.offset = strings_size, .size = 0}).empty(),
+          "allows an empty string at the end of the strings section");
+    check_throws<std::out_of_range>(
+        [&]() { (void)snapshot.string({.offset = strings_size - 1, .size = 2}); },
+        "throws on a string running past the end of the section");
+    check_throws<std::out_of_range>(
+        [&]() { (void)snapshot.string({.offset = strings_size + 1, .size = 0}); },
+        "throws on a string starting past the end of the section");
+    check_throws<std::out_of_range>(
+        [&]() { (void)snapshot.string({.offset = 1, .size = format::NONE}); },
+        "throws on a string whose end overflows");
+    check_throws<std::out_of_range>([&]() { (void)snapshot.name(names_size); },
+                                    "throws on an out of bounds name index");
+    check_throws<std::out_of_range>([&]() { (void)snapshot.name(format::NONE); },
+                                    "throws on a NONE name index");
+
+    auto structs = snapshot.structs();
+    check_throws<std::out_of_range>([&]() { (void)snapshot.properties_of(structs[2]); },
+                                    "throws on a property range running past the end");
+    check_throws<std::out_of_range>([&]() { (void)snapshot.properties_of(structs[3]); },
+                                    "throws on a property range whose end overflows");
+    check_throws<std::out_of_range>([&]() { (void)snapshot.properties_of(structs[4]); },
+                                    "throws on an empty property range past the end");
+    check(snapshot.properties_of(structs[5]).empty(),
+          "allows an empty property range at the end");
+
+    auto enums = snapshot.enums();
+    check_throws<std::out_of_range>([&]() { (void)snapshot.values_of(enums[1]); },
+                                    "throws on a value range running past the end");
+    check_throws<std::out_of_range>([&]() { (void)snapshot.values_of(enums[2]); },
+                                    "throws on a value range whose end overflows");
+}
+
+}  // namespace
+
+int main(void) {
+    test_valid();
+    test_invalid_files();
+    test_invalid_sections();
+    test_invalid_references();
+    return unrealsdk::tests::finish();
+}
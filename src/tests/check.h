@@ -0,0 +1,76 @@
+#ifndef TESTS_CHECK_H
+#define TESTS_CHECK_H
+
+#include <exception>
+#include <iostream>
+#include <source_location>
+#include <string>
+#include <string_view>
+
+/*
+Minimal assertion helpers. The tests are small enough that they don't need a full framework - each
+one is a standalone executable, which runs every check, and exits with a non-zero code if any
+failed.
+*/
+
+namespace unrealsdk::tests {
+
+inline size_t failures = 0;
+
+/**
+ * @brief Checks a condition, reporting a failure if it's false.
+ *
+ * @param condition The condition to check.
+ * @param description A description of what's being checked.
+ * @param location The location of the check, filled in automatically.
+ */
+inline void check(bool condition,
+                  std::string_view description,
+                  std::source_location location = std::source_location::current()) {
+    if (!condition) {
+        failures++;
+        std::cerr << location.file_name() << ":" << location.line() << ": check failed: "
+                  << description << "\n";
+    }
+}
+
+/**
+ * @brief Checks that a function throws a specific exception type.
+ *
+ * @tparam Exception The exception type which should be thrown.
+ * @param func The function to run.
+ * @param description A description of what's being checked.
+ * @param location The location of the check, filled in automatically.
+ */
+template <typename Exception, typename Func>
+void check_throws(Func&& func,
+                  std::string_view description,
+                  std::source_location location = std::source_location::current()) {
+    try {
+        func();
+    } catch (const Exception&) {
+        return;
+    } catch (const std::exception& ex) {
+        check(false, std::string{description} + " (threw the wrong exception: " + ex.what() + ")",
+              location);
+        return;
+    }
+    check(false, std::string{description} + " (didn't throw)", location);
+}
+
+/**
+ * @brief Reports the overall result.
+ *
+ * @return The exit code to return from main.
+ */
+inline int finish(void) {
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace unrealsdk::tests
+
+#endif /* TESTS_CHECK_H */
@@ -0,0 +1,164 @@
+#include <string>
+#include <vector>
+
+#include "tests/check.h"
+#include "unrealsdk/ascii.h"
+
+using namespace unrealsdk::utils;
+using unrealsdk::tests::check;
+
+namespace {
+
+// Long enough to cover a couple of full vectors, plus a tail
+const constexpr size_t MAX_LEN = 40;
+// Written past the end of the output, to detect overruns
+const constexpr char SENTINEL = '#';
+
+/**
+ * @brief Creates an ascii string of the given length.
+ *
+ * @param len The length of the string.
+ * @return The string.
+ */
+std::string make_ascii(size_t len) {
+    std::string str{};
+    for (size_t i = 0; i < len; i++) {
+        str.push_back(static_cast<char>('a' + (i % 26)));
+    }
+    return str;
+}
+
+/**
+ * @brief Narrows a string, checking it converted the expected prefix.
+ *
+ * @param src The string to narrow.
+ * @param expected The expected number of converted chars.
+ * @return True if the expected prefix was converted, and nothing was written past the end.
+ */
+bool narrows_to(const std::u16string& src, size_t expected) {
+    std::string dest(src.size() + 1, SENTINEL);
+    if (narrow_ascii_prefix(src.data(), src.size(), dest.data()) != expected) {
+        return false;
+    }
+    for (size_t i = 0; i < expected; i++) {
+        if (dest[i] != static_cast<char>(src[i])) {
+            return false;
+        }
+    }
+    return dest.back() == SENTINEL;
+}
+
+/**
+ * @brief Widens a string, checking it converted the expected prefix.
+ *
+ * @param src The string to widen.
+ * @param expected The expected number of converted chars.
+ * @return True if the expected prefix was converted, and nothing was written past the end.
+ */
+bool widens_to(const std::string& src, size_t expected) {
+    std::u16string dest(src.size() + 1, SENTINEL);
+    if (widen_ascii_prefix(src.data(), src.size(), dest.data()) != expected) {
+        return false;
+    }
+    for (size_t i = 0; i < expected; i++) {
+        if (dest[i] != static_cast<char16_t>(src[i])) {
+            return false;
+        }
+    }
+    return dest.back() == SENTINEL;
+}
+
+void test_all_ascii(void) {
+    bool narrow_ok = true;
+    bool widen_ok = true;
+    for (size_t len = 0; len <= MAX_LEN; len++) {
+        auto str = make_ascii(len);
+        narrow_ok &= narrows_to({str.begin(), str.end()}, len);
+        widen_ok &= widens_to(str, len);
+    }
+    check(narrow_ok, "narrows all ascii strings of every length, either side of the vector size");
+    check(widen_ok, "widens all ascii strings of every length, either side of the vector size");
+
+    std::u16string boundary_narrow(16, u'\x7F');
+    check(narrows_to(boundary_narrow, 16), "narrows the highest ascii char");
+    std::string boundary_widen(16, '\x7F');
+    check(widens_to(boundary_widen, 16), "widens the highest ascii char");
+}
+
+void test_non_ascii_positions(void) {
+    // Move a single non-ascii char through every position, which covers it being the first/last
+    // char of a vector, right on the 16 char boundary, and in the scalar tail
+    bool narrow_ok = true;
+    bool widen_ok = true;
+    for (size_t len = 1; len <= MAX_LEN; len++) {
+        for (size_t pos = 0; pos < len; pos++) {
+            auto str = make_ascii(len);
+            std::u16string wide{str.begin(), str.end()};
+
+            wide[pos] = u'\xE9';
+            narrow_ok &= narrows_to(wide, pos);
+
+            str[pos] = '\xC3';
+            widen_ok &= widens_to(str, pos);
+        }
+    }
+    check(narrow_ok, "narrowing stops at a non-ascii char in any position");
+    check(widen_ok, "widening stops at a non-ascii char in any position");
+
+    // A 20 char string is one full vector plus a 4 char tail
+    auto str = make_ascii(20);
+    std::u16string wide{str.begin(), str.end()};
+    wide[18] = u'\x80';
+    check(narrows_to(wide, 18), "narrowing stops at a non-ascii char in the vector tail");
+    str[18] = '\x80';
+    check(widens_to(str, 18), "widening stops at a non-ascii char in the vector tail");
+}
+
+void test_narrow_high_bytes(void) {
+    // These would survive a saturating pack, or truncation, if we only checked the high byte or
+    // only the low byte
+    for (auto chr : {u'\x80', u'\xFF', u'\x100', u'\x17F', u'\xFF7F'}) {
+        auto str = make_ascii(MAX_LEN);
+        std::u16string wide{str.begin(), str.end()};
+        wide[3] = chr;
+        check(narrows_to(wide, 3), "narrowing stops at a char outside of ascii in a vector");
+        wide[3] = u'a';
+        wide[MAX_LEN - 1] = chr;
+        check(narrows_to(wide, MAX_LEN - 1),
+              "narrowing stops at a char outside of ascii in a tail");
+    }
+}
+
+void test_multi_unit_chars(void) {
+    auto prefix = make_ascii(16);
+    std::u16string wide_prefix{prefix.begin(), prefix.end()};
+
+    // U+1F600, as a utf-16 surrogate pair, and as utf-8
+    const std::u16string surrogate_pair = u"\xD83D\xDE00";
+    const std::string utf8_emoji = "\xF0\x9F\x98\x80";
+
+    check(narrows_to(u"ab" + surrogate_pair + u"cd", 2),
+          "narrowing stops at a surrogate pair in the tail");
+    check(narrows_to(wide_prefix + surrogate_pair + wide_prefix, 16),
+          "narrowing stops at a surrogate pair right on the vector boundary");
+    check(narrows_to(wide_prefix.substr(0, 15) + surrogate_pair + wide_prefix, 15),
+          "narrowing stops at a surrogate pair straddling the vector boundary");
+    check(narrows_to(u"\xDE00" + wide_prefix, 0), "narrowing stops at a lone low surrogate");
+
+    check(widens_to("ab" + utf8_emoji + "cd", 2),
+          "widening stops at a multi byte utf-8 char in the tail");
+    check(widens_to(prefix + utf8_emoji + prefix, 16),
+          "widening stops at a multi byte utf-8 char right on the vector boundary");
+    check(widens_to(prefix.substr(0, 14) + utf8_emoji + prefix, 14),
+          "widening stops at a multi byte utf-8 char straddling the vector boundary");
+}
+
+}  // namespace
+
+int main(void) {
+    test_all_ascii();
+    test_non_ascii_positions();
+    test_narrow_high_bytes();
+    test_multi_unit_chars();
+    return unrealsdk::tests::finish();
+}
@@ -0,0 +1,189 @@
+#include "tests/check.h"
+#include "unrealsdk/pattern_search.h"
+
+using namespace unrealsdk::memory;
+using unrealsdk::tests::check;
+
+namespace {
+
+/**
+ * @brief Owns the storage behind a patch spec.
+ */
+struct TestPatch {
+    std::vector<uint8_t> bytes;
+    std::vector<uint8_t> mask;
+    PatternSearchInfo search;
+    std::vector<uint8_t> replacement;
+
+    /**
+     * @brief Creates a new test patch.
+     * @note Mask bytes of 0 are wildcards, bytes are masked automatically.
+     *
+     * @param bytes The bytes to search for.
+     * @param mask The mask over the bytes. If empty, matches every byte exactly.
+     */
+    TestPatch(std::vector<uint8_t> bytes, std::vector<uint8_t> mask = {})
+        : bytes(std::move(bytes)), mask(std::move(mask)), replacement{0x90} {
+        if (this->mask.empty()) {
+            this->mask.assign(this->bytes.size(), 0xFF);
+        }
+        for (size_t i = 0; i < this->bytes.size(); i++) {
+            this->bytes[i] &= this->mask[i];
+        }
+        this->search = {this->bytes.data(), this->mask.data(), this->bytes.size()};
+    }
+
+    /**
+     * @brief Gets a spec pointing at this patch.
+     *
+     * @param offset The offset to write the replacement at.
+     * @return The spec.
+     */
+    [[nodiscard]] PatchSpec spec(ptrdiff_t offset = 0) const {
+        return {"test",       this->bytes.data(), this->mask.data(), this->bytes.size(),
+                &this->search, this->replacement,  offset};
+    }
+};
+
+/**
+ * @brief Finds a set of patches in a buffer, and converts the results to offsets into it.
+ *
+ * @param patches The patches to find.
+ * @param buffer The buffer to search.
+ * @return The offset of each result, or -1 if not found.
+ */
+std::vector<ptrdiff_t> find_in(const std::vector<PatchSpec>& patches,
+                               const std::vector<uint8_t>& buffer) {
+    auto start = reinterpret_cast<uintptr_t>(buffer.data());
+    std::vector<ptrdiff_t> offsets{};
+    for (auto addr : find_patches(patches, start, buffer.size())) {
+        offsets.push_back(addr == 0 ? -1 : static_cast<ptrdiff_t>(addr - start));
+    }
+    return offsets;
+}
+
+/**
+ * @brief Finds a single pattern in a buffer, and converts the result to an offset into it.
+ *
+ * @param patch The pattern to find.
+ * @param buffer The buffer to search.
+ * @return The offset of the result, or -1 if not found.
+ */
+ptrdiff_t find_in(const TestPatch& patch, const std::vector<uint8_t>& buffer) {
+    auto start = reinterpret_cast<uintptr_t>(buffer.data());
+    auto addr = find_pattern(patch.bytes.data(), patch.mask.data(), patch.bytes.size(),
+                             patch.search, start, buffer.size());
+    return addr == 0 ? -1 : static_cast<ptrdiff_t>(addr - start);
+}
+
+void test_find_pattern(void) {
+    const std::vector<uint8_t> buffer{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                      0x88, 0x99, 0xAA, 0xBB, 0x22, 0x33, 0xCC, 0xDD};
+
+    check(find_in(TestPatch{{0x22, 0x33, 0x44}}, buffer) == 2, "finds a pattern");
+    check(find_in(TestPatch{{0x00, 0x11}}, buffer) == 0, "finds a pattern at the start");
+    check(find_in(TestPatch{{0xCC, 0xDD}}, buffer) == 14, "finds a pattern at the end");
+    check(find_in(TestPatch{{0x22, 0x33}}, buffer) == 2, "finds the first of several matches");
+    check(find_in(TestPatch{{0x12, 0x34}}, buffer) == -1, "doesn't find a missing pattern");
+    check(find_in(TestPatch{{0xCC, 0xDD, 0xEE}}, buffer) == -1,
+          "doesn't find a pattern running past the end");
+    check(find_in(TestPatch{{0x44, 0x00, 0x66}, {0xFF, 0x00, 0xFF}}, buffer) == 4,
+          "matches full wildcards");
+    check(find_in(TestPatch{{0xA0, 0xBB}, {0xF0, 0xFF}}, buffer) == 10,
+          "matches partial wildcards");
+    check(find_in(TestPatch{{0x00, 0x00}, {0x00, 0x00}}, buffer) == 0,
+          "matches all wildcards immediately");
+    check(find_in(TestPatch{{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}}, {0x00, 0x11}) == -1,
+          "doesn't match all wildcards when they're larger than the range");
+}
+
+void test_find_patches(void) {
+    const std::vector<uint8_t> buffer{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                      0x88, 0x99, 0xAA, 0xBB, 0x22, 0x33, 0xCC, 0xDD};
+
+    const TestPatch first{{0x22, 0x33, 0x44}};
+    const TestPatch overlapping{{0x33, 0x44, 0x55, 0x66}};
+    const TestPatch at_start{{0x00, 0x11}};
+    const TestPatch at_end{{0xCC, 0xDD}};
+    const TestPatch missing{{0x12, 0x34}};
+    const TestPatch past_end{{0xCC, 0xDD, 0xEE}};
+    const TestPatch repeated{{0x22, 0x33}};
+    const TestPatch wildcard{{0x44, 0x00, 0x66}, {0xFF, 0x00, 0xFF}};
+    const TestPatch partial_wildcard{{0xA0, 0xBB}, {0xF0, 0xFF}};
+    const TestPatch all_wildcards{{0x00, 0x00}, {0x00, 0x00}};
+
+    auto offsets = find_in({first.spec(), overlapping.spec(), at_start.spec(), at_end.spec(),
+                            missing.spec(), past_end.spec(), repeated.spec(), wildcard.spec(),
+                            partial_wildcard.spec(), all_wildcards.spec(3)},
+                           buffer);
+
+    check(offsets[0] == 2, "finds a pattern");
+    check(offsets[1] == 3, "finds a pattern overlapping another");
+    check(offsets[2] == 0, "finds a pattern at the start of the range");
+    check(offsets[3] == 14, "finds a pattern at the end of the range");
+    check(offsets[4] == -1, "doesn't find a missing pattern");
+    check(offsets[5] == -1, "doesn't find a pattern running past the end of the range");
+    check(offsets[6] == 2, "finds the first of several matches");
+    check(offsets[7] == 4, "matches full wildcards");
+    check(offsets[8] == 10, "matches partial wildcards");
+    check(offsets[9] == 3, "matches all wildcards immediately, respecting the offset");
+}
+
+void test_find_patches_offset(void) {
+    const std::vector<uint8_t> buffer{0x00, 0x11, 0x22, 0x33};
+    const TestPatch patch{{0x11, 0x22}};
+
+    auto offsets = find_in({patch.spec(2), patch.spec(-1)}, buffer);
+    check(offsets[0] == 3, "applies a positive offset");
+    check(offsets[1] == 0, "applies a negative offset");
+}
+
+void test_find_patches_too_large(void) {
+    const std::vector<uint8_t> buffer{0x00, 0x11};
+    const TestPatch patch{{0x00, 0x11, 0x22}};
+    const TestPatch all_wildcards{{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}};
+
+    auto offsets = find_in({patch.spec(), all_wildcards.spec()}, buffer);
+    check(offsets[0] == -1, "doesn't find a pattern larger than the range");
+    check(offsets[1] == -1, "doesn't match all wildcards when they're larger than the range");
+}
+
+void test_find_patches_empty(void) {
+    const std::vector<uint8_t> buffer{0x00, 0x11};
+    check(find_in({}, buffer).empty(), "handles no patches");
+}
+
+void test_group_by_page(void) {
+    const constexpr size_t page_size = 0x1000;
+
+    using ranges = std::vector<std::pair<uintptr_t, size_t>>;
+
+    check(group_by_page(ranges{{0x1010, 4}}, page_size) == std::vector<uintptr_t>{0x1000},
+          "maps a range to it's page");
+    check(group_by_page(ranges{{0x1FFE, 4}}, page_size) == std::vector<uintptr_t>{0x1000, 0x2000},
+          "includes both pages of a range straddling a boundary");
+    check(group_by_page(ranges{{0x1FFC, 4}}, page_size) == std::vector<uintptr_t>{0x1000},
+          "doesn't include the next page for a range ending right at a boundary");
+    check(group_by_page(ranges{{0x2000, 4}}, page_size) == std::vector<uintptr_t>{0x2000},
+          "doesn't include the previous page for a range starting right at a boundary");
+    check(group_by_page(ranges{{0x1800, 0x2000}}, page_size)
+              == std::vector<uintptr_t>{0x1000, 0x2000, 0x3000},
+          "includes every page of a range spanning several");
+    check(group_by_page(ranges{{0x3010, 4}, {0x1010, 4}, {0x1020, 4}, {0x1FFE, 4}}, page_size)
+              == std::vector<uintptr_t>{0x1000, 0x2000, 0x3000},
+          "sorts and deduplicates pages shared between ranges");
+    check(group_by_page(ranges{{0x1010, 0}}, page_size).empty(), "ignores empty ranges");
+    check(group_by_page(ranges{}, page_size).empty(), "handles no ranges");
+}
+
+}  // namespace
+
+int main(void) {
+    test_find_pattern();
+    test_find_patches();
+    test_find_patches_offset();
+    test_find_patches_too_large();
+    test_find_patches_empty();
+    test_group_by_page();
+    return unrealsdk::tests::finish();
+}
@@ -0,0 +1,50 @@
+#include <set>
+#include <string>
+
+#include "tests/check.h"
+#include "unrealsdk/pattern.h"
+
+using namespace unrealsdk::memory;
+using unrealsdk::tests::check;
+
+namespace {
+
+void test_registered_patterns(void) {
+    const auto& patterns = registered_patterns();
+
+    std::set<std::string> games{};
+    std::set<std::pair<std::string, std::string>> names{};
+    bool all_valid = true;
+    bool all_unique = true;
+    for (const auto& pattern : patterns) {
+        games.emplace(pattern.game);
+        all_unique &= names.emplace(pattern.game, pattern.name).second;
+        all_valid &= pattern.pattern_size > 0 && pattern.search != nullptr
+                     && pattern.search->search_size <= pattern.pattern_size;
+    }
+
+    check(games == std::set<std::string>{"bl1", "bl1e", "bl2", "bl3", "bl4", "tps"},
+          "registers the patterns of every game");
+    check(all_unique, "registers each pattern only once");
+    check(all_valid, "registers valid patterns");
+}
+
+void test_pattern_offset(void) {
+    const constexpr Pattern<4> no_offset{"AA BB CC DD"};
+    const constexpr Pattern<4> offset{"AA {BB} CC DD"};
+    const constexpr Pattern<4> explicit_offset{"AA {BB} CC DD", -2};
+
+    check(no_offset.offset == 0, "defaults to no offset");
+    check(offset.offset == 1, "sets the offset from a curly bracket");
+    check(explicit_offset.offset == -2, "prefers an explicitly given offset");
+    check(offset.bytes == std::array<uint8_t, 4>{0xAA, 0xBB, 0xCC, 0xDD},
+          "ignores curly brackets when parsing bytes");
+}
+
+}  // namespace
+
+int main(void) {
+    test_registered_patterns();
+    test_pattern_offset();
+    return unrealsdk::tests::finish();
+}
@@ -0,0 +1,238 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sigscan_validator/pe_image.h"
+#include "tests/check.h"
+
+using namespace unrealsdk::sigscan_validator;
+using unrealsdk::tests::check;
+using unrealsdk::tests::check_throws;
+
+namespace {
+
+const constexpr size_t NT_OFFSET = 0x40;
+const constexpr size_t FILE_HEADER_OFFSET = NT_OFFSET + 4;
+const constexpr size_t OPTIONAL_HEADER_OFFSET = FILE_HEADER_OFFSET + 20;
+const constexpr size_t OPTIONAL_HEADER_SIZE = 0xF0;
+const constexpr size_t SECTIONS_OFFSET = OPTIONAL_HEADER_OFFSET + OPTIONAL_HEADER_SIZE;
+const constexpr size_t SECTION_HEADER_SIZE = 40;
+
+const constexpr size_t HEADERS_SIZE = 0x200;
+const constexpr size_t IMAGE_SIZE = 0x3000;
+
+const constexpr size_t TEXT_RAW_OFFSET = 0x200;
+const constexpr size_t TEXT_RAW_SIZE = 0x20;
+const constexpr size_t TEXT_VIRTUAL_SIZE = 0x10;
+const constexpr size_t TEXT_RVA = 0x1000;
+const constexpr size_t DATA_RAW_OFFSET = 0x220;
+const constexpr size_t DATA_RAW_SIZE = 0x20;
+const constexpr size_t DATA_RVA = 0x2000;
+const constexpr size_t BSS_RVA = 0x2800;
+
+const constexpr uint64_t IMAGE_BASE_64 = 0x140000000;
+const constexpr uint64_t IMAGE_BASE_32 = 0x400000;
+
+/**
+ * @brief Writes a little endian value into a buffer.
+ *
+ * @tparam T The type of the value.
+ * @param data The buffer to write to.
+ * @param offset The offset to write at.
+ * @param value The value to write.
+ */
+template <typename T>
+void put(std::vector<uint8_t>& data, size_t offset, T value) {
+    std::memcpy(data.data() + offset, &value, sizeof(value));
+}
+
+/**
+ * @brief Writes a section header.
+ *
+ * @param data The buffer to write to.
+ * @param idx The index of the section.
+ * @param virtual_size The section's virtual size.
+ * @param rva The section's relative virtual address.
+ * @param raw_size The size of the section's raw data.
+ * @param raw_offset The file offset of the section's raw data.
+ */
+void put_section(std::vector<uint8_t>& data,
+                 size_t idx,
+                 uint32_t virtual_size,
+                 uint32_t rva,
+                 uint32_t raw_size,
+                 uint32_t raw_offset) {
+    auto offset = SECTIONS_OFFSET + (idx * SECTION_HEADER_SIZE);
+    put<uint32_t>(data, offset + 8, virtual_size);
+    put<uint32_t>(data, offset + 12, rva);
+    put<uint32_t>(data, offset + 16, raw_size);
+    put<uint32_t>(data, offset + 20, raw_offset);
+}
+
+/**
+ * @brief Creates a small PE file, with a code section, a data section, and a bss section.
+ * @note The code section's virtual size is smaller than it's raw size, and the data section's
+ *       virtual size is left empty.
+ *
+ * @param is_64 True to create a 64-bit PE file, false for a 32-bit one.
+ * @return The file's bytes.
+ */
+std::vector<uint8_t> make_pe(bool is_64) {
+    std::vector<uint8_t> data(DATA_RAW_OFFSET + DATA_RAW_SIZE);
+
+    put<uint16_t>(data, 0, 0x5A4D);
+    put<int32_t>(data, 0x3C, NT_OFFSET);
+    put<uint32_t>(data, NT_OFFSET, 0x00004550);
+
+    put<uint16_t>(data, FILE_HEADER_OFFSET + 2, 3);
+    put<uint16_t>(data, FILE_HEADER_OFFSET + 16, OPTIONAL_HEADER_SIZE);
+
+    if (is_64) {
+        put<uint16_t>(data, OPTIONAL_HEADER_OFFSET, 0x20B);
+        put<uint64_t>(data, OPTIONAL_HEADER_OFFSET + 24, IMAGE_BASE_64);
+    } else {
+        put<uint16_t>(data, OPTIONAL_HEADER_OFFSET, 0x10B);
+        put<uint32_t>(data, OPTIONAL_HEADER_OFFSET + 28, IMAGE_BASE_32);
+    }
+    put<uint32_t>(data, OPTIONAL_HEADER_OFFSET + 56, IMAGE_SIZE);
+    put<uint32_t>(data, OPTIONAL_HEADER_OFFSET + 60, HEADERS_SIZE);
+
+    put_section(data, 0, TEXT_VIRTUAL_SIZE, TEXT_RVA, TEXT_RAW_SIZE, TEXT_RAW_OFFSET);
+    put_section(data, 1, 0, DATA_RVA, DATA_RAW_SIZE, DATA_RAW_OFFSET);
+    put_section(data, 2, 0x100, BSS_RVA, 0, 0);
+
+    for (size_t i = 0; i < TEXT_RAW_SIZE; i++) {
+        data[TEXT_RAW_OFFSET + i] = static_cast<uint8_t>(0xC0 + i);
+    }
+    for (size_t i = 0; i < DATA_RAW_SIZE; i++) {
+        data[DATA_RAW_OFFSET + i] = static_cast<uint8_t>(0x80 + i);
+    }
+
+    return data;
+}
+
+/**
+ * @brief A file written to a temporary path, which gets deleted when done.
+ */
+class TempFile {
+   private:
+    std::filesystem::path path;
+
+   public:
+    TempFile(const std::vector<uint8_t>& data) {
+        static size_t counter = 0;
+        this->path = std::filesystem::temp_directory_path()
+                     / ("unrealsdk_test_pe_image_" + std::to_string(counter++) + ".exe");
+        std::ofstream file{this->path, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+    }
+
+    TempFile(const TempFile&) = delete;
+    TempFile(TempFile&&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+    TempFile& operator=(TempFile&&) = delete;
+
+    ~TempFile() {
+        std::error_code err{};
+        std::filesystem::remove(this->path, err);
+    }
+
+    [[nodiscard]] const std::filesystem::path& get(void) const { return this->path; }
+};
+
+/**
+ * @brief Checks that loading a modified PE file throws.
+ *
+ * @param modify A function which modifies a valid 64-bit PE file.
+ * @param description The description of the check.
+ */
+void check_invalid(const std::function<void(std::vector<uint8_t>&)>& modify,
+                   std::string_view description) {
+    auto data = make_pe(true);
+    modify(data);
+    const TempFile file{data};
+    check_throws<std::runtime_error>([&file]() { const PEImage image{file.get()}; },
+                                     description);
+}
+
+void test_layout(bool is_64) {
+    const TempFile file{make_pe(is_64)};
+    const PEImage image{file.get()};
+    const std::string bitness = is_64 ? " (64-bit)" : " (32-bit)";
+
+    auto [start, size] = image.range();
+    check(size == IMAGE_SIZE, "sizes the image from the optional header" + bitness);
+
+    const auto* bytes = reinterpret_cast<const uint8_t*>(start);
+    check(bytes[0] == 'M' && bytes[1] == 'Z', "copies the headers" + bitness);
+
+    bool text_ok = true;
+    for (size_t i = 0; i < TEXT_RAW_SIZE; i++) {
+        auto expected = i < TEXT_VIRTUAL_SIZE ? static_cast<uint8_t>(0xC0 + i) : 0;
+        text_ok &= bytes[TEXT_RVA + i] == expected;
+    }
+    check(text_ok, "copies sections, limited to their virtual size" + bitness);
+
+    bool data_ok = true;
+    for (size_t i = 0; i < DATA_RAW_SIZE; i++) {
+        data_ok &= bytes[DATA_RVA + i] == static_cast<uint8_t>(0x80 + i);
+    }
+    check(data_ok, "copies the full raw data of sections with no virtual size" + bitness);
+
+    bool bss_ok = true;
+    for (size_t i = 0; i < 0x100; i++) {
+        bss_ok &= bytes[BSS_RVA + i] == 0;
+    }
+    check(bss_ok, "leaves sections with no raw data zeroed" + bitness);
+
+    auto base = is_64 ? IMAGE_BASE_64 : IMAGE_BASE_32;
+    check(image.to_game_address(start) == base, "maps the image start to the image base" + bitness);
+    check(image.to_game_address(start + TEXT_RVA) == base + TEXT_RVA,
+          "maps addresses relative to the image base" + bitness);
+}
+
+void test_invalid(void) {
+    check_throws<std::runtime_error>(
+        []() { const PEImage image{"unrealsdk_test_pe_image_missing.exe"}; },
+        "throws on a missing file");
+
+    {
+        const TempFile file{std::vector<uint8_t>{}};
+        check_throws<std::runtime_error>([&file]() { const PEImage image{file.get()}; },
+                                         "throws on an empty file");
+    }
+
+    check_invalid([](auto& data) { data.resize(0x20); }, "throws on a truncated dos header");
+    check_invalid([](auto& data) { put<uint16_t>(data, 0, 0); }, "throws on a bad dos signature");
+    check_invalid([](auto& data) { put<int32_t>(data, 0x3C, -1); },
+                  "throws on a negative nt header offset");
+    check_invalid([](auto& data) { put<int32_t>(data, 0x3C, 0x7FFFFFFF); },
+                  "throws on an out of bounds nt header offset");
+    check_invalid([](auto& data) { put<uint32_t>(data, NT_OFFSET, 0); },
+                  "throws on a bad nt signature");
+    check_invalid([](auto& data) { put<uint16_t>(data, OPTIONAL_HEADER_OFFSET, 0x107); },
+                  "throws on an unknown optional header");
+    check_invalid([](auto& data) { put<uint16_t>(data, FILE_HEADER_OFFSET + 2, 0x100); },
+                  "throws on a section table running past the end of the file");
+    check_invalid([](auto& data) { put_section(data, 0, 0, TEXT_RVA, 0x1000, TEXT_RAW_OFFSET); },
+                  "throws on section data running past the end of the file");
+    check_invalid([](auto& data) { put_section(data, 0, 0, 0xFFFFFFF0, 0x20, TEXT_RAW_OFFSET); },
+                  "throws on a section outside of the image");
+    check_invalid(
+        [](auto& data) { put_section(data, 0, 0, IMAGE_SIZE - 0x10, 0x20, TEXT_RAW_OFFSET); },
+        "throws on a section running past the end of the image");
+}
+
+}  // namespace
+
+int main(void) {
+    test_layout(true);
+    test_layout(false);
+    test_invalid();
+    return unrealsdk::tests::finish();
+}
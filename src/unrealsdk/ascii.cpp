@@ -0,0 +1,101 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/ascii.h"
+
+#include <cstdint>
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UNREALSDK_ASCII_HAS_SSE2 1
+#else
+#define UNREALSDK_ASCII_HAS_SSE2 0
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+namespace unrealsdk::utils {
+
+namespace {
+
+#if UNREALSDK_ASCII_HAS_SSE2
+const constexpr size_t SSE2_BYTES = sizeof(__m128i);
+#endif
+
+}  // namespace
+
+size_t narrow_ascii_prefix(const char16_t* src, size_t len, char* dest) {
+    size_t idx = 0;
+
+#if UNREALSDK_ASCII_HAS_SSE2
+    const auto non_ascii_mask = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+    const auto zero = _mm_setzero_si128();
+
+    // Two vectors of wide chars pack into a single vector of chars
+    const constexpr size_t chars_per_step = SSE2_BYTES;
+    for (; idx + chars_per_step <= len; idx += chars_per_step) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx));
+        auto high =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx + (chars_per_step / 2)));
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        auto non_ascii = _mm_and_si128(_mm_or_si128(low, high), non_ascii_mask);
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, zero)) != 0xFFFF) {
+            break;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + idx), _mm_packus_epi16(low, high));
+    }
+#endif
+
+    for (; idx < len; idx++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto chr = src[idx];
+        if (chr > 0x7F) {
+            break;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        dest[idx] = static_cast<char>(chr);
+    }
+
+    return idx;
+}
+
+size_t widen_ascii_prefix(const char* src, size_t len, char16_t* dest) {
+    size_t idx = 0;
+
+#if UNREALSDK_ASCII_HAS_SSE2
+    const auto zero = _mm_setzero_si128();
+
+    // One vector of chars unpacks into two vectors of wide chars
+    const constexpr size_t chars_per_step = SSE2_BYTES;
+    for (; idx + chars_per_step <= len; idx += chars_per_step) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + idx));
+        if (_mm_movemask_epi8(chars) != 0) {
+            break;
+        }
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + idx), _mm_unpacklo_epi8(chars, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + idx + (chars_per_step / 2)),
+                         _mm_unpackhi_epi8(chars, zero));
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+#endif
+
+    for (; idx < len; idx++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto chr = static_cast<unsigned char>(src[idx]);
+        if (chr > 0x7F) {
+            break;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        dest[idx] = static_cast<char16_t>(chr);
+    }
+
+    return idx;
+}
+
+}  // namespace unrealsdk::utils
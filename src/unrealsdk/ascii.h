@@ -0,0 +1,40 @@
+#ifndef UNREALSDK_ASCII_H
+#define UNREALSDK_ASCII_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the ascii conversions can be built and tested on any platform.
+#include <cstddef>
+
+namespace unrealsdk::utils {
+
+/*
+Most strings we convert are pure ascii, where narrowing/widening is just truncating/zero-extending
+each char. We convert as much of the ascii prefix as we can directly, and only fall back to the
+full codecs for whatever's left after the first non-ascii char.
+
+These work on utf-16 `char16_t`s rather than `wchar_t`s, since `wchar_t` is only utf-16 on windows.
+*/
+
+/**
+ * @brief Narrows the ascii prefix of a utf-16 string.
+ *
+ * @param src The string to narrow.
+ * @param len The length of the string.
+ * @param dest The buffer to write to. Must be at least `len` chars long.
+ * @return The number of chars converted - i.e. the index of the first non-ascii char.
+ */
+size_t narrow_ascii_prefix(const char16_t* src, size_t len, char* dest);
+
+/**
+ * @brief Widens the ascii prefix of a utf-8 string.
+ *
+ * @param src The string to widen.
+ * @param len The length of the string.
+ * @param dest The buffer to write to. Must be at least `len` wide chars long.
+ * @return The number of chars converted - i.e. the index of the first non-ascii char.
+ */
+size_t widen_ascii_prefix(const char* src, size_t len, char16_t* dest);
+
+}  // namespace unrealsdk::utils
+
+#endif /* UNREALSDK_ASCII_H */
@@ -0,0 +1,205 @@
+#include "unrealsdk/pch.h"
+
+#include <bit>
+
+#include "unrealsdk/async_hooks.h"
+#include "unrealsdk/config.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::hook_manager::impl {
+
+namespace {
+
+const constexpr size_t DEFAULT_QUEUE_SIZE = 1024;
+const constexpr size_t DEFAULT_NUM_WORKERS = 1;
+const constexpr size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @brief A bounded lock-free multi-producer multi-consumer queue.
+ * @note Based on Dmitry Vyukov's bounded MPMC queue. Each cell holds a sequence number, which tells
+ *       producers and consumers if it's their turn to use it, so they only ever need to contend on
+ *       the enqueue/dequeue positions.
+ *
+ * @tparam T The type of item in the queue.
+ */
+template <typename T>
+class BoundedQueue {
+   private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos = 0;
+
+   public:
+    /**
+     * @brief Creates a new queue.
+     *
+     * @param capacity The minimum number of items the queue can hold. Rounded up to a power of two.
+     */
+    BoundedQueue(size_t capacity)
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        : cells(std::make_unique<Cell[]>(std::bit_ceil(std::max<size_t>(capacity, 2)))),
+          mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1) {
+        for (size_t i = 0; i <= this->mask; i++) {
+            this->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Tries pushing an item onto the queue.
+     *
+     * @param item The item to push. Only moved from if successful.
+     * @return True if pushed, false if the queue was full.
+     */
+    bool try_push(T&& item) {
+        auto pos = this->enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = this->cells[pos & this->mask];
+            auto seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (this->enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                            std::memory_order_relaxed)) {
+                    cell.data = std::move(item);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The consumer hasn't freed this cell yet, so we've wrapped around
+                return false;
+            } else {
+                pos = this->enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Tries popping an item off the queue.
+     *
+     * @param item Output variable, set to the popped item if successful.
+     * @return True if popped, false if the queue was empty.
+     */
+    bool try_pop(T& item) {
+        auto pos = this->dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = this->cells[pos & this->mask];
+            auto seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (this->dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                                            std::memory_order_relaxed)) {
+                    item = std::move(cell.data);
+                    cell.data = T{};
+                    cell.sequence.store(pos + this->mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The producer hasn't filled this cell yet
+                return false;
+            } else {
+                pos = this->dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+std::once_flag workers_started{};
+std::unique_ptr<BoundedQueue<AsyncJob>> queue{};
+
+// Incremented every time a job is queued, workers wait on this changing while the queue is empty
+std::atomic<uint32_t> jobs_signal = 0;
+std::atomic<size_t> sleeping_workers = 0;
+
+std::atomic<size_t> dropped_jobs = 0;
+
+thread_local bool is_worker = false;
+
+[[noreturn]] void worker_thread(void) {
+    SetThreadDescription(GetCurrentThread(), L"unrealsdk async hooks");
+    is_worker = true;
+
+    AsyncJob job{};
+    while (true) {
+        auto signal = jobs_signal.load();
+
+        while (queue->try_pop(job)) {
+            try {
+                job();
+            } catch (const std::exception& ex) {
+                LOG(ERROR, "An exception occurred during async hook processing: {}", ex.what());
+            }
+            job = nullptr;
+        }
+
+        // If a job was queued since we last checked, the signal will have changed, so this won't
+        // wait
+        sleeping_workers++;
+        jobs_signal.wait(signal);
+        sleeping_workers--;
+    }
+}
+
+/**
+ * @brief Creates the queue and starts all worker threads.
+ */
+void start_workers(void) {
+    auto queue_size = config::get_int("unrealsdk.async_hook_queue_size");
+    queue = std::make_unique<BoundedQueue<AsyncJob>>(
+        queue_size.has_value() && *queue_size > 0 ? static_cast<size_t>(*queue_size)
+                                                  : DEFAULT_QUEUE_SIZE);
+
+    size_t num_workers = DEFAULT_NUM_WORKERS;
+    auto configured_workers = config::get_int("unrealsdk.async_hook_threads");
+    if (configured_workers.has_value() && *configured_workers > 0) {
+        num_workers = static_cast<size_t>(*configured_workers);
+    }
+
+    for (size_t i = 0; i < num_workers; i++) {
+        std::thread(worker_thread).detach();
+    }
+}
+
+}  // namespace
+
+bool queue_async_job(AsyncJob&& job) {
+    std::call_once(workers_started, start_workers);
+
+    if (!queue->try_push(std::move(job))) {
+        // Only warn on the first drop, and then every time the count doubles, so that a stalled
+        // worker doesn't flood the log
+        auto dropped = ++dropped_jobs;
+        if (std::has_single_bit(dropped)) {
+            LOG(WARNING, "Async hook queue is full, dropped {} calls so far", dropped);
+        }
+        return false;
+    }
+
+    jobs_signal++;
+    if (sleeping_workers.load() > 0) {
+        jobs_signal.notify_one();
+    }
+    return true;
+}
+
+bool is_async_hook_thread(void) {
+    return is_worker;
+}
+
+void ensure_not_async_hook_thread(std::string_view action) {
+    if (is_worker) {
+        throw std::runtime_error(
+            std::format("Tried to {} from an async hook, these may not call back into unreal",
+                        action));
+    }
+}
+
+}  // namespace unrealsdk::hook_manager::impl
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef UNREALSDK_ASYNC_HOOKS_H
+#define UNREALSDK_ASYNC_HOOKS_H
+
+#include "unrealsdk/pch.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::hook_manager::impl {
+
+/// A job to run on the async hook workers.
+using AsyncJob = std::function<void(void)>;
+
+/**
+ * @brief Queues a job to run on the async hook workers.
+ * @note Starts the workers the first time it's called.
+ * @note Never blocks, if the queue is full the job is dropped instead.
+ *
+ * @param job The job to queue.
+ * @return True if the job was queued, false if it was dropped.
+ */
+bool queue_async_job(AsyncJob&& job);
+
+/**
+ * @brief Checks if the current thread is one of the async hook workers.
+ *
+ * @return True if on an async hook worker.
+ */
+[[nodiscard]] bool is_async_hook_thread(void);
+
+/**
+ * @brief Throws if the current thread is one of the async hook workers.
+ * @note Used to stop async hooks from calling back into unreal.
+ *
+ * @param action A description of what was attempted, used in the error message.
+ */
+void ensure_not_async_hook_thread(std::string_view action);
+
+}  // namespace unrealsdk::hook_manager::impl
+
+#endif
+
+#endif /* UNREALSDK_ASYNC_HOOKS_H */
@@ -25,6 +25,14 @@
 #define UNREALSDK_FIMPLEMENTEDINTERFACE_FORMAT_UE3 1
 #define UNREALSDK_FIMPLEMENTEDINTERFACE_FORMAT_UE4 2
 
+// Used with `UNREALSDK_STATIC_OFFSETS`, to bind all offsets to a single game at compile time
+#define UNREALSDK_GAME_BL1 1
+#define UNREALSDK_GAME_BL1E 2
+#define UNREALSDK_GAME_BL2 3
+#define UNREALSDK_GAME_TPS 4
+#define UNREALSDK_GAME_BL3 5
+#define UNREALSDK_GAME_BL4 6
+
 // =================================================================================================
 #if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW
 // =================================================================================================
@@ -47,6 +55,10 @@
 #define UNREALSDK_DEFAULT_POST_EDIT_CHANGE_CHAIN_PROPERTY_VF_IDX 18
 #define UNREALSDK_DEFAULT_POST_EDIT_CHANGE_PROPERTY_VF_IDX 19
 
+// BeginDestroy's index isn't consistent across UE3 games, so rather than using a default, the game
+// hooks find it by searching the object vftable for a sigscan pattern
+#define UNREALSDK_DEFAULT_BEGIN_DESTROY_VF_IDX (-1)
+
 // =================================================================================================
 #elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK
 // =================================================================================================
@@ -69,6 +81,10 @@
 #define UNREALSDK_DEFAULT_POST_EDIT_CHANGE_CHAIN_PROPERTY_VF_IDX 77
 #define UNREALSDK_DEFAULT_POST_EDIT_CHANGE_PROPERTY_VF_IDX 78
 
+// Stock UE4 layout - UObjectBase and UObjectBaseUtility contribute 7 entries, BeginDestroy is then
+// the 10th declared in UObject
+#define UNREALSDK_DEFAULT_BEGIN_DESTROY_VF_IDX 16
+
 // =================================================================================================
 #elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK2
 // =================================================================================================
@@ -91,12 +107,29 @@
 #define UNREALSDK_DEFAULT_POST_EDIT_CHANGE_CHAIN_PROPERTY_VF_IDX 77
 #define UNREALSDK_DEFAULT_POST_EDIT_CHANGE_PROPERTY_VF_IDX 78
 
+// UE5 added several overloads before BeginDestroy, and we haven't confirmed the final index yet
+#define UNREALSDK_DEFAULT_BEGIN_DESTROY_VF_IDX (-1)
+
 // =================================================================================================
 #else
 #error Unknown SDK flavour
 #endif
 // =================================================================================================
 
+#ifdef UNREALSDK_STATIC_OFFSETS
+#if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW           \
+    && !(UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1     \
+         || UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1E \
+         || UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL2  \
+         || UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_TPS)
+#error Static offsets game is not part of the Willow flavour
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK && UNREALSDK_STATIC_OFFSETS != UNREALSDK_GAME_BL3
+#error Static offsets game is not part of the Oak flavour
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK2 && UNREALSDK_STATIC_OFFSETS != UNREALSDK_GAME_BL4
+#error Static offsets game is not part of the Oak2 flavour
+#endif
+#endif
+
 // This strictly relies on the gobjects format, so defining here rather than having a copy for each
 #define UNREALSDK_HAS_NATIVE_WEAK_POINTERS \
     (UNREALSDK_GOBJECTS_FORMAT != 0        \
@@ -59,6 +59,17 @@ std::variant<const std::string_view, const std::wstring_view> AbstractHook::fnam
     throw_version_error("fname_get_str not implemented");
     unreachable();
 };
+size_t AbstractHook::fname_iterate(
+    size_t /*start*/,
+    const std::function<void(uint32_t)>& /*callback*/,
+    const std::function<void(uint32_t)>& /*empty_callback*/) const {
+    throw_version_error("fname_iterate not implemented");
+    unreachable();
+}
+bool AbstractHook::fname_is_filled(uint32_t /*idx*/) const {
+    throw_version_error("fname_is_filled not implemented");
+    unreachable();
+}
 void AbstractHook::fframe_step(unreal::FFrame* /*frame*/,
                                unreal::UObject* /*obj*/,
                                void* /*param*/) const {
@@ -76,6 +76,28 @@ struct AbstractHook {
     virtual void fname_init(unreal::FName* name, const wchar_t* str, uint32_t number) const;
     [[nodiscard]] virtual std::variant<const std::string_view, const std::wstring_view>
     fname_get_str(const unreal::FName& name) const;
+    /**
+     * @brief Iterates through the indexes of every name in the names table.
+     * @note Names are never removed, so resuming from the returned position only visits new ones.
+     * @note A slot may be empty either because it's unused, or because another thread has reserved
+     *       it but not yet written the name. Since we can't tell these apart, empty slots are
+     *       reported separately, so that they can be rechecked using `fname_is_filled` later.
+     *
+     * @param start The position to start iterating from, 0 for the start of the table.
+     * @param callback The callback to run on each name index.
+     * @param empty_callback The callback to run on the index of each empty slot.
+     * @return The position to resume iterating from next time.
+     */
+    virtual size_t fname_iterate(size_t start,
+                                 const std::function<void(uint32_t)>& callback,
+                                 const std::function<void(uint32_t)>& empty_callback) const;
+    /**
+     * @brief Checks if a slot previously reported as empty by `fname_iterate` now holds a name.
+     *
+     * @param idx The name index.
+     * @return True if the slot now holds a name.
+     */
+    [[nodiscard]] virtual bool fname_is_filled(uint32_t idx) const;
 
     virtual void fframe_step(unreal::FFrame* frame, unreal::UObject* obj, void* param) const;
     virtual void process_event(unreal::UObject* object,
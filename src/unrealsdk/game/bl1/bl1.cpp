@@ -1,6 +1,8 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl1/bl1.h"
 
+#include "unrealsdk/game/bl1/patterns.h"
+#include "unrealsdk/game/startup_graph.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/structs/fframe.h"
@@ -10,33 +12,46 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1::patterns;
 
 namespace unrealsdk::game {
 
 void BL1Hook::hook(void) {
-    wait_for_steam_drm();
+    StartupGraph graph{};
 
-    hook_antidebug();
+    // Nothing is valid until the exe's been unpacked, then antidebug should happen asap
+    graph.add("wait_for_steam_drm", wait_for_steam_drm)
+        .add("hook_antidebug", hook_antidebug, {"wait_for_steam_drm"});
 
-    hook_process_event();
-    hook_call_function();
+    graph.add("hook_process_event", hook_process_event, {"hook_antidebug"})
+        .add("hook_call_function", hook_call_function, {"hook_antidebug"});
 
-    find_gobjects();
-    find_gnames();
-    find_fname_init();
-    find_fframe_step();
-    find_gmalloc();
-    find_construct_object();
-    find_get_path_name();
-    find_static_find_object();
-    find_load_package();
+    graph.add("find_gobjects", find_gobjects, {"hook_antidebug"})
+        .add("find_gnames", find_gnames, {"hook_antidebug"})
+        .add("find_fname_init", find_fname_init, {"hook_antidebug"})
+        .add("find_fframe_step", find_fframe_step, {"hook_antidebug"})
+        .add("find_gmalloc", find_gmalloc, {"hook_antidebug"})
+        .add("find_get_path_name", find_get_path_name, {"hook_antidebug"});
 
-    hexedit_set_command();
-    hexedit_array_limit();
+    // Detours and hex edits both change page protections, and restore them afterwards. If they
+    // touch the same page at the same time, one may restore it to read only while the other is
+    // still writing, so keep them apart.
+    graph.add(
+        "hexedit", [this]() { this->hexedit(); }, {"hook_process_event", "hook_call_function"});
+
+    graph.run();
 }
 
 void BL1Hook::post_init(void) {
     inject_console();
+    hook_begin_destroy();
+
+    // These natives are resolved on first use, but may as well get them ready in the background
+    StartupGraph{}
+        .add("find_construct_object", find_construct_object)
+        .add("find_static_find_object", find_static_find_object)
+        .add("find_load_package", find_load_package)
+        .run_in_background();
 }
 
 #pragma region FFrame::Step
@@ -48,13 +63,6 @@ namespace {
 #pragma GCC diagnostic ignored "-Wattributes"  // thiscall on non-class
 #endif
 
-// FFrame::Step is inlined, so instead we manually re-implement it using GNatives.
-const constinit Pattern<11> GNATIVES_SIG{
-    "8B 14 95 {????????}"  // mov edx, [edx*4+01F942C0]
-    "57"                   // push edi
-    "8D 4D ??"             // lea ecx, [ebp-44]
-};
-
 // NOLINTNEXTLINE(modernize-use-using)
 typedef void(__thiscall* fframe_step_func)(UObject*, FFrame*, void*);
 fframe_step_func** fframe_step_gnatives;
@@ -85,29 +93,6 @@ namespace {
 #pragma GCC diagnostic ignored "-Wattributes"  // thiscall on non-class
 #endif
 
-const constinit Pattern<72> FNAME_INIT_SIG{
-    "6A FF"              // push -01
-    "68 ????????"        // push 018E73CB
-    "64 A1 ????????"     // mov eax, fs:[00000000]
-    "50"                 // push eax
-    "81 EC ????????"     // sub esp, 00000C98
-    "A1 ????????"        // mov eax, [01F131C0]
-    "33 C4"              // xor eax, esp
-    "89 84 24 ????????"  // mov [esp+00000C94], eax
-    "53"                 // push ebx
-    "55"                 // push ebp
-    "56"                 // push esi
-    "57"                 // push edi
-    "A1 ????????"        // mov eax, [01F131C0]
-    "33 C4"              // xor eax, esp
-    "50"                 // push eax
-    "8D 84 24 ????????"  // lea eax, [esp+00000CAC]
-    "64 A3 ????????"     // mov fs:[00000000], eax
-    "8B BC 24 ????????"  // mov edi, [esp+00000CBC]
-    "8B E9"              // mov ebp, ecx
-    "89 6C 24 ??"        // mov [esp+1C], ebp
-};
-
 // NOLINTNEXTLINE(modernize-use-using)
 typedef void(__thiscall* fname_init_func)(FName* name,
                                           const wchar_t* str,
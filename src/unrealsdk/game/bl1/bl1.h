@@ -5,6 +5,7 @@
 
 #include "unrealsdk/game/abstract_hook.h"
 #include "unrealsdk/game/selector.h"
+#include "unrealsdk/patch_set.h"
 
 #if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW && !defined(UNREALSDK_IMPORTING)
 
@@ -28,14 +29,13 @@ class BL1Hook : public AbstractHook {
     static void hook_antidebug(void);
 
     /**
-     * @brief Hex edits out the protection on the set command.
+     * @brief Hex edits out the protection on the set command, and the `obj dump` array limit and
+     *        it's message, as a single batch.
      */
-    static void hexedit_set_command(void);
+    void hexedit(void);
 
-    /**
-     * @brief Hex edits out the `obj dump` array limit.
-     */
-    static void hexedit_array_limit(void);
+    // All our hex edits, kept around so they may be reverted
+    memory::PatchSet hexedits{};
 
     /**
      * @brief Hooks `UObject::ProcessEvent` and points it at the hook manager.
@@ -47,6 +47,12 @@ class BL1Hook : public AbstractHook {
      */
     static void hook_call_function(void);
 
+    /**
+     * @brief Hooks `UObject::BeginDestroy` and points it at the gc tracking.
+     * @note Requires unrealsdk to be initialized, so must be called during post init.
+     */
+    static void hook_begin_destroy(void);
+
     /**
      * @brief Finds GObjects, and populates the wrapper member.
      */
@@ -69,6 +75,7 @@ class BL1Hook : public AbstractHook {
 
     /**
      * @brief Finds `StaticConstructObject`, and sets up such that `construct_object` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_construct_object(void);
 
@@ -79,11 +86,13 @@ class BL1Hook : public AbstractHook {
 
     /**
      * @brief Finds `StaticFindObject`, and sets up such that `find_object` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_static_find_object(void);
 
     /**
      * @brief Finds `LoadPackage`, and sets up such that `load_package` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_load_package(void);
 
@@ -115,6 +124,10 @@ class BL1Hook : public AbstractHook {
     void fname_init(unreal::FName* name, const wchar_t* str, uint32_t number) const override;
     [[nodiscard]] std::variant<const std::string_view, const std::wstring_view> fname_get_str(
         const unreal::FName& name) const override;
+    size_t fname_iterate(size_t start,
+                         const std::function<void(uint32_t)>& callback,
+                         const std::function<void(uint32_t)>& empty_callback) const override;
+    [[nodiscard]] bool fname_is_filled(uint32_t idx) const override;
     void fframe_step(unreal::FFrame* frame, unreal::UObject* obj, void* param) const override;
     void process_event(unreal::UObject* object,
                        unreal::UFunction* func,
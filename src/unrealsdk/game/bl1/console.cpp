@@ -5,6 +5,7 @@
 #include "unrealsdk/commands.h"
 #include "unrealsdk/config.h"
 #include "unrealsdk/hook_manager.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/classes/uobject_funcs.h"
 #include "unrealsdk/unreal/find_class.h"
@@ -190,6 +191,7 @@ bool inject_console_hook(const hook_manager::Details& hook) {
 }  // namespace
 
 void BL1Hook::inject_console(void) {
+    const profiling::ScopedTimer timer{"inject_console", "startup"};
     add_hook(SAY_BYPASS_FUNC, SAY_BYPASS_TYPE, SAY_BYPASS_ID, &say_bypass_hook);
 
     add_hook(CONSOLE_COMMAND_FUNC, CONSOLE_COMMAND_TYPE, CONSOLE_COMMAND_ID, &console_command_hook);
@@ -2,6 +2,7 @@
 
 #include "unrealsdk/game/bl1/bl1.h"
 #include "unrealsdk/game/bl1/offsets.h"
+#include "unrealsdk/game/bl1/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/wrappers/gobjects.h"
 
@@ -9,6 +10,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1::patterns;
 
 namespace unrealsdk::game {
 
@@ -16,14 +18,6 @@ namespace {
 
 GObjects gobjects_wrapper{};
 
-const constinit Pattern<18> GOBJECTS_SIG{
-    "8B 0D {????????}"  // mov ecx, [01FB4DD8]
-    "8B 04 ??"          // mov eax, [ecx+esi*4]
-    "8B 50 ??"          // mov edx, [eax+0C]
-    "21 58 ??"          // and [eax+08], ebx
-    "89 50 ??"          // mov [eax+0C], edx
-};
-
 }  // namespace
 
 void BL1Hook::find_gobjects(void) {
@@ -39,15 +33,6 @@ const GObjects& BL1Hook::gobjects(void) const {
 
 namespace {
 
-const constinit Pattern<21> GNAMES_SIG{
-    "A1 {????????}"  // mov eax, [01FB4DA8]
-    "8B 0C ??"       // mov ecx, [eax+esi*4]
-    "68 ????????"    // push 00001000
-    "6A ??"          // push 00
-    "E8 ????????"    // call 005C21F0
-    "5E"             // pop esi
-};
-
 TArray<bl1::FNameEntry*>* gnames_ptr;
 
 }  // namespace
@@ -66,6 +51,26 @@ void BL1Hook::find_gnames(void) {
     return std::string_view{&entry->Name.Ansi[0]};
 }
 
+size_t BL1Hook::fname_iterate(size_t start,
+                              const std::function<void(uint32_t)>& callback,
+                              const std::function<void(uint32_t)>& empty_callback) const {
+    auto count = gnames_ptr->size();
+    for (auto idx = start; idx < count; idx++) {
+        // Unused slots are left null - but so are slots which have been added to the array, and
+        // which are yet to have their entry written
+        if (gnames_ptr->at(idx) != nullptr) {
+            callback(static_cast<uint32_t>(idx));
+        } else {
+            empty_callback(static_cast<uint32_t>(idx));
+        }
+    }
+    return std::max(start, count);
+}
+
+bool BL1Hook::fname_is_filled(uint32_t idx) const {
+    return gnames_ptr->at(idx) != nullptr;
+}
+
 }  // namespace unrealsdk::game
 
 #endif
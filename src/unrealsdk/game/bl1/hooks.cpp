@@ -2,6 +2,8 @@
 
 #include "unrealsdk/game/bl1/bl1.h"
 
+#include "unrealsdk/game/bl1/patterns.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/locks.h"
 #include "unrealsdk/memory.h"
@@ -13,6 +15,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1::patterns;
 
 namespace unrealsdk::game {
 
@@ -26,19 +29,6 @@ typedef void(__fastcall* process_event_func)(UObject* obj,
                                              void* /*null*/);
 process_event_func process_event_ptr;
 
-const constinit Pattern<30> PROCESS_EVENT_SIG{
-    "55"              // push ebp
-    "8B EC"           // mov ebp, esp
-    "6A FF"           // push -01
-    "68 ????????"     // push 018E55E8
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "83 EC 40"        // sub esp, 40
-    "A1 ????????"     // mov eax, [01F131C0]
-    "33 C5"           // xor eax, ebp
-    "89 45 ??"        // mov [ebp-10], eax
-};
-
 void __fastcall process_event_hook(UObject* obj,
                                    void* edx,
                                    UFunction* func,
@@ -82,6 +72,7 @@ void __fastcall process_event_hook(UObject* obj,
 
             if (!block_execution) {
                 run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL, hook);
@@ -131,17 +122,6 @@ typedef void(__fastcall* call_function_func)(UObject* obj,
                                              UFunction* func);
 call_function_func call_function_ptr;
 
-const constinit Pattern<31> CALL_FUNCTION_SIG{
-    "55"                 // push ebp
-    "8D AC 24 ????????"  // lea ebp, [esp-00000404]
-    "81 EC ????????"     // sub esp, 00000404
-    "6A FF"              // push -01
-    "68 ????????"        // push 018E55B8
-    "64 A1 ????????"     // mov eax, fs:[00000000]
-    "50"                 // push eax
-    "83 EC 40"           // sub esp, 40
-};
-
 void __fastcall call_function_hook(UObject* obj,
                                    void* edx,
                                    FFrame* stack,
@@ -184,6 +164,7 @@ void __fastcall call_function_hook(UObject* obj,
 
             if (!block_execution) {
                 run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL, hook);
@@ -217,6 +198,34 @@ void BL1Hook::hook_call_function(void) {
            &call_function_ptr, "CallFunction");
 }
 
+namespace {
+
+// NOLINTNEXTLINE(modernize-use-using)
+typedef void(__fastcall* begin_destroy_func)(UObject* obj, void* /*edx*/);
+begin_destroy_func begin_destroy_ptr;
+
+void __fastcall begin_destroy_hook(UObject* obj, void* edx) {
+    try {
+        gc::impl::object_destroyed(obj);
+    } catch (const std::exception& ex) {
+        LOG(ERROR, "An exception occurred during the BeginDestroy hook: {}", ex.what());
+    }
+
+    begin_destroy_ptr(obj, edx);
+}
+
+static_assert(std::is_same_v<decltype(&begin_destroy_hook), begin_destroy_func>,
+              "begin_destroy signature is incorrect");
+
+}  // namespace
+
+void BL1Hook::hook_begin_destroy(void) {
+    auto addr = gc::impl::find_begin_destroy(BEGIN_DESTROY_SIG);
+    if (addr != 0 && detour(addr, begin_destroy_hook, &begin_destroy_ptr, "BeginDestroy")) {
+        gc::impl::start_tracking();
+    }
+}
+
 }  // namespace unrealsdk::game
 
 #endif
@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/game/bl1/bl1.h"
+#include "unrealsdk/game/bl1/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/alignment.h"
 
@@ -8,6 +9,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1::patterns;
 
 namespace unrealsdk::game {
 
@@ -35,11 +37,6 @@ struct FMalloc {
 
 FMalloc** gmalloc_ptr;
 
-const constinit Pattern<8> GMALLOC_PATTERN{
-    "89 0D {????????}"  // mov [01F703F4],ecx { (05AA6980) }
-    "8B 11"             // mov edx,[ecx]
-};
-
 }  // namespace
 
 void BL1Hook::find_gmalloc(void) {
@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/game/bl1/bl1.h"
+#include "unrealsdk/game/bl1/patterns.h"
 #include "unrealsdk/logging.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/structs/fstring.h"
@@ -10,6 +11,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl1::patterns;
 
 namespace unrealsdk::game {
 
@@ -26,32 +28,14 @@ typedef UObject*(__cdecl* construct_obj_func)(UClass* cls,
                                               void* error_output_device,
                                               void* instance_graph,
                                               uint32_t assume_template_is_archetype);
-construct_obj_func construct_obj_ptr;
-
-const constinit Pattern<47> CONSTRUCT_OBJECT_PATTERN{
-    "6A FF"           // push -01
-    "68 ????????"     // push 018E9573
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "83 EC 0C"        // sub esp, 0C
-    "53"              // push ebx
-    "55"              // push ebp
-    "56"              // push esi
-    "57"              // push edi
-    "A1 ????????"     // mov eax, [01F131C0]
-    "33 C4"           // xor eax, esp
-    "50"              // push eax
-    "8D 44 24 ??"     // lea eax, [esp+20]
-    "64 A3 ????????"  // mov fs:[00000000], eax
-    "8B 6C 24 ??"     // mov ebp, [esp+54]
-    "89 6C 24 ??"     // mov [esp+14], ebp
-};
+
+LazyNative<construct_obj_func> construct_obj_ptr{"StaticConstructObject",
+                                                 CONSTRUCT_OBJECT_PATTERN};
 
 }  // namespace
 
 void BL1Hook::find_construct_object(void) {
-    construct_obj_ptr = CONSTRUCT_OBJECT_PATTERN.sigscan_nullable<construct_obj_func>();
-    LOG(MISC, "StaticConstructObject: {:p}", reinterpret_cast<void*>(construct_obj_ptr));
+    construct_obj_ptr.resolve();
 }
 
 UObject* BL1Hook::construct_object(UClass* cls,
@@ -85,15 +69,6 @@ typedef void(__thiscall* get_path_name_func)(const UObject* self,
 
 get_path_name_func get_path_name_ptr;
 
-const constinit Pattern<13> GET_PATH_NAME_PATTERN{
-    "8B 44 24 ??"  // mov eax, [esp+04]
-    "56"           // push esi
-    "8B F1"        // mov esi, ecx
-    "3B F0"        // cmp esi, eax
-    "74 ??"        // je 005D09D1
-    "85 F6"        // test esi, esi
-};
-
 }  // namespace
 
 void BL1Hook::find_get_path_name(void) {
@@ -119,31 +94,13 @@ typedef UObject*(__cdecl* static_find_object_func)(const UClass* cls,
                                                    const wchar_t* str,
                                                    uint32_t exact_class);
 
-static_find_object_func static_find_object_ptr;
-const constinit Pattern<47> STATIC_FIND_OBJECT_PATTERN{
-    "6A FF"           // push -01
-    "68 ????????"     // push 018E7FF0
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "83 EC 24"        // sub esp, 24
-    "53"              // push ebx
-    "55"              // push ebp
-    "56"              // push esi
-    "57"              // push edi
-    "A1 ????????"     // mov eax, [01F131C0]
-    "33 C4"           // xor eax, esp
-    "50"              // push eax
-    "8D 44 24 ??"     // lea eax, [esp+38]
-    "64 A3 ????????"  // mov fs:[00000000], eax
-    "8B 74 24 ??"     // mov esi, [esp+4C]
-    "8B 7C 24 ??"     // mov edi, [esp+50]
-};
+LazyNative<static_find_object_func> static_find_object_ptr{"StaticFindObject",
+                                                           STATIC_FIND_OBJECT_PATTERN};
 
 }  // namespace
 
 void BL1Hook::find_static_find_object(void) {
-    static_find_object_ptr = STATIC_FIND_OBJECT_PATTERN.sigscan_nullable<static_find_object_func>();
-    LOG(MISC, "StaticFindObject: {:p}", reinterpret_cast<void*>(static_find_object_ptr));
+    static_find_object_ptr.resolve();
 }
 
 UObject* BL1Hook::find_object(UClass* cls, const std::wstring& name) const {
@@ -157,24 +114,13 @@ UObject* BL1Hook::find_object(UClass* cls, const std::wstring& name) const {
 namespace {
 
 using load_package_func = UObject* (*)(const UObject* outer, const wchar_t* name, uint32_t flags);
-load_package_func load_package_ptr;
-
-const constinit Pattern<21> LOAD_PACKAGE_PATTERN{
-    "55"              // push ebp
-    "8B EC"           // mov ebp, esp
-    "6A FF"           // push -01
-    "68 ????????"     // push 018E8C90
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "83 EC 28"        // sub esp, 28
-    "53"              // push ebx
-};
+
+LazyNative<load_package_func> load_package_ptr{"LoadPackage", LOAD_PACKAGE_PATTERN};
 
 }  // namespace
 
 void BL1Hook::find_load_package(void) {
-    load_package_ptr = LOAD_PACKAGE_PATTERN.sigscan_nullable<load_package_func>();
-    LOG(MISC, "LoadPackage: {:p}", reinterpret_cast<void*>(load_package_ptr));
+    load_package_ptr.resolve();
 }
 
 [[nodiscard]] UObject* BL1Hook::load_package(const std::wstring& name, uint32_t flags) const {
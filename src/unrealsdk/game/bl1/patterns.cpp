@@ -0,0 +1,24 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/game/bl1/patterns.h"
+
+// Unlike the rest of the game hooks, this isn't limited to the current flavour, so that offline
+// tools may validate every game's patterns at once
+namespace unrealsdk::game::bl1::patterns {
+
+UNREALSDK_REGISTER_PATTERN("bl1", GNATIVES_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", FNAME_INIT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", GOBJECTS_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", GNAMES_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", SET_COMMAND_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", ARRAY_LIMIT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", PROCESS_EVENT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", CALL_FUNCTION_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", GMALLOC_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl1", CONSTRUCT_OBJECT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl1", GET_PATH_NAME_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl1", STATIC_FIND_OBJECT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl1", LOAD_PACKAGE_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl1", UNPACKED_ENTRY_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1", BEGIN_DESTROY_SIG);
+
+}  // namespace unrealsdk::game::bl1::patterns
@@ -0,0 +1,192 @@
+#ifndef UNREALSDK_GAME_BL1_PATTERNS_H
+#define UNREALSDK_GAME_BL1_PATTERNS_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the patterns can be validated offline, on any platform, without the rest of the sdk.
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::game::bl1::patterns {
+
+using unrealsdk::memory::Pattern;
+
+// FFrame::Step is inlined, so instead we manually re-implement it using GNatives.
+inline constexpr Pattern<11> GNATIVES_SIG{
+    "8B 14 95 {????????}"  // mov edx, [edx*4+01F942C0]
+    "57"                   // push edi
+    "8D 4D ??"             // lea ecx, [ebp-44]
+};
+
+inline constexpr Pattern<72> FNAME_INIT_SIG{
+    "6A FF"              // push -01
+    "68 ????????"        // push 018E73CB
+    "64 A1 ????????"     // mov eax, fs:[00000000]
+    "50"                 // push eax
+    "81 EC ????????"     // sub esp, 00000C98
+    "A1 ????????"        // mov eax, [01F131C0]
+    "33 C4"              // xor eax, esp
+    "89 84 24 ????????"  // mov [esp+00000C94], eax
+    "53"                 // push ebx
+    "55"                 // push ebp
+    "56"                 // push esi
+    "57"                 // push edi
+    "A1 ????????"        // mov eax, [01F131C0]
+    "33 C4"              // xor eax, esp
+    "50"                 // push eax
+    "8D 84 24 ????????"  // lea eax, [esp+00000CAC]
+    "64 A3 ????????"     // mov fs:[00000000], eax
+    "8B BC 24 ????????"  // mov edi, [esp+00000CBC]
+    "8B E9"              // mov ebp, ecx
+    "89 6C 24 ??"        // mov [esp+1C], ebp
+};
+
+inline constexpr Pattern<18> GOBJECTS_SIG{
+    "8B 0D {????????}"  // mov ecx, [01FB4DD8]
+    "8B 04 ??"          // mov eax, [ecx+esi*4]
+    "8B 50 ??"          // mov edx, [eax+0C]
+    "21 58 ??"          // and [eax+08], ebx
+    "89 50 ??"          // mov [eax+0C], edx
+};
+
+inline constexpr Pattern<21> GNAMES_SIG{
+    "A1 {????????}"  // mov eax, [01FB4DA8]
+    "8B 0C ??"       // mov ecx, [eax+esi*4]
+    "68 ????????"    // push 00001000
+    "6A ??"          // push 00
+    "E8 ????????"    // call 005C21F0
+    "5E"             // pop esi
+};
+
+inline constexpr Pattern<32> SET_COMMAND_SIG{
+    "85 C0"           // test eax, eax
+    "{?? ??}"         // jne 0087EC57
+    "8D 4C 24 ??"     // lea ecx, [esp+18]
+    "68 ????????"     // push 01B167C0
+    "51"              // push ecx
+    "E8 ????????"     // call 005C2FD0
+    "83 C4 08"        // add esp, 08
+    "85 C0"           // test eax, eax
+    "74 ??"           // je 0087EC80
+    "39 9E ????????"  // cmp [esi+000003E0], ebx
+};
+
+inline constexpr Pattern<32> ARRAY_LIMIT_SIG{
+    "6A 64"            // push 64
+    "50"               // push eax
+    "46"               // inc esi
+    "{?? ????????}"    // call MIN              <---
+    "83 C4 08"         // add esp, 08
+    "3B F0"            // cmp esi, eax
+    "0F8C ????????"    // jl 005E8F03
+    "8B 7F ??"         // mov edi, [edi+04]
+    "83 FF 64"         // cmp edi, 64
+    "{???? ????????}"  // jl DONT_PRINT_MSG     <---
+};
+
+inline constexpr Pattern<30> PROCESS_EVENT_SIG{
+    "55"              // push ebp
+    "8B EC"           // mov ebp, esp
+    "6A FF"           // push -01
+    "68 ????????"     // push 018E55E8
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "83 EC 40"        // sub esp, 40
+    "A1 ????????"     // mov eax, [01F131C0]
+    "33 C5"           // xor eax, ebp
+    "89 45 ??"        // mov [ebp-10], eax
+};
+
+inline constexpr Pattern<31> CALL_FUNCTION_SIG{
+    "55"                 // push ebp
+    "8D AC 24 ????????"  // lea ebp, [esp-00000404]
+    "81 EC ????????"     // sub esp, 00000404
+    "6A FF"              // push -01
+    "68 ????????"        // push 018E55B8
+    "64 A1 ????????"     // mov eax, fs:[00000000]
+    "50"                 // push eax
+    "83 EC 40"           // sub esp, 40
+};
+
+inline constexpr Pattern<8> GMALLOC_PATTERN{
+    "89 0D {????????}"  // mov [01F703F4],ecx { (05AA6980) }
+    "8B 11"             // mov edx,[ecx]
+};
+
+inline constexpr Pattern<47> CONSTRUCT_OBJECT_PATTERN{
+    "6A FF"           // push -01
+    "68 ????????"     // push 018E9573
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "83 EC 0C"        // sub esp, 0C
+    "53"              // push ebx
+    "55"              // push ebp
+    "56"              // push esi
+    "57"              // push edi
+    "A1 ????????"     // mov eax, [01F131C0]
+    "33 C4"           // xor eax, esp
+    "50"              // push eax
+    "8D 44 24 ??"     // lea eax, [esp+20]
+    "64 A3 ????????"  // mov fs:[00000000], eax
+    "8B 6C 24 ??"     // mov ebp, [esp+54]
+    "89 6C 24 ??"     // mov [esp+14], ebp
+};
+
+inline constexpr Pattern<13> GET_PATH_NAME_PATTERN{
+    "8B 44 24 ??"  // mov eax, [esp+04]
+    "56"           // push esi
+    "8B F1"        // mov esi, ecx
+    "3B F0"        // cmp esi, eax
+    "74 ??"        // je 005D09D1
+    "85 F6"        // test esi, esi
+};
+
+inline constexpr Pattern<47> STATIC_FIND_OBJECT_PATTERN{
+    "6A FF"           // push -01
+    "68 ????????"     // push 018E7FF0
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "83 EC 24"        // sub esp, 24
+    "53"              // push ebx
+    "55"              // push ebp
+    "56"              // push esi
+    "57"              // push edi
+    "A1 ????????"     // mov eax, [01F131C0]
+    "33 C4"           // xor eax, esp
+    "50"              // push eax
+    "8D 44 24 ??"     // lea eax, [esp+38]
+    "64 A3 ????????"  // mov fs:[00000000], eax
+    "8B 74 24 ??"     // mov esi, [esp+4C]
+    "8B 7C 24 ??"     // mov edi, [esp+50]
+};
+
+inline constexpr Pattern<21> LOAD_PACKAGE_PATTERN{
+    "55"              // push ebp
+    "8B EC"           // mov ebp, esp
+    "6A FF"           // push -01
+    "68 ????????"     // push 018E8C90
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "83 EC 28"        // sub esp, 28
+    "53"              // push ebx
+};
+
+// This is ___tmainCRTStartup, so expect it's very stable
+inline constexpr Pattern<14> UNPACKED_ENTRY_SIG{"6A 58 68 ?? ?? ?? ?? E8 ?? ?? ?? ?? 33 DB"};
+
+// Unlike the other patterns, this is only searched for near the start of each of the base object's
+// virtual functions, see `gc::impl::find_begin_destroy`, so it needn't be unique in the whole exe.
+// Matches `ExitProperties(this, Class)` followed by `SetLinker(nullptr, INDEX_NONE)`.
+inline constexpr Pattern<20> BEGIN_DESTROY_SIG{
+    "8B 46 ??"     // mov eax, [esi+34]
+    "50"           // push eax
+    "56"           // push esi
+    "E8 ????????"  // call ExitProperties
+    "83 C4 08"     // add esp, 08
+    "6A FF"        // push -01
+    "6A 00"        // push 00
+    "8B CE"        // mov ecx, esi
+    "E8"           // call UObject::SetLinker
+};
+
+}  // namespace unrealsdk::game::bl1::patterns
+
+#endif /* UNREALSDK_GAME_BL1_PATTERNS_H */
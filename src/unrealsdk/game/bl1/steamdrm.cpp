@@ -1,20 +1,20 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl1/bl1.h"
+#include "unrealsdk/game/bl1/patterns.h"
 #include "unrealsdk/memory.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/utils.h"
 
 #if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW && !defined(UNREALSDK_IMPORTING)
 
 using namespace unrealsdk::utils;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl1::patterns;
 
 namespace unrealsdk::game {
 
 namespace {
 
-// This is ___tmainCRTStartup, so expect it's very stable
-const constinit Pattern<14> UNPACKED_ENTRY_SIG{"6A 58 68 ?? ?? ?? ?? E8 ?? ?? ?? ?? 33 DB"};
-
 std::atomic<bool> ready = false;
 std::mutex ready_mutex;
 std::condition_variable ready_cv;
@@ -85,12 +85,16 @@ void BL1Hook::wait_for_steam_drm(void) {
     if (failed_to_hook) {
         LOG(ERROR, "Falling back to a static delay");
         // Need to sleep after unsuspending threads, have to do this here
+        const profiling::ScopedTimer timer{"steam drm static delay", "wait"};
         std::this_thread::sleep_for(FALLBACK_DELAY);
         return;
     }
 
     std::unique_lock lock(ready_mutex);
-    ready_cv.wait(lock, [] { return ready.load(); });
+    {
+        const profiling::ScopedTimer timer{"steam drm unpack", "wait"};
+        ready_cv.wait(lock, [] { return ready.load(); });
+    }
 
     MH_STATUS status = MH_OK;
     status = MH_DisableHook(reinterpret_cast<LPVOID>(&GetStartupInfoA));
@@ -1,6 +1,8 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl1e/bl1e.h"
 
+#include "unrealsdk/game/bl1e/patterns.h"
+#include "unrealsdk/game/startup_graph.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/structs/fframe.h"
@@ -10,61 +12,55 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1e::patterns;
 
 namespace unrealsdk::game {
 
 void BL1EHook::hook(void) {
-    wait_for_steam_drm();
+    StartupGraph graph{};
+
+    graph.add("wait_for_steam_drm", wait_for_steam_drm);
 
     // do this asap since it messes with early launch functions
-    try {
-        hexedit_editor_access();
-    } catch (const std::exception& err) {
-        LOG(WARNING, "Failed to unlock the editor ~ {}", err.what());
-    }
-
-    hook_process_event();
-    hook_call_function();
-
-    find_gmalloc();
-    find_gobjects();
-    find_gnames();
-    find_fname_init();
-    find_fframe_step();
-    find_construct_object();
-    find_get_path_name();
-    find_static_find_object();
-    find_load_package();
+    // Since it may also deliberately delay startup, keep everything else after it
+    graph.add(
+        "hexedit_editor_access",
+        []() {
+            try {
+                hexedit_editor_access();
+            } catch (const std::exception& err) {
+                LOG(WARNING, "Failed to unlock the editor ~ {}", err.what());
+            }
+        },
+        {"wait_for_steam_drm"});
+
+    graph.add("hook_process_event", hook_process_event, {"hexedit_editor_access"})
+        .add("hook_call_function", hook_call_function, {"hexedit_editor_access"});
+
+    graph.add("find_gmalloc", find_gmalloc, {"hexedit_editor_access"})
+        .add("find_gobjects", find_gobjects, {"hexedit_editor_access"})
+        .add("find_gnames", find_gnames, {"hexedit_editor_access"})
+        .add("find_fname_init", find_fname_init, {"hexedit_editor_access"})
+        .add("find_fframe_step", find_fframe_step, {"hexedit_editor_access"})
+        .add("find_get_path_name", find_get_path_name, {"hexedit_editor_access"})
+        .add("find_load_package", find_load_package, {"hexedit_editor_access"});
+
+    graph.run();
 }
 
 void BL1EHook::post_init(void) {
     inject_console();
+    hook_begin_destroy();
+
+    // These natives are resolved on first use, but may as well get them ready in the background
+    StartupGraph{}
+        .add("find_construct_object", find_construct_object)
+        .add("find_static_find_object", find_static_find_object)
+        .run_in_background();
 }
 
 namespace {
 
-// 40 55 56 57 41 54 41 55 41 56 41 57 48 81 EC E0 0C 00 00
-constexpr Pattern<19> FNAME_INIT_SIG{
-    "40 55"              // PUSH  RBP
-    "56"                 // PUSH  RSI
-    "57"                 // PUSH  RDI
-    "41 54"              // PUSH  R12
-    "41 55"              // PUSH  R13
-    "41 56"              // PUSH  R14
-    "41 57"              // PUSH  R15
-    "48 81 EC E00C0000"  // SUB   RSP,0xCE0
-};
-
-constexpr Pattern<33> GNATIVES_SIG{
-    "33 C9"                // XOR     ECX,ECX
-    "48 39 15 ????????"    // CMP     qword ptr [BL1E_GNatives]
-    "0F 45 C1"             // CMOVNZ  EAX,ECX
-    "89 05 ????????"       // MOV     dword ptr [DAT_142546260],EAX
-    "48 8B 05 ????????"    // MOV     RAX=>FUN_140144f50,qword ptr
-    "48 89 05 {????????}"  // MOV     qword ptr [BL1E_GNatives]
-    "C3"                   // RET
-};
-
 using native_func = void (UObject::*)(FFrame* stack, void* result);
 native_func* fframe_step_gnatives{nullptr};
 
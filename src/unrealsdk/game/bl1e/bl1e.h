@@ -26,6 +26,12 @@ class BL1EHook : public AbstractHook {
      */
     static void hook_call_function(void);
 
+    /**
+     * @brief Hooks `UObject::BeginDestroy` and points it at the gc tracking.
+     * @note Requires unrealsdk to be initialized, so must be called during post init.
+     */
+    static void hook_begin_destroy(void);
+
     /**
      * @brief Finds GObjects, and populates the wrapper member.
      */
@@ -48,6 +54,7 @@ class BL1EHook : public AbstractHook {
 
     /**
      * @brief Finds `StaticConstructObject`, and sets up such that `construct_object` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_construct_object(void);
 
@@ -58,6 +65,7 @@ class BL1EHook : public AbstractHook {
 
     /**
      * @brief Finds `StaticFindObject`, and sets up such that `find_object` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_static_find_object(void);
 
@@ -108,6 +116,10 @@ class BL1EHook : public AbstractHook {
     void fname_init(unreal::FName* name, const wchar_t* str, uint32_t number) const override;
     [[nodiscard]] std::variant<const std::string_view, const std::wstring_view> fname_get_str(
         const unreal::FName& name) const override;
+    size_t fname_iterate(size_t start,
+                         const std::function<void(uint32_t)>& callback,
+                         const std::function<void(uint32_t)>& empty_callback) const override;
+    [[nodiscard]] bool fname_is_filled(uint32_t idx) const override;
     void fframe_step(unreal::FFrame* frame, unreal::UObject* obj, void* param) const override;
     void process_event(unreal::UObject* object,
                        unreal::UFunction* func,
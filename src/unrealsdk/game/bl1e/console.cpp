@@ -4,6 +4,7 @@
 #include "unrealsdk/config.h"
 #include "unrealsdk/game/bl1e/bl1e.h"
 #include "unrealsdk/hook_manager.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/classes/uobject_funcs.h"
 #include "unrealsdk/unreal/find_class.h"
@@ -192,6 +193,7 @@ bool inject_console_hook(const hook_manager::Details& hook) {
 }  // namespace
 
 void BL1EHook::inject_console(void) {
+    const profiling::ScopedTimer timer{"inject_console", "startup"};
     add_hook(SAY_BYPASS_FUNC, SAY_BYPASS_TYPE, SAY_BYPASS_ID, &say_bypass_hook);
 
     add_hook(CONSOLE_COMMAND_FUNC, CONSOLE_COMMAND_TYPE, CONSOLE_COMMAND_ID, &console_command_hook);
@@ -2,6 +2,7 @@
 
 #include "unrealsdk/game/bl1e/bl1e.h"
 #include "unrealsdk/game/bl1e/offsets.h"
+#include "unrealsdk/game/bl1e/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/wrappers/gobjects.h"
 
@@ -9,6 +10,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1e::patterns;
 
 namespace unrealsdk::game {
 
@@ -16,12 +18,6 @@ namespace {
 
 GObjects gobjects_wrapper{};
 
-constexpr Pattern<18> SIG_GOBJECTS{
-    "8B0D ????????"        // MOV  this,dword ptr [DAT_1425d95d8]
-    "48 8B 15 {????????}"  // MOV  RDX,qword ptr [BL1E_GObjects]
-    "48 833CDA 00"         // CMP  qword ptr [RDX + RBX*0x8],0x0
-};
-
 }  // namespace
 
 void BL1EHook::find_gobjects(void) {
@@ -36,14 +32,6 @@ const GObjects& BL1EHook::gobjects(void) const {
 
 namespace {
 
-constexpr Pattern<25> SIG_GNAMES{
-    "E8 ????????"        // CALL  FUN_1401afda0
-    "488B05 {????????}"  // MOV   RAX,qword ptr [GNames_NameHash]
-    "48 89 3C D8"        // MOV   qword ptr [RAX + RBX*0x8],RDI
-    "49 8B CC"           // MOV   this,R12
-    "FF15 ????????"      // CALL  qword ptr [->KERNEL32.DLL::LeaveCriticalSection]
-};
-
 TArray<bl1e::FNameEntry*>* gnames_ptr;
 
 }  // namespace
@@ -62,6 +50,26 @@ void BL1EHook::find_gnames(void) {
     return std::string_view{&entry->Name.Ansi[0]};
 }
 
+size_t BL1EHook::fname_iterate(size_t start,
+                               const std::function<void(uint32_t)>& callback,
+                               const std::function<void(uint32_t)>& empty_callback) const {
+    auto count = gnames_ptr->size();
+    for (auto idx = start; idx < count; idx++) {
+        // Unused slots are left null - but so are slots which have been added to the array, and
+        // which are yet to have their entry written
+        if (gnames_ptr->at(idx) != nullptr) {
+            callback(static_cast<uint32_t>(idx));
+        } else {
+            empty_callback(static_cast<uint32_t>(idx));
+        }
+    }
+    return std::max(start, count);
+}
+
+bool BL1EHook::fname_is_filled(uint32_t idx) const {
+    return gnames_ptr->at(idx) != nullptr;
+}
+
 }  // namespace unrealsdk::game
 
 #endif
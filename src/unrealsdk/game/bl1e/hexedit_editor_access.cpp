@@ -1,7 +1,9 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl1e/bl1e.h"
 
+#include "unrealsdk/game/bl1e/patterns.h"
 #include "unrealsdk/memory.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/utils.h"
 
 #if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW && !defined(UNREALSDK_IMPORTING)
@@ -9,6 +11,7 @@
 namespace unrealsdk::game {
 
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl1e::patterns;
 
 namespace {
 
@@ -59,6 +62,7 @@ void BL1EHook::hexedit_editor_access() {
     }
 
     if (should_use_static_delay) {
+        const profiling::ScopedTimer timer{"steam drm static delay", "wait"};
         std::this_thread::sleep_for(FALLBACK_DELAY);
     }
 }
@@ -73,12 +77,8 @@ constexpr uint8_t ASM_NOOP = 0x90;
 ////////////////////////////////////////////////////////////////////////////////
 
 void hexedit_prevent_iseditor_unsetting(void) {
-    // 89 35 ?? ?? ?? ?? 89 35 ?? ?? ?? ?? 48 8D 0D ?? ?? ?? ?? E8 ?? ?? ?? ?? 8B C6
-    constexpr Pattern<26> preinit_unset_globals{
-        "89 35 ?? ?? ?? ?? 89 35 ?? ?? ?? ?? 48 8D 0D ?? ?? ?? ?? E8 ?? ?? ?? ?? 8B C6"};
-
     // 0F 85 17 02 00 00 E8 0D 59 A6 FF 48 8B 48 54 83 79 5C 04
-    auto* code = preinit_unset_globals.sigscan<uint8_t*>("GIsEditor = false patch");
+    auto* code = SIG_PREINIT_UNSET_GLOBALS.sigscan<uint8_t*>("GIsEditor = false patch");
 
     // MOV  GIsEditor, 0x0
     unlock_range(code, ASM_CALL_INSTRUCTION_LENGTH);
@@ -88,9 +88,7 @@ void hexedit_prevent_iseditor_unsetting(void) {
 void hexedit_disable_mmg_upsell(void) {
     // Its tempting to see if we can NOP the E8 ?? ?? ?? ?? since this'll prevent the initialisation
     // entirely. But does mean that the global pointer will be undefined or maybe null?
-    constexpr Pattern<20> mmg_upsell_init{
-        "CC E8 ?? ?? ?? ?? 85 C0 75 ?? 48 8D 15 ?? ?? ?? ?? 48 8B 0D"};
-    auto* code = mmg_upsell_init.sigscan<uint8_t*>("mmg_upsell patch");
+    auto* code = SIG_MMG_UPSELL_INIT.sigscan<uint8_t*>("mmg_upsell patch");
 
     constexpr size_t if_jump_index = 8;
     constexpr size_t while_jump_index = 44;
@@ -128,11 +126,10 @@ void hexedit_allow_savepackage(void) {
     // since the GCallbackQuery is default initialised with a return 0/false implementation for all
     //  its virtual functions.
     //
-    constexpr Pattern<17> sig_query_callback{"48 8B 01 4C 8B 45 D7 41 8B D7 FF 50 10 85 C0 0F 84"};
     constexpr size_t offset = 15;
     constexpr size_t asm_jz_instruction_length = 6;
 
-    auto* code = sig_query_callback.sigscan<uint8_t*>("editor save package patch") + offset;
+    auto* code = SIG_QUERY_CALLBACK.sigscan<uint8_t*>("editor save package patch") + offset;
     unlock_range(code, asm_jz_instruction_length);
     std::memset(code, ASM_NOOP, asm_jz_instruction_length);
 }
@@ -145,12 +142,6 @@ void hexedit_allow_savepackage(void) {
 
 namespace {
 
-// the signature matches two things, both are in the same function; not sure on the name for this
-// function as I don't know a lot about the startup process but its probably the same one used
-// in BL1 ___tmainCRTStartup
-constexpr Pattern<19> SIG_ENTRY_FUNCTION{
-    "48 8B D8 48 83 38 00 74 ?? 48 8B C8 E8 ?? ?? ?? ?? 84 C0"};
-
 std::atomic ready = false;
 std::mutex ready_mutex{};
 std::condition_variable ready_cv{};
@@ -224,6 +215,7 @@ void BL1EHook::wait_for_steam_drm(void) {
     }
 
     should_use_static_delay = false;
+    const profiling::ScopedTimer timer{"steam drm unpack", "wait"};
     ready_cv.wait(lock, [] { return ready.load(); });
     // not going to disable the hook since I want to minimise the chance of the next hooks failing.
     // We should have more leeway than we will ever need but you never know. Its also not a function
@@ -2,6 +2,8 @@
 
 #include "unrealsdk/game/bl1e/bl1e.h"
 
+#include "unrealsdk/game/bl1e/patterns.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/locks.h"
 #include "unrealsdk/memory.h"
@@ -13,6 +15,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1e::patterns;
 
 namespace unrealsdk::game {
 
@@ -21,13 +24,6 @@ namespace {
 using process_event_func = void (*)(UObject* obj, UFunction* func, void* params, void* /*null*/);
 process_event_func process_event_ptr;
 
-constexpr Pattern<13> PROCESS_EVENT_SIG{
-    "40 55"            // PUSH  RBP
-    "41 56"            // PUSH  R14
-    "41 57"            // PUSH  R15
-    "4881EC 90000000"  // SUB   RSP,0x90
-};
-
 void process_event_hook(UObject* obj, UFunction* func, void* params, void* null) {
     try {
         // This arg seems to be in the process of being deprecated, no usage in ghidra, always seems
@@ -67,6 +63,7 @@ void process_event_hook(UObject* obj, UFunction* func, void* params, void* null)
 
             if (!block_execution) {
                 run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL, hook);
@@ -108,18 +105,6 @@ namespace {
 using call_function_func = void (*)(UObject* obj, FFrame* stack, void* params, UFunction* func);
 call_function_func call_function_ptr;
 
-constexpr Pattern<20> CALL_FUNCTION_SIG{
-    "40 55"            // PUSH  RBP
-    "53"               // PUSH  RBX
-    "56"               // PUSH  RSI
-    "57"               // PUSH  RDI
-    "41 54"            // PUSH  R12
-    "41 55"            // PUSH  R13
-    "41 56"            // PUSH  R14
-    "41 57"            // PUSH  R15
-    "4881EC A8040000"  // SUB   RSP,0x4A8
-};
-
 void call_function_hook(UObject* obj, FFrame* stack, void* result, UFunction* func) {
     try {
         auto data = hook_manager::impl::preprocess_hook(L"CallFunction", func, obj);
@@ -158,6 +143,7 @@ void call_function_hook(UObject* obj, FFrame* stack, void* result, UFunction* fu
 
             if (!block_execution) {
                 run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL, hook);
@@ -187,6 +173,33 @@ void BL1EHook::hook_call_function(void) {
            &call_function_ptr, "CallFunction");
 }
 
+namespace {
+
+using begin_destroy_func = void (*)(UObject* obj);
+begin_destroy_func begin_destroy_ptr;
+
+void begin_destroy_hook(UObject* obj) {
+    try {
+        gc::impl::object_destroyed(obj);
+    } catch (const std::exception& ex) {
+        LOG(ERROR, "An exception occurred during the BeginDestroy hook: {}", ex.what());
+    }
+
+    begin_destroy_ptr(obj);
+}
+
+static_assert(std::is_same_v<decltype(&begin_destroy_hook), begin_destroy_func>,
+              "begin_destroy signature is incorrect");
+
+}  // namespace
+
+void BL1EHook::hook_begin_destroy(void) {
+    auto addr = gc::impl::find_begin_destroy(BEGIN_DESTROY_SIG);
+    if (addr != 0 && detour(addr, begin_destroy_hook, &begin_destroy_ptr, "BeginDestroy")) {
+        gc::impl::start_tracking();
+    }
+}
+
 }  // namespace unrealsdk::game
 
 #endif
@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/game/bl1e/bl1e.h"
+#include "unrealsdk/game/bl1e/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/alignment.h"
 
@@ -8,6 +9,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl1e::patterns;
 
 namespace unrealsdk::game {
 
@@ -26,13 +28,6 @@ struct FMalloc {
 
 FMalloc** gmalloc_ptr;
 
-// static initialiser for gmalloc
-constexpr Pattern<14> SIG_GMALLOC{
-    "33 FF"              // XOR  EDI,EDI
-    "48893D {????????}"  // MOV  qword ptr [GMalloc_DAT_142519ef0],RDI
-    "488B7C 2438"        // MOV  RDI,qword ptr [RSP + local_res10]
-};
-
 }  // namespace
 
 void BL1EHook::find_gmalloc() {
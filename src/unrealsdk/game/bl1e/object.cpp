@@ -2,6 +2,8 @@
 
 #include "unrealsdk/game/bl1e/bl1e.h"
 #include "unrealsdk/game/bl1e/offsets.h"
+#include "unrealsdk/game/bl1e/patterns.h"
+#include "unrealsdk/game/lazy_native.h"
 #include "unrealsdk/logging.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/classes/uobject.h"
@@ -11,6 +13,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl1e::patterns;
 
 namespace unrealsdk::game {
 
@@ -26,22 +29,13 @@ using construct_obj_func = UObject* (*)(UClass * in_class,
                                         void* error,
                                         void* subobject_root,
                                         void* in_instance_graph);
-construct_obj_func construct_obj_ptr;
 
-constexpr Pattern<16> SIG_CONSTRUCT_OBJECT{
-    "48 8B C4"     // MOV   RAX,RSP
-    "4C 89 40 18"  // MOV   qword ptr [RAX + local_res18],param_3
-    "57"           // PUSH  RDI
-    "41 56"        // PUSH  R14
-    "41 57"        // PUSH  R15
-    "48 83 EC 70"  // SUB   RSP,0x70
-};
+LazyNative<construct_obj_func> construct_obj_ptr{"StaticConstructObject", SIG_CONSTRUCT_OBJECT};
 
 }  // namespace
 
 void BL1EHook::find_construct_object(void) {
-    construct_obj_ptr = SIG_CONSTRUCT_OBJECT.sigscan_nullable<construct_obj_func>();
-    LOG(MISC, "StaticConstructObject: {:p}", reinterpret_cast<void*>(construct_obj_ptr));
+    construct_obj_ptr.resolve();
 }
 
 UObject* BL1EHook::construct_object(UClass* cls,
@@ -64,16 +58,6 @@ using get_path_name_func = void (*)(const UObject* self,
 
 get_path_name_func get_path_name_ptr;
 
-constexpr Pattern<25> SIG_GET_PATH_NAME{
-    "48 89 74 24 10"  // MOV   qword ptr [RSP + local_res10],RSI
-    "57"              // PUSH  RDI
-    "48 83 EC 20"     // SUB   RSP,0x20
-    "49 8B F0"        // MOV   RSI,ResultString
-    "48 8B F9"        // MOV   RDI,this
-    "48 3B CA"        // CMP   this,StopOuter
-    "0F84 ????????"   // JZ    LAB_1401c02e2
-};
-
 }  // namespace
 
 void BL1EHook::find_get_path_name(void) {
@@ -98,27 +82,13 @@ using static_find_object_func = UObject* (*)(const UClass* cls,
                                              const wchar_t* str,
                                              bool exact_class);
 
-static_find_object_func static_find_object_ptr;
-
-constexpr Pattern<36> SIG_STATIC_FIND_OBJECT{
-    "40 55"                       // PUSH  RBP
-    "56"                          // PUSH  RSI
-    "57"                          // PUSH  RDI
-    "41 54"                       // PUSH  R12
-    "41 55"                       // PUSH  R13
-    "41 56"                       // PUSH  R14
-    "41 57"                       // PUSH  R15
-    "48 83 EC 70"                 // SUB   RSP,0x70
-    "48 C7 44 24 40 FE FF FF FF"  // MOV   qword ptr [RSP + local_68],-0x2
-    "48 89 9C 24 B0 00 00 00"     // MOV   qword ptr [RSP + local_res8],RBX
-    "45 8B E9"                    // MOV   R13D,ExactClass
-};
+LazyNative<static_find_object_func> static_find_object_ptr{"StaticFindObject",
+                                                           SIG_STATIC_FIND_OBJECT};
 
 }  // namespace
 
 void BL1EHook::find_static_find_object(void) {
-    static_find_object_ptr = SIG_STATIC_FIND_OBJECT.sigscan_nullable<static_find_object_func>();
-    LOG(MISC, "StaticFindObject: {:p}", reinterpret_cast<void*>(static_find_object_ptr));
+    static_find_object_ptr.resolve();
 }
 
 UObject* BL1EHook::find_object(UClass* cls, const std::wstring& name) const {
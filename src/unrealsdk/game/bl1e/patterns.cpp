@@ -0,0 +1,28 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/game/bl1e/patterns.h"
+
+// Unlike the rest of the game hooks, this isn't limited to the current flavour, so that offline
+// tools may validate every game's patterns at once
+namespace unrealsdk::game::bl1e::patterns {
+
+UNREALSDK_REGISTER_PATTERN("bl1e", FNAME_INIT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1e", GNATIVES_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_GOBJECTS);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_GNAMES);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_PREINIT_UNSET_GLOBALS);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_MMG_UPSELL_INIT);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_QUERY_CALLBACK);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_ENTRY_FUNCTION);
+UNREALSDK_REGISTER_PATTERN("bl1e", PROCESS_EVENT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1e", CALL_FUNCTION_SIG);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_GMALLOC);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_CONSTRUCT_OBJECT);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_GET_PATH_NAME);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_STATIC_FIND_OBJECT);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_LOAD_PACKAGE);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_CREATE_EXPORT);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_STATIC_LOAD_OBJECT);
+UNREALSDK_REGISTER_PATTERN("bl1e", SIG_GET_EXPORT_PATH_NAME);
+UNREALSDK_REGISTER_PATTERN("bl1e", BEGIN_DESTROY_SIG);
+
+}  // namespace unrealsdk::game::bl1e::patterns
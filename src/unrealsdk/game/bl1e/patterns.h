@@ -0,0 +1,197 @@
+#ifndef UNREALSDK_GAME_BL1E_PATTERNS_H
+#define UNREALSDK_GAME_BL1E_PATTERNS_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the patterns can be validated offline, on any platform, without the rest of the sdk.
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::game::bl1e::patterns {
+
+using unrealsdk::memory::Pattern;
+
+// 40 55 56 57 41 54 41 55 41 56 41 57 48 81 EC E0 0C 00 00
+inline constexpr Pattern<19> FNAME_INIT_SIG{
+    "40 55"              // PUSH  RBP
+    "56"                 // PUSH  RSI
+    "57"                 // PUSH  RDI
+    "41 54"              // PUSH  R12
+    "41 55"              // PUSH  R13
+    "41 56"              // PUSH  R14
+    "41 57"              // PUSH  R15
+    "48 81 EC E00C0000"  // SUB   RSP,0xCE0
+};
+
+inline constexpr Pattern<33> GNATIVES_SIG{
+    "33 C9"                // XOR     ECX,ECX
+    "48 39 15 ????????"    // CMP     qword ptr [BL1E_GNatives]
+    "0F 45 C1"             // CMOVNZ  EAX,ECX
+    "89 05 ????????"       // MOV     dword ptr [DAT_142546260],EAX
+    "48 8B 05 ????????"    // MOV     RAX=>FUN_140144f50,qword ptr
+    "48 89 05 {????????}"  // MOV     qword ptr [BL1E_GNatives]
+    "C3"                   // RET
+};
+
+inline constexpr Pattern<18> SIG_GOBJECTS{
+    "8B0D ????????"        // MOV  this,dword ptr [DAT_1425d95d8]
+    "48 8B 15 {????????}"  // MOV  RDX,qword ptr [BL1E_GObjects]
+    "48 833CDA 00"         // CMP  qword ptr [RDX + RBX*0x8],0x0
+};
+
+inline constexpr Pattern<25> SIG_GNAMES{
+    "E8 ????????"        // CALL  FUN_1401afda0
+    "488B05 {????????}"  // MOV   RAX,qword ptr [GNames_NameHash]
+    "48 89 3C D8"        // MOV   qword ptr [RAX + RBX*0x8],RDI
+    "49 8B CC"           // MOV   this,R12
+    "FF15 ????????"      // CALL  qword ptr [->KERNEL32.DLL::LeaveCriticalSection]
+};
+
+// 89 35 ?? ?? ?? ?? 89 35 ?? ?? ?? ?? 48 8D 0D ?? ?? ?? ?? E8 ?? ?? ?? ?? 8B C6
+inline constexpr Pattern<26> SIG_PREINIT_UNSET_GLOBALS{
+    "89 35 ?? ?? ?? ?? 89 35 ?? ?? ?? ?? 48 8D 0D ?? ?? ?? ?? E8 ?? ?? ?? ?? 8B C6"};
+
+inline constexpr Pattern<20> SIG_MMG_UPSELL_INIT{
+    "CC E8 ?? ?? ?? ?? 85 C0 75 ?? 48 8D 15 ?? ?? ?? ?? 48 8B 0D"};
+
+inline constexpr Pattern<17> SIG_QUERY_CALLBACK{
+    "48 8B 01 4C 8B 45 D7 41 8B D7 FF 50 10 85 C0 0F 84"};
+
+// the signature matches two things, both are in the same function; not sure on the name for this
+// function as I don't know a lot about the startup process but its probably the same one used
+// in BL1 ___tmainCRTStartup
+inline constexpr Pattern<19> SIG_ENTRY_FUNCTION{
+    "48 8B D8 48 83 38 00 74 ?? 48 8B C8 E8 ?? ?? ?? ?? 84 C0"};
+
+inline constexpr Pattern<13> PROCESS_EVENT_SIG{
+    "40 55"            // PUSH  RBP
+    "41 56"            // PUSH  R14
+    "41 57"            // PUSH  R15
+    "4881EC 90000000"  // SUB   RSP,0x90
+};
+
+inline constexpr Pattern<20> CALL_FUNCTION_SIG{
+    "40 55"            // PUSH  RBP
+    "53"               // PUSH  RBX
+    "56"               // PUSH  RSI
+    "57"               // PUSH  RDI
+    "41 54"            // PUSH  R12
+    "41 55"            // PUSH  R13
+    "41 56"            // PUSH  R14
+    "41 57"            // PUSH  R15
+    "4881EC A8040000"  // SUB   RSP,0x4A8
+};
+
+// static initialiser for gmalloc
+inline constexpr Pattern<14> SIG_GMALLOC{
+    "33 FF"              // XOR  EDI,EDI
+    "48893D {????????}"  // MOV  qword ptr [GMalloc_DAT_142519ef0],RDI
+    "488B7C 2438"        // MOV  RDI,qword ptr [RSP + local_res10]
+};
+
+inline constexpr Pattern<16> SIG_CONSTRUCT_OBJECT{
+    "48 8B C4"     // MOV   RAX,RSP
+    "4C 89 40 18"  // MOV   qword ptr [RAX + local_res18],param_3
+    "57"           // PUSH  RDI
+    "41 56"        // PUSH  R14
+    "41 57"        // PUSH  R15
+    "48 83 EC 70"  // SUB   RSP,0x70
+};
+
+inline constexpr Pattern<25> SIG_GET_PATH_NAME{
+    "48 89 74 24 10"  // MOV   qword ptr [RSP + local_res10],RSI
+    "57"              // PUSH  RDI
+    "48 83 EC 20"     // SUB   RSP,0x20
+    "49 8B F0"        // MOV   RSI,ResultString
+    "48 8B F9"        // MOV   RDI,this
+    "48 3B CA"        // CMP   this,StopOuter
+    "0F84 ????????"   // JZ    LAB_1401c02e2
+};
+
+inline constexpr Pattern<36> SIG_STATIC_FIND_OBJECT{
+    "40 55"                       // PUSH  RBP
+    "56"                          // PUSH  RSI
+    "57"                          // PUSH  RDI
+    "41 54"                       // PUSH  R12
+    "41 55"                       // PUSH  R13
+    "41 56"                       // PUSH  R14
+    "41 57"                       // PUSH  R15
+    "48 83 EC 70"                 // SUB   RSP,0x70
+    "48 C7 44 24 40 FE FF FF FF"  // MOV   qword ptr [RSP + local_68],-0x2
+    "48 89 9C 24 B0 00 00 00"     // MOV   qword ptr [RSP + local_res8],RBX
+    "45 8B E9"                    // MOV   R13D,ExactClass
+};
+
+inline constexpr Pattern<22> SIG_LOAD_PACKAGE{
+    "48 8B C4"     // MOV   RAX,RSP
+    "44 89 40 18"  // MOV   dword ptr [RAX + local_res18],LoadFlags
+    "48 89 48 08"  // MOV   qword ptr [RAX + local_res8],InOuter
+    "53"           // PUSH  RBX
+    "56"           // PUSH  RSI
+    "57"           // PUSH  RDI
+    "41 56"        // PUSH  R14
+    "41 57"        // PUSH  R15
+    "48 83 EC 60"  // SUB   RSP,0x60
+};
+
+inline constexpr Pattern<47> SIG_CREATE_EXPORT{
+    "89 54 24 10"              // MOV   dword ptr [RSP + local_res10]
+    "48 89 4C 24 08"           // MOV   qword ptr [RSP + local_res8]
+    "55"                       // PUSH  RBP
+    "53"                       // PUSH  RBX
+    "56"                       // PUSH  RSI
+    "57"                       // PUSH  RDI
+    "41 54"                    // PUSH  R12
+    "41 55"                    // PUSH  R13
+    "41 56"                    // PUSH  R14
+    "41 57"                    // PUSH  R15
+    "48 8D 6C 24 E1"           // LEA   RBP=>local_5f,[RSP + -0x1f]
+    "48 81 EC C8 00 00 00"     // SUB   RSP,0xc8
+    "48 C7 45 07 FE FF FF FF"  // MOV   qword ptr [RBP + local_58],-0x2
+    "44 8B F2"                 // MOV   R14D,Index
+    "4C 8B E9"                 // MOV   R13,this
+};
+
+inline constexpr Pattern<29> SIG_STATIC_LOAD_OBJECT{
+    "48 8B C4"              // MOV   RAX,RSP
+    "4C 89 48 20"           // MOV   qword ptr [RAX + local_res20]
+    "4C 89 40 18"           // MOV   qword ptr [RAX + local_res18]
+    "48 89 50 10"           // MOV   qword ptr [RAX + local_res10]
+    "48 89 48 08"           // MOV   qword ptr [RAX + local_res8]
+    "53"                    // PUSH  RBX
+    "56"                    // PUSH  RSI
+    "57"                    // PUSH  RDI
+    "48 81 EC 10 01 00 00"  // SUB   RSP,0x110
+};
+
+inline constexpr Pattern<46> SIG_GET_EXPORT_PATH_NAME{
+    "48 8B C4"                 // MOV   RAX,RSP
+    "4C 89 48 20"              // MOV   qword ptr [RAX + local_res20]
+    "48 89 50 10"              // MOV   qword ptr [RAX + local_res10]
+    "48 89 48 08"              // MOV   qword ptr [RAX + local_res8]
+    "55"                       // PUSH  RBP
+    "56"                       // PUSH  RSI
+    "57"                       // PUSH  RDI
+    "41 54"                    // PUSH  R12
+    "41 55"                    // PUSH  R13
+    "41 56"                    // PUSH  R14
+    "41 57"                    // PUSH  R15
+    "48 8D 6C 24 B0"           // LEA   RBP=>local_88,[RSP + -0x50]
+    "48 81 EC 50 01 00 00"     // SUB   RSP,0x150
+    "48 C7 45 30 FE FF FF FF"  // MOV   qword ptr [RBP + local_58],-0x2
+};
+
+// Unlike the other patterns, this is only searched for near the start of each of the base object's
+// virtual functions, see `gc::impl::find_begin_destroy`, so it needn't be unique in the whole exe.
+// Matches `ExitProperties(this, Class)` followed by `SetLinker(nullptr, INDEX_NONE)`.
+inline constexpr Pattern<22> BEGIN_DESTROY_SIG{
+    "48 8B 53 ??"  // MOV   RDX,qword ptr [RBX + 0x48]
+    "48 8B CB"     // MOV   RCX,RBX
+    "E8 ????????"  // CALL  ExitProperties
+    "41 83 C8 FF"  // OR    R8D,0xffffffff
+    "33 D2"        // XOR   EDX,EDX
+    "48 8B CB"     // MOV   RCX,RBX
+    "E8"           // CALL  UObject::SetLinker
+};
+
+}  // namespace unrealsdk::game::bl1e::patterns
+
+#endif /* UNREALSDK_GAME_BL1E_PATTERNS_H */
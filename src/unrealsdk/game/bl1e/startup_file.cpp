@@ -3,6 +3,7 @@
 #include "unrealsdk/config.h"
 #include "unrealsdk/game/bl1e/bl1e.h"
 #include "unrealsdk/game/bl1e/offsets.h"
+#include "unrealsdk/game/bl1e/patterns.h"
 #include "unrealsdk/logging.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/classes/uobject.h"
@@ -13,6 +14,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl1e::patterns;
 
 namespace unrealsdk::game {
 
@@ -30,18 +32,6 @@ void hook_for_startup_bypass(void);
 using load_package_func = UObject* (*)(const UObject* outer, const wchar_t* name, uint32_t flags);
 load_package_func load_package_ptr;
 
-constexpr Pattern<22> SIG_LOAD_PACKAGE{
-    "48 8B C4"     // MOV   RAX,RSP
-    "44 89 40 18"  // MOV   dword ptr [RAX + local_res18],LoadFlags
-    "48 89 48 08"  // MOV   qword ptr [RAX + local_res8],InOuter
-    "53"           // PUSH  RBX
-    "56"           // PUSH  RSI
-    "57"           // PUSH  RDI
-    "41 56"        // PUSH  R14
-    "41 57"        // PUSH  R15
-    "48 83 EC 60"  // SUB   RSP,0x60
-};
-
 UObject* load_package_hook(const UObject* outer, const wchar_t* name, uint32_t flags) {
     static auto bypass_startup_file =
         config::get_bool("unrealsdk.bypass_startup_file").value_or(false);
@@ -161,53 +151,6 @@ UNREALSDK_UNREAL_STRUCT_PADDING_POP()
 // | SIGNATURES |
 ////////////////////////////////////////////////////////////////////////////////
 
-constexpr Pattern<47> SIG_CREATE_EXPORT{
-    "89 54 24 10"              // MOV   dword ptr [RSP + local_res10]
-    "48 89 4C 24 08"           // MOV   qword ptr [RSP + local_res8]
-    "55"                       // PUSH  RBP
-    "53"                       // PUSH  RBX
-    "56"                       // PUSH  RSI
-    "57"                       // PUSH  RDI
-    "41 54"                    // PUSH  R12
-    "41 55"                    // PUSH  R13
-    "41 56"                    // PUSH  R14
-    "41 57"                    // PUSH  R15
-    "48 8D 6C 24 E1"           // LEA   RBP=>local_5f,[RSP + -0x1f]
-    "48 81 EC C8 00 00 00"     // SUB   RSP,0xc8
-    "48 C7 45 07 FE FF FF FF"  // MOV   qword ptr [RBP + local_58],-0x2
-    "44 8B F2"                 // MOV   R14D,Index
-    "4C 8B E9"                 // MOV   R13,this
-};
-
-constexpr Pattern<29> SIG_STATIC_LOAD_OBJECT{
-    "48 8B C4"              // MOV   RAX,RSP
-    "4C 89 48 20"           // MOV   qword ptr [RAX + local_res20]
-    "4C 89 40 18"           // MOV   qword ptr [RAX + local_res18]
-    "48 89 50 10"           // MOV   qword ptr [RAX + local_res10]
-    "48 89 48 08"           // MOV   qword ptr [RAX + local_res8]
-    "53"                    // PUSH  RBX
-    "56"                    // PUSH  RSI
-    "57"                    // PUSH  RDI
-    "48 81 EC 10 01 00 00"  // SUB   RSP,0x110
-};
-
-constexpr Pattern<46> SIG_GET_EXPORT_PATH_NAME{
-    "48 8B C4"                 // MOV   RAX,RSP
-    "4C 89 48 20"              // MOV   qword ptr [RAX + local_res20]
-    "48 89 50 10"              // MOV   qword ptr [RAX + local_res10]
-    "48 89 48 08"              // MOV   qword ptr [RAX + local_res8]
-    "55"                       // PUSH  RBP
-    "56"                       // PUSH  RSI
-    "57"                       // PUSH  RDI
-    "41 54"                    // PUSH  R12
-    "41 55"                    // PUSH  R13
-    "41 56"                    // PUSH  R14
-    "41 57"                    // PUSH  R15
-    "48 8D 6C 24 B0"           // LEA   RBP=>local_88,[RSP + -0x50]
-    "48 81 EC 50 01 00 00"     // SUB   RSP,0x150
-    "48 C7 45 30 FE FF FF FF"  // MOV   qword ptr [RBP + local_58],-0x2
-};
-
 // NOLINTBEGIN(readability-identifier-naming)
 using create_export_func = UObject* (*)(ULinkerLoad * self, int32_t index);
 create_export_func create_export_ptr{nullptr};
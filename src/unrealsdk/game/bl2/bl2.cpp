@@ -1,6 +1,8 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/game/bl2/bl2.h"
+#include "unrealsdk/game/bl2/patterns.h"
+#include "unrealsdk/game/startup_graph.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/structs/fframe.h"
@@ -13,33 +15,45 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl2::patterns;
 
 namespace unrealsdk::game {
 
 void BL2Hook::hook(void) {
-    // Make sure to do antidebug asap
-    hook_antidebug();
-
-    hook_process_event();
-    hook_call_function();
-
-    find_gobjects();
-    find_gnames();
-    find_fname_init();
-    find_fframe_step();
-    find_gmalloc();
-    find_construct_object();
-    find_get_path_name();
-    find_static_find_object();
-    find_load_package();
-
-    hexedit_set_command();
-    hexedit_array_limit();
-    hexedit_array_limit_message();
+    StartupGraph graph{};
+
+    // Make sure to do antidebug asap, everything else is independent
+    graph.add("hook_antidebug", hook_antidebug);
+
+    graph.add("hook_process_event", hook_process_event, {"hook_antidebug"})
+        .add("hook_call_function", hook_call_function, {"hook_antidebug"});
+
+    graph.add("find_gobjects", find_gobjects, {"hook_antidebug"})
+        .add("find_gnames", find_gnames, {"hook_antidebug"})
+        .add("find_fname_init", [this]() { this->find_fname_init(); }, {"hook_antidebug"})
+        .add("find_fframe_step", find_fframe_step, {"hook_antidebug"})
+        .add("find_gmalloc", find_gmalloc, {"hook_antidebug"})
+        .add("find_get_path_name", find_get_path_name, {"hook_antidebug"});
+
+    // Detours and hex edits both change page protections, and restore them afterwards. If they
+    // touch the same page at the same time, one may restore it to read only while the other is
+    // still writing, so keep them apart.
+    graph.add(
+        "hexedit", [this]() { this->hexedit(); }, {"hook_process_event", "hook_call_function"});
+
+    graph.run();
 }
 
 void BL2Hook::post_init(void) {
     inject_console();
+    hook_begin_destroy();
+
+    // These natives are resolved on first use, but may as well get them ready in the background
+    StartupGraph{}
+        .add("find_construct_object", find_construct_object)
+        .add("find_static_find_object", find_static_find_object)
+        .add("find_load_package", find_load_package)
+        .run_in_background();
 }
 
 #ifdef __MINGW32__
@@ -51,16 +65,6 @@ void BL2Hook::post_init(void) {
 
 namespace {
 
-const constinit Pattern<23> FNAME_INIT_SIG{
-    "55"              // push ebp
-    "8B EC"           // mov ebp, esp
-    "6A FF"           // push -01
-    "68 ????????"     // push Borderlands2.exe+110298B
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "81 EC 9C0C0000"  // sub esp, 00000C9C
-};
-
 }
 
 void BL2Hook::find_fname_init(void) {
@@ -86,13 +90,6 @@ namespace {
 typedef void(__thiscall* fframe_step_func)(FFrame* stack, UObject* obj, void* param);
 fframe_step_func fframe_step_ptr;
 
-const constinit Pattern<9> FFRAME_STEP_SIG{
-    "55"        // push ebp
-    "8B EC"     // mov ebp, esp
-    "8B 41 ??"  // mov eax, [ecx+18]
-    "0FB6 10"   // movzx edx, byte ptr [eax]
-};
-
 }  // namespace
 
 void BL2Hook::find_fframe_step(void) {
@@ -4,6 +4,7 @@
 #include "unrealsdk/config.h"
 #include "unrealsdk/game/bl2/bl2.h"
 #include "unrealsdk/hook_manager.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/unreal/classes/uclass.h"
 #include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/classes/uobject.h"
@@ -286,6 +287,7 @@ bool inject_console_hook(hook_manager::Details& hook) {
 }  // namespace
 
 void BL2Hook::inject_console(void) {
+    const profiling::ScopedTimer timer{"inject_console", "startup"};
     hook_manager::add_hook(SAY_BYPASS_FUNC, SAY_BYPASS_TYPE, SAY_BYPASS_ID, &say_bypass_hook);
     hook_manager::add_hook(SAY_CRASH_FIX_FUNC, SAY_CRASH_FIX_TYPE, SAY_CRASH_FIX_ID,
                            &say_crash_fix_hook);
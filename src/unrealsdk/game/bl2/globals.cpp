@@ -2,6 +2,7 @@
 
 #include "unrealsdk/game/bl2/bl2.h"
 #include "unrealsdk/game/bl2/offsets.h"
+#include "unrealsdk/game/bl2/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/structs/gnames.h"
 #include "unrealsdk/unreal/wrappers/gobjects.h"
@@ -10,6 +11,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl2::patterns;
 
 namespace unrealsdk::game {
 
@@ -17,13 +19,6 @@ namespace {
 
 GObjects gobjects_wrapper{};
 
-const constinit Pattern<17> GOBJECTS_SIG{
-    "8B 0D {????????}"  // mov ecx, [Borderlands2.exe+1682BD0]
-    "8B 04 ??"          // mov eax, [ecx+esi*4]
-    "8B 40 ??"          // mov eax, [eax+08]
-    "25 00020000"       // and eax, 00000200
-};
-
 }  // namespace
 
 void BL2Hook::find_gobjects(void) {
@@ -39,11 +34,6 @@ const GObjects& BL2Hook::gobjects(void) const {
 
 namespace {
 
-const constinit Pattern<10> GNAMES_SIG{
-    "A3 {????????}"  // mov [BorderlandsPreSequel.exe+1520214], eax
-    "8B 45 ??"       // mov eax, [ebp+10]
-    "89 03"          // mov [ebx], eax
-};
 TArray<bl2::FNameEntry*>* gnames_ptr;
 
 }  // namespace
@@ -62,6 +52,26 @@ void BL2Hook::find_gnames(void) {
     return std::string_view{&entry->Name.Ansi[0]};
 }
 
+size_t BL2Hook::fname_iterate(size_t start,
+                              const std::function<void(uint32_t)>& callback,
+                              const std::function<void(uint32_t)>& empty_callback) const {
+    auto count = gnames_ptr->size();
+    for (auto idx = start; idx < count; idx++) {
+        // Unused slots are left null - but so are slots which have been added to the array, and
+        // which are yet to have their entry written
+        if (gnames_ptr->at(idx) != nullptr) {
+            callback(static_cast<uint32_t>(idx));
+        } else {
+            empty_callback(static_cast<uint32_t>(idx));
+        }
+    }
+    return std::max(start, count);
+}
+
+bool BL2Hook::fname_is_filled(uint32_t idx) const {
+    return gnames_ptr->at(idx) != nullptr;
+}
+
 }  // namespace unrealsdk::game
 
 #endif
@@ -1,90 +1,39 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/game/bl2/bl2.h"
+#include "unrealsdk/game/bl2/patterns.h"
 #include "unrealsdk/memory.h"
+#include "unrealsdk/patch_set.h"
 
 #if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW && !defined(UNREALSDK_IMPORTING)
 
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl2::patterns;
 
 namespace unrealsdk::game {
 
 namespace {
 
-const constinit Pattern<28> SET_COMMAND_SIG{
-    "75 ??"           // jne Borderlands2.exe+43019D
-    "6A 01"           // push 01
-    "8D 95 ????????"  // lea edx, [ebp-00000888]
-    "68 ????????"     // push Borderlands2.exe+1265EE0
-    "52"              // push edx
-    "E8 ????????"     // call Borderlands2.exe+99350
-    "83 C4 0C"        // add esp, 0C
-    "85 C0"           // test eax, eax
-    "74 ??"           // je Borderlands2.exe+4301C6
-};
-
-const constinit Pattern<9> ARRAY_LIMIT_SIG{
-    "7E ??"        // jle Borderlands2.exe+C9ABB
-    "B9 64000000"  // mov ecx, 00000064
-    "3B F9"        // cmp edi, ecx
-};
-
-const constinit Pattern<15> ARRAY_LIMIT_MESSAGE{
-    // Explicitly match the jump offset, since to overwrite this with an unconditional jump we need
-    // to move where it takes place, hardcoding our own offset
-    "0F 8C 7B000000"  // jl Borderlands2.exe+C9BF0
-    "8B 8D ????????"  // mov ecx, [ebp-00001164]
-    "83 C0 9D"        // add eax, -63
-};
+// NOLINTBEGIN(readability-magic-numbers)
+const constexpr std::array<uint8_t, 2> SET_COMMAND_PATCH{0x90, 0x90};
+const constexpr std::array<uint8_t, 1> ARRAY_LIMIT_PATCH{0xEB};
+const constexpr std::array<uint8_t, 6> ARRAY_LIMIT_MESSAGE_PATCH{0xEB, 0x7F, 0x90, 0x90, 0x90,
+                                                                 0x90};
+// NOLINTEND(readability-magic-numbers)
 
 }  // namespace
 
-void BL2Hook::hexedit_set_command(void) {
-    auto set_command = SET_COMMAND_SIG.sigscan_nullable<uint8_t*>();
-    if (set_command == nullptr) {
-        LOG(ERROR, "Couldn't find set command signature");
-    } else {
-        LOG(MISC, "Set Command: {:p}", reinterpret_cast<void*>(set_command));
-
-        // NOLINTBEGIN(readability-magic-numbers)
-        unlock_range(set_command, 2);
-        set_command[0] = 0x90;
-        set_command[1] = 0x90;
-        // NOLINTEND(readability-magic-numbers)
-    }
+memory::PatchSpec BL2Hook::array_limit_message_patch(void) const {
+    return {"Array Limit Message", ARRAY_LIMIT_MESSAGE, ARRAY_LIMIT_MESSAGE_PATCH};
 }
 
-void BL2Hook::hexedit_array_limit(void) {
-    auto array_limit = ARRAY_LIMIT_SIG.sigscan_nullable<uint8_t*>();
-    if (array_limit == nullptr) {
-        LOG(ERROR, "Couldn't find array limit signature");
-    } else {
-        LOG(MISC, "Array Limit: {:p}", reinterpret_cast<void*>(array_limit));
-
-        // NOLINTBEGIN(readability-magic-numbers)
-        unlock_range(array_limit, 1);
-        array_limit[0] = 0xEB;
-        // NOLINTEND(readability-magic-numbers)
-    }
-}
-
-void BL2Hook::hexedit_array_limit_message(void) const {
-    auto array_limit_msg = ARRAY_LIMIT_MESSAGE.sigscan_nullable<uint8_t*>();
-    if (array_limit_msg == nullptr) {
-        LOG(ERROR, "Couldn't find array limit message signature");
-    } else {
-        LOG(MISC, "Array Limit Message: {:p}", reinterpret_cast<void*>(array_limit_msg));
-
-        // NOLINTBEGIN(readability-magic-numbers)
-        unlock_range(array_limit_msg, 6);
-        array_limit_msg[0] = 0xEB;
-        array_limit_msg[1] = 0x7F;
-        array_limit_msg[2] = 0x90;
-        array_limit_msg[3] = 0x90;
-        array_limit_msg[4] = 0x90;
-        array_limit_msg[5] = 0x90;
-        // NOLINTEND(readability-magic-numbers)
-    }
+void BL2Hook::hexedit(void) {
+    this->hexedits = PatchSet{
+        {"Set Command", SET_COMMAND_SIG, SET_COMMAND_PATCH},
+        {"Array Limit", ARRAY_LIMIT_SIG, ARRAY_LIMIT_PATCH},
+        this->array_limit_message_patch(),
+    };
+    this->hexedits.apply();
 }
 
 }  // namespace unrealsdk::game
@@ -2,6 +2,8 @@
 
 #include "unrealsdk/config.h"
 #include "unrealsdk/game/bl2/bl2.h"
+#include "unrealsdk/game/bl2/patterns.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/locks.h"
 #include "unrealsdk/memory.h"
@@ -20,6 +22,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl2::patterns;
 
 namespace unrealsdk::game {
 
@@ -35,26 +38,6 @@ typedef void(__fastcall* process_event_func)(UObject* obj,
                                              void* /*null*/);
 process_event_func process_event_ptr;
 
-const constinit Pattern<45> PROCESS_EVENT_SIG{
-    "55"              // push ebp
-    "8B EC"           // mov ebp, esp
-    "6A FF"           // push -01
-    "68 ????????"     // push Borderlands2.exe+11107D8
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "83 EC 50"        // sub esp, 50
-    "A1 ????????"     // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
-    "33 C5"           // xor eax,ebp
-    "89 45 ??"        // mov [ebp-10], eax
-    "53"              // push ebx
-    "56"              // push esi
-    "57"              // push edi
-    "50"              // push eax
-    "8D 45 ??"        // lea eax, [ebp-0C]
-    "64 A3 ????????"  // mov fs:[00000000], eax
-    "8B F1"           // mov esi, ecx
-};
-
 void __fastcall process_event_hook(UObject* obj,
                                    void* edx,
                                    UFunction* func,
@@ -99,6 +82,7 @@ void __fastcall process_event_hook(UObject* obj,
 
             if (!block_execution) {
                 hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL,
@@ -152,28 +136,6 @@ typedef void(__fastcall* call_function_func)(UObject* obj,
                                              UFunction* func);
 call_function_func call_function_ptr;
 
-const constinit Pattern<55> CALL_FUNCTION_SIG{
-    "55"              // push ebp
-    "8B EC"           // mov ebp, esp
-    "6A FF"           // push -01
-    "68 ????????"     // push BorderlandsPreSequel.exe+108D4B6
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "81 EC ????????"  // sub esp, 000000A4
-    "A1 ????????"     // mov eax, [BorderlandsPreSequel.g_LEngineDefaultPoolId+D2FC]
-    "33 C5"           // xor eax, ebp
-    "89 45 ??"        // mov [ebp-10], eax
-    "53"              // push ebx
-    "56"              // push esi
-    "57"              // push edi
-    "50"              // push eax
-    "8D 45 ??"        // lea eax, [ebp-0C]
-    "64 A3 ????????"  // mov fs:[00000000], eax
-    "8B 7D ??"        // mov edi, [ebp+08]
-    "8B 45 ??"        // mov eax, [ebp+14]
-    "8B 5D ??"        // mov ebx, [ebp+0C]
-};
-
 void __fastcall call_function_hook(UObject* obj,
                                    void* edx,
                                    FFrame* stack,
@@ -217,6 +179,7 @@ void __fastcall call_function_hook(UObject* obj,
 
             if (!block_execution) {
                 hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL,
@@ -253,6 +216,34 @@ void BL2Hook::hook_call_function(void) {
            &call_function_ptr, "CallFunction");
 }
 
+namespace {
+
+// NOLINTNEXTLINE(modernize-use-using)
+typedef void(__fastcall* begin_destroy_func)(UObject* obj, void* /*edx*/);
+begin_destroy_func begin_destroy_ptr;
+
+void __fastcall begin_destroy_hook(UObject* obj, void* edx) {
+    try {
+        gc::impl::object_destroyed(obj);
+    } catch (const std::exception& ex) {
+        LOG(ERROR, "An exception occurred during the BeginDestroy hook: {}", ex.what());
+    }
+
+    begin_destroy_ptr(obj, edx);
+}
+
+static_assert(std::is_same_v<decltype(&begin_destroy_hook), begin_destroy_func>,
+              "begin_destroy signature is incorrect");
+
+}  // namespace
+
+void BL2Hook::hook_begin_destroy(void) {
+    auto addr = gc::impl::find_begin_destroy(BEGIN_DESTROY_SIG);
+    if (addr != 0 && detour(addr, begin_destroy_hook, &begin_destroy_ptr, "BeginDestroy")) {
+        gc::impl::start_tracking();
+    }
+}
+
 }  // namespace unrealsdk::game
 
 #endif
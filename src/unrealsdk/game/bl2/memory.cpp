@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/game/bl2/bl2.h"
+#include "unrealsdk/game/bl2/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/alignment.h"
 
@@ -8,6 +9,7 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl2::patterns;
 
 namespace unrealsdk::game {
 
@@ -35,11 +37,6 @@ struct FMalloc {
 
 FMalloc* gmalloc;
 
-const constinit Pattern<8> GMALLOC_PATTERN{
-    "89 35 {????????}"  // mov [Borderlands2.GDebugger+A95C], esi
-    "FF D7"             // call edi
-};
-
 }  // namespace
 
 void BL2Hook::find_gmalloc(void) {
@@ -1,5 +1,7 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl2/bl2.h"
+#include "unrealsdk/game/bl2/patterns.h"
+#include "unrealsdk/game/lazy_native.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/classes/uclass.h"
@@ -16,6 +18,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl2::patterns;
 
 namespace unrealsdk::game {
 
@@ -32,33 +35,14 @@ typedef UObject*(__cdecl* construct_obj_func)(UClass* cls,
                                               void* error_output_device,
                                               void* instance_graph,
                                               uint32_t assume_template_is_archetype);
-construct_obj_func construct_obj_ptr;
-
-const constinit Pattern<49> CONSTRUCT_OBJECT_PATTERN{
-    "55"              // push ebp
-    "8B EC"           // mov ebp, esp
-    "6A FF"           // push -01
-    "68 ????????"     // push Borderlands2.exe+1107DCB
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "83 EC 10"        // sub esp, 10
-    "53"              // push ebx
-    "56"              // push esi
-    "57"              // push edi
-    "A1 ????????"     // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
-    "33 C5"           // xor eax, ebp
-    "50"              // push eax
-    "8D 45 ??"        // lea eax, [ebp-0C]
-    "64 A3 ????????"  // mov fs:[00000000], eax
-    "8B 7D ??"        // mov edi, [ebp+08]
-    "8A 87 ????????"  // mov al, [edi+000001CC]
-};
+
+LazyNative<construct_obj_func> construct_obj_ptr{"StaticConstructObject",
+                                                 CONSTRUCT_OBJECT_PATTERN};
 
 }  // namespace
 
 void BL2Hook::find_construct_object(void) {
-    construct_obj_ptr = CONSTRUCT_OBJECT_PATTERN.sigscan_nullable<construct_obj_func>();
-    LOG(MISC, "StaticConstructObject: {:p}", reinterpret_cast<void*>(construct_obj_ptr));
+    construct_obj_ptr.resolve();
 }
 
 UObject* BL2Hook::construct_object(UClass* cls,
@@ -97,17 +81,6 @@ typedef void(__thiscall* get_path_name_func)(const UObject* self,
 
 get_path_name_func get_path_name_ptr;
 
-const constinit Pattern<15> GET_PATH_NAME_PATTERN{
-    "55"        // push ebp
-    "8B EC"     // mov ebp, esp
-    "8B 45 ??"  // mov eax, [ebp+08]
-    "56"        // push esi
-    "8B F1"     // mov esi, ecx
-    "3B F0"     // cmp esi, eax
-    "74 ??"     // je Borderlands2.exe+ADB04
-    "85 F6"     // test esi, esi
-};
-
 }  // namespace
 
 void BL2Hook::find_get_path_name(void) {
@@ -136,33 +109,13 @@ typedef UObject*(__cdecl* static_find_object_func)(const UClass* cls,
                                                    const wchar_t* str,
                                                    uint32_t exact_class);
 
-static_find_object_func static_find_object_ptr;
-const constinit Pattern<56> STATIC_FIND_OBJECT_PATTERN{
-    "55"                 // push ebp
-    "8B EC"              // mov ebp, esp
-    "6A FF"              // push -01
-    "68 ????????"        // push Borderlands2.exe+1106400
-    "64 A1 ????????"     // mov eax, fs:[00000000]
-    "50"                 // push eax
-    "83 EC 24"           // sub esp, 24
-    "53"                 // push ebx
-    "56"                 // push esi
-    "57"                 // push edi
-    "A1 ????????"        // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
-    "33 C5"              // xor eax, ebp
-    "50"                 // push eax
-    "8D 45 ??"           // lea eax, [ebp-0C]
-    "64 A3 ????????"     // mov fs:[00000000], eax
-    "83 3D ???????? 00"  // cmp dword ptr [Borderlands2.exe+1682B14], 00
-    "75 ??"              // jne Borderlands2.GetOutermost+429A
-    "83 3D ???????? 00"  // cmp dword ptr [Borderlands2.exe+15E801C], 00
-};
+LazyNative<static_find_object_func> static_find_object_ptr{"StaticFindObject",
+                                                           STATIC_FIND_OBJECT_PATTERN};
 
 }  // namespace
 
 void BL2Hook::find_static_find_object(void) {
-    static_find_object_ptr = STATIC_FIND_OBJECT_PATTERN.sigscan_nullable<static_find_object_func>();
-    LOG(MISC, "StaticFindObject: {:p}", reinterpret_cast<void*>(static_find_object_ptr));
+    static_find_object_ptr.resolve();
 }
 
 UObject* BL2Hook::find_object(UClass* cls, const std::wstring& name) const {
@@ -176,33 +129,13 @@ UObject* BL2Hook::find_object(UClass* cls, const std::wstring& name) const {
 namespace {
 
 using load_package_func = UObject* (*)(const UObject* outer, const wchar_t* name, uint32_t flags);
-load_package_func load_package_ptr;
-
-const constinit Pattern<46> LOAD_PACKAGE_PATTERN{
-    "55"              // push ebp
-    "8B EC"           // mov ebp, esp
-    "6A FF"           // push -01
-    "68 ????????"     // push Borderlands2.exe+1108180
-    "64 A1 ????????"  // mov eax, fs:[00000000]
-    "50"              // push eax
-    "83 EC 68"        // sub esp, 68
-    "A1 ????????"     // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
-    "33 C5"           // xor eax, ebp
-    "89 45 ??"        // mov [ebp-14], eax
-    "53"              // push ebx
-    "56"              // push esi
-    "57"              // push edi
-    "50"              // push eax
-    "8D 45 ??"        // lea eax, [ebp-0C]
-    "64 A3 ????????"  // mov fs:[00000000], eax
-    "89 65 ??"        // mov [ebp-10], esp
-};
+
+LazyNative<load_package_func> load_package_ptr{"LoadPackage", LOAD_PACKAGE_PATTERN};
 
 }  // namespace
 
 void BL2Hook::find_load_package(void) {
-    load_package_ptr = LOAD_PACKAGE_PATTERN.sigscan_nullable<load_package_func>();
-    LOG(MISC, "LoadPackage: {:p}", reinterpret_cast<void*>(load_package_ptr));
+    load_package_ptr.resolve();
 }
 
 [[nodiscard]] UObject* BL2Hook::load_package(const std::wstring& name, uint32_t flags) const {
@@ -0,0 +1,24 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/game/bl2/patterns.h"
+
+// Unlike the rest of the game hooks, this isn't limited to the current flavour, so that offline
+// tools may validate every game's patterns at once
+namespace unrealsdk::game::bl2::patterns {
+
+UNREALSDK_REGISTER_PATTERN("bl2", FNAME_INIT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", FFRAME_STEP_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", GOBJECTS_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", GNAMES_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", SET_COMMAND_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", ARRAY_LIMIT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", ARRAY_LIMIT_MESSAGE);
+UNREALSDK_REGISTER_PATTERN("bl2", PROCESS_EVENT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", CALL_FUNCTION_SIG);
+UNREALSDK_REGISTER_PATTERN("bl2", GMALLOC_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl2", CONSTRUCT_OBJECT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl2", GET_PATH_NAME_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl2", STATIC_FIND_OBJECT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl2", LOAD_PACKAGE_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl2", BEGIN_DESTROY_SIG);
+
+}  // namespace unrealsdk::game::bl2::patterns
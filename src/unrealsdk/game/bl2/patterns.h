@@ -0,0 +1,204 @@
+#ifndef UNREALSDK_GAME_BL2_PATTERNS_H
+#define UNREALSDK_GAME_BL2_PATTERNS_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the patterns can be validated offline, on any platform, without the rest of the sdk.
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::game::bl2::patterns {
+
+using unrealsdk::memory::Pattern;
+
+inline constexpr Pattern<23> FNAME_INIT_SIG{
+    "55"              // push ebp
+    "8B EC"           // mov ebp, esp
+    "6A FF"           // push -01
+    "68 ????????"     // push Borderlands2.exe+110298B
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "81 EC 9C0C0000"  // sub esp, 00000C9C
+};
+
+inline constexpr Pattern<9> FFRAME_STEP_SIG{
+    "55"        // push ebp
+    "8B EC"     // mov ebp, esp
+    "8B 41 ??"  // mov eax, [ecx+18]
+    "0FB6 10"   // movzx edx, byte ptr [eax]
+};
+
+inline constexpr Pattern<17> GOBJECTS_SIG{
+    "8B 0D {????????}"  // mov ecx, [Borderlands2.exe+1682BD0]
+    "8B 04 ??"          // mov eax, [ecx+esi*4]
+    "8B 40 ??"          // mov eax, [eax+08]
+    "25 00020000"       // and eax, 00000200
+};
+
+inline constexpr Pattern<10> GNAMES_SIG{
+    "A3 {????????}"  // mov [BorderlandsPreSequel.exe+1520214], eax
+    "8B 45 ??"       // mov eax, [ebp+10]
+    "89 03"          // mov [ebx], eax
+};
+
+inline constexpr Pattern<28> SET_COMMAND_SIG{
+    "75 ??"           // jne Borderlands2.exe+43019D
+    "6A 01"           // push 01
+    "8D 95 ????????"  // lea edx, [ebp-00000888]
+    "68 ????????"     // push Borderlands2.exe+1265EE0
+    "52"              // push edx
+    "E8 ????????"     // call Borderlands2.exe+99350
+    "83 C4 0C"        // add esp, 0C
+    "85 C0"           // test eax, eax
+    "74 ??"           // je Borderlands2.exe+4301C6
+};
+
+inline constexpr Pattern<9> ARRAY_LIMIT_SIG{
+    "7E ??"        // jle Borderlands2.exe+C9ABB
+    "B9 64000000"  // mov ecx, 00000064
+    "3B F9"        // cmp edi, ecx
+};
+
+inline constexpr Pattern<15> ARRAY_LIMIT_MESSAGE{
+    // Explicitly match the jump offset, since to overwrite this with an unconditional jump we need
+    // to move where it takes place, hardcoding our own offset
+    "0F 8C 7B000000"  // jl Borderlands2.exe+C9BF0
+    "8B 8D ????????"  // mov ecx, [ebp-00001164]
+    "83 C0 9D"        // add eax, -63
+};
+
+inline constexpr Pattern<45> PROCESS_EVENT_SIG{
+    "55"              // push ebp
+    "8B EC"           // mov ebp, esp
+    "6A FF"           // push -01
+    "68 ????????"     // push Borderlands2.exe+11107D8
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "83 EC 50"        // sub esp, 50
+    "A1 ????????"     // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
+    "33 C5"           // xor eax,ebp
+    "89 45 ??"        // mov [ebp-10], eax
+    "53"              // push ebx
+    "56"              // push esi
+    "57"              // push edi
+    "50"              // push eax
+    "8D 45 ??"        // lea eax, [ebp-0C]
+    "64 A3 ????????"  // mov fs:[00000000], eax
+    "8B F1"           // mov esi, ecx
+};
+
+inline constexpr Pattern<55> CALL_FUNCTION_SIG{
+    "55"              // push ebp
+    "8B EC"           // mov ebp, esp
+    "6A FF"           // push -01
+    "68 ????????"     // push BorderlandsPreSequel.exe+108D4B6
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "81 EC ????????"  // sub esp, 000000A4
+    "A1 ????????"     // mov eax, [BorderlandsPreSequel.g_LEngineDefaultPoolId+D2FC]
+    "33 C5"           // xor eax, ebp
+    "89 45 ??"        // mov [ebp-10], eax
+    "53"              // push ebx
+    "56"              // push esi
+    "57"              // push edi
+    "50"              // push eax
+    "8D 45 ??"        // lea eax, [ebp-0C]
+    "64 A3 ????????"  // mov fs:[00000000], eax
+    "8B 7D ??"        // mov edi, [ebp+08]
+    "8B 45 ??"        // mov eax, [ebp+14]
+    "8B 5D ??"        // mov ebx, [ebp+0C]
+};
+
+inline constexpr Pattern<8> GMALLOC_PATTERN{
+    "89 35 {????????}"  // mov [Borderlands2.GDebugger+A95C], esi
+    "FF D7"             // call edi
+};
+
+inline constexpr Pattern<49> CONSTRUCT_OBJECT_PATTERN{
+    "55"              // push ebp
+    "8B EC"           // mov ebp, esp
+    "6A FF"           // push -01
+    "68 ????????"     // push Borderlands2.exe+1107DCB
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "83 EC 10"        // sub esp, 10
+    "53"              // push ebx
+    "56"              // push esi
+    "57"              // push edi
+    "A1 ????????"     // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
+    "33 C5"           // xor eax, ebp
+    "50"              // push eax
+    "8D 45 ??"        // lea eax, [ebp-0C]
+    "64 A3 ????????"  // mov fs:[00000000], eax
+    "8B 7D ??"        // mov edi, [ebp+08]
+    "8A 87 ????????"  // mov al, [edi+000001CC]
+};
+
+inline constexpr Pattern<15> GET_PATH_NAME_PATTERN{
+    "55"        // push ebp
+    "8B EC"     // mov ebp, esp
+    "8B 45 ??"  // mov eax, [ebp+08]
+    "56"        // push esi
+    "8B F1"     // mov esi, ecx
+    "3B F0"     // cmp esi, eax
+    "74 ??"     // je Borderlands2.exe+ADB04
+    "85 F6"     // test esi, esi
+};
+
+inline constexpr Pattern<56> STATIC_FIND_OBJECT_PATTERN{
+    "55"                 // push ebp
+    "8B EC"              // mov ebp, esp
+    "6A FF"              // push -01
+    "68 ????????"        // push Borderlands2.exe+1106400
+    "64 A1 ????????"     // mov eax, fs:[00000000]
+    "50"                 // push eax
+    "83 EC 24"           // sub esp, 24
+    "53"                 // push ebx
+    "56"                 // push esi
+    "57"                 // push edi
+    "A1 ????????"        // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
+    "33 C5"              // xor eax, ebp
+    "50"                 // push eax
+    "8D 45 ??"           // lea eax, [ebp-0C]
+    "64 A3 ????????"     // mov fs:[00000000], eax
+    "83 3D ???????? 00"  // cmp dword ptr [Borderlands2.exe+1682B14], 00
+    "75 ??"              // jne Borderlands2.GetOutermost+429A
+    "83 3D ???????? 00"  // cmp dword ptr [Borderlands2.exe+15E801C], 00
+};
+
+inline constexpr Pattern<46> LOAD_PACKAGE_PATTERN{
+    "55"              // push ebp
+    "8B EC"           // mov ebp, esp
+    "6A FF"           // push -01
+    "68 ????????"     // push Borderlands2.exe+1108180
+    "64 A1 ????????"  // mov eax, fs:[00000000]
+    "50"              // push eax
+    "83 EC 68"        // sub esp, 68
+    "A1 ????????"     // mov eax, [Borderlands2.g_LEngineDefaultPoolId+B2DC]
+    "33 C5"           // xor eax, ebp
+    "89 45 ??"        // mov [ebp-14], eax
+    "53"              // push ebx
+    "56"              // push esi
+    "57"              // push edi
+    "50"              // push eax
+    "8D 45 ??"        // lea eax, [ebp-0C]
+    "64 A3 ????????"  // mov fs:[00000000], eax
+    "89 65 ??"        // mov [ebp-10], esp
+};
+
+// Unlike the other patterns, this is only searched for near the start of each of the base object's
+// virtual functions, see `gc::impl::find_begin_destroy`, so it needn't be unique in the whole exe.
+// Matches `ExitProperties(this, Class)` followed by `SetLinker(nullptr, INDEX_NONE)`.
+inline constexpr Pattern<20> BEGIN_DESTROY_SIG{
+    "8B 46 ??"     // mov eax, [esi+34]
+    "50"           // push eax
+    "56"           // push esi
+    "E8 ????????"  // call ExitProperties
+    "83 C4 08"     // add esp, 08
+    "6A FF"        // push -01
+    "6A 00"        // push 00
+    "8B CE"        // mov ecx, esi
+    "E8"           // call UObject::SetLinker
+};
+
+}  // namespace unrealsdk::game::bl2::patterns
+
+#endif /* UNREALSDK_GAME_BL2_PATTERNS_H */
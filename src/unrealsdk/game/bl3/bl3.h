@@ -22,6 +22,12 @@ class BL3Hook : public AbstractHook {
      */
     static void hook_call_function(void);
 
+    /**
+     * @brief Hooks `UObject::BeginDestroy` and points it at the gc tracking.
+     * @note Requires unrealsdk to be initialized, so must be called during post init.
+     */
+    static void hook_begin_destroy(void);
+
     /**
      * @brief Finds GObjects, and populates the wrapper member.
      */
@@ -49,6 +55,7 @@ class BL3Hook : public AbstractHook {
 
     /**
      * @brief Finds `StaticConstructObject`, and sets up such that `construct_object` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_construct_object(void);
 
@@ -59,17 +66,20 @@ class BL3Hook : public AbstractHook {
 
     /**
      * @brief Finds `StaticFindObject`, and sets up such that `find_object` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_static_find_object(void);
 
     /**
      * @brief Finds `FText::AsCultureInvariant`, and sets up such that `ftext_as_culture_invariant`
      *        may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_ftext_as_culture_invariant(void);
 
     /**
      * @brief Finds `LoadPackage`, and sets up such that `load_package` may be called.
+     * @note Optional, the native is otherwise found the first time it's called.
      */
     static void find_load_package(void);
 
@@ -107,6 +117,10 @@ class BL3Hook : public AbstractHook {
     void fname_init(unreal::FName* name, const wchar_t* str, uint32_t number) const override;
     [[nodiscard]] std::variant<const std::string_view, const std::wstring_view> fname_get_str(
         const unreal::FName& name) const override;
+    size_t fname_iterate(size_t start,
+                         const std::function<void(uint32_t)>& callback,
+                         const std::function<void(uint32_t)>& empty_callback) const override;
+    [[nodiscard]] bool fname_is_filled(uint32_t idx) const override;
     void fframe_step(unreal::FFrame* frame, unreal::UObject* obj, void* param) const override;
     void process_event(unreal::UObject* object,
                        unreal::UFunction* func,
@@ -5,6 +5,7 @@
 #include "unrealsdk/game/bl3/bl3.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/memory.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/classes/uobject_funcs.h"
@@ -224,6 +225,7 @@ bool inject_console_hook(hook_manager::Details& hook) {
 }  // namespace
 
 void BL3Hook::inject_console(void) {
+    const profiling::ScopedTimer timer{"inject_console", "startup"};
     hook_manager::add_hook(INJECT_CONSOLE_FUNC, INJECT_CONSOLE_TYPE, INJECT_CONSOLE_ID,
                            &inject_console_hook);
 }
@@ -2,6 +2,7 @@
 
 #include "unrealsdk/game/bl3/bl3.h"
 #include "unrealsdk/game/bl3/offsets.h"
+#include "unrealsdk/game/bl3/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/structs/gnames.h"
 #include "unrealsdk/unreal/wrappers/gobjects.h"
@@ -10,6 +11,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl3::patterns;
 
 namespace unrealsdk::game {
 
@@ -17,13 +19,6 @@ namespace {
 
 GObjects gobjects_wrapper{};
 
-const constinit Pattern<26> GOBJECTS_SIG{
-    "48 8D 0D {????????}"  // lea rcx, [Borderlands3.exe+69EBDA0]
-    "C6 05 ???????? 01"    // mov byte ptr [Borderlands3.exe+69EA290], 01
-    "E8 ????????"          // call Borderlands3.exe+17854D0
-    "C6 05 ???????? 01"    // mov byte ptr [Borderlands3.exe+64B78E0], 01
-};
-
 }  // namespace
 
 void BL3Hook::find_gobjects(void) {
@@ -39,15 +34,6 @@ const GObjects& BL3Hook::gobjects(void) const {
 
 namespace {
 
-const constinit Pattern<27> GNAMES_SIG{
-    "E8 ????????"          // call Borderlands3.exe+3DDBB7C
-    "48 8B C3"             // mov rax, rbx
-    "48 89 1D {????????}"  // mov [Borderlands3.exe+69E71E8], rbx
-    "48 8B 5C 24 ??"       // mov rbx, [rsp+20]
-    "48 83 C4 28"          // add rsp, 28
-    "C3"                   // ret
-    "33 DB"                // xor ebx, ebx
-};
 TStaticIndirectArrayThreadSafeRead_FNameEntry* gnames_ptr;
 
 }  // namespace
@@ -68,6 +54,26 @@ void BL3Hook::find_gnames(void) {
     return std::string_view{&entry->Name.Ansi[0]};
 }
 
+size_t BL3Hook::fname_iterate(size_t start,
+                              const std::function<void(uint32_t)>& callback,
+                              const std::function<void(uint32_t)>& empty_callback) const {
+    auto count = static_cast<size_t>(gnames_ptr->Count);
+    for (auto idx = start; idx < count; idx++) {
+        // The count is incremented before the entry is written, so a null slot may just not have
+        // been filled in yet
+        if (gnames_ptr->at(idx) != nullptr) {
+            callback(static_cast<uint32_t>(idx));
+        } else {
+            empty_callback(static_cast<uint32_t>(idx));
+        }
+    }
+    return std::max(start, count);
+}
+
+bool BL3Hook::fname_is_filled(uint32_t idx) const {
+    return gnames_ptr->at(idx) != nullptr;
+}
+
 }  // namespace unrealsdk::game
 
 #endif
@@ -2,6 +2,8 @@
 
 #include "unrealsdk/config.h"
 #include "unrealsdk/game/bl3/bl3.h"
+#include "unrealsdk/game/bl3/patterns.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/locks.h"
 #include "unrealsdk/memory.h"
@@ -16,6 +18,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl3::patterns;
 
 namespace unrealsdk::game {
 
@@ -24,17 +27,6 @@ namespace {
 using process_event_func = void(UObject* obj, UFunction* func, void* params);
 process_event_func* process_event_ptr;
 
-const constinit Pattern<19> PROCESS_EVENT_SIG{
-    "40 55"              // push rbp
-    "56"                 // push rsi
-    "57"                 // push rdi
-    "41 54"              // push r12
-    "41 55"              // push r13
-    "41 56"              // push r14
-    "41 57"              // push r15
-    "48 81 EC F0000000"  // sub rsp, 000000F0
-};
-
 void process_event_hook(UObject* obj, UFunction* func, void* params) {
     try {
         auto data = hook_manager::impl::preprocess_hook(L"ProcessEvent", func, obj);
@@ -68,6 +60,7 @@ void process_event_hook(UObject* obj, UFunction* func, void* params) {
 
             if (!block_execution) {
                 hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL,
@@ -113,18 +106,6 @@ namespace {
 using call_function_func = void(UObject* obj, FFrame* stack, void* result, UFunction* func);
 call_function_func* call_function_ptr;
 
-const constinit Pattern<20> CALL_FUNCTION_SIG{
-    "40 55"              // push rbp
-    "53"                 // push rbx
-    "56"                 // push rsi
-    "57"                 // push rdi
-    "41 54"              // push r12
-    "41 55"              // push r13
-    "41 56"              // push r14
-    "41 57"              // push r15
-    "48 81 EC 28010000"  // sub rsp, 00000128
-};
-
 void call_function_hook(UObject* obj, FFrame* stack, void* result, UFunction* func) {
     try {
         /*
@@ -187,6 +168,7 @@ void call_function_hook(UObject* obj, FFrame* stack, void* result, UFunction* fu
 
             if (!block_execution) {
                 hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL,
@@ -219,6 +201,33 @@ void BL3Hook::hook_call_function(void) {
            &call_function_ptr, "CallFunction");
 }
 
+namespace {
+
+using begin_destroy_func = void(UObject* obj);
+begin_destroy_func* begin_destroy_ptr;
+
+void begin_destroy_hook(UObject* obj) {
+    try {
+        gc::impl::object_destroyed(obj);
+    } catch (const std::exception& ex) {
+        LOG(ERROR, "An exception occurred during the BeginDestroy hook: {}", ex.what());
+    }
+
+    begin_destroy_ptr(obj);
+}
+
+static_assert(std::is_same_v<decltype(begin_destroy_hook), begin_destroy_func>,
+              "begin_destroy signature is incorrect");
+
+}  // namespace
+
+void BL3Hook::hook_begin_destroy(void) {
+    auto addr = gc::impl::find_begin_destroy();
+    if (addr != 0 && detour(addr, begin_destroy_hook, &begin_destroy_ptr, "BeginDestroy")) {
+        gc::impl::start_tracking();
+    }
+}
+
 }  // namespace unrealsdk::game
 
 #endif
@@ -0,0 +1,25 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/game/bl3/patterns.h"
+
+// Unlike the rest of the game hooks, this isn't limited to the current flavour, so that offline
+// tools may validate every game's patterns at once
+namespace unrealsdk::game::bl3::patterns {
+
+UNREALSDK_REGISTER_PATTERN("bl3", FNAME_INIT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", FFRAME_STEP_SIG);
+UNREALSDK_REGISTER_PATTERN("bl3", FTEXT_AS_CULTURE_INVARIANT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", GOBJECTS_SIG);
+UNREALSDK_REGISTER_PATTERN("bl3", GNAMES_SIG);
+UNREALSDK_REGISTER_PATTERN("bl3", PROCESS_EVENT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl3", CALL_FUNCTION_SIG);
+UNREALSDK_REGISTER_PATTERN("bl3", MALLOC_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", REALLOC_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", FREE_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", CONSTRUCT_OBJECT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", GET_PATH_NAME_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", STATIC_FIND_OBJECT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", LOAD_PACKAGE_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", SET_SOFT_OBJ_PTR_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl3", SET_LAZY_OBJ_PTR_PATTERN);
+
+}  // namespace unrealsdk::game::bl3::patterns
@@ -0,0 +1,208 @@
+#ifndef UNREALSDK_GAME_BL3_PATTERNS_H
+#define UNREALSDK_GAME_BL3_PATTERNS_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the patterns can be validated offline, on any platform, without the rest of the sdk.
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::game::bl3::patterns {
+
+using unrealsdk::memory::Pattern;
+
+inline constexpr Pattern<15> FNAME_INIT_PATTERN{
+    "48 89 5C 24 ??"     // mov [rsp+18], rbx
+    "55"                 // push rbp
+    "56"                 // push rsi
+    "57"                 // push rdi
+    "48 81 EC 60080000"  // sub rsp, 00000860
+};
+
+inline constexpr Pattern<10> FFRAME_STEP_SIG{
+    "48 8B 41 ??"  // mov rax, [rcx+20]
+    "4C 8B D2"     // mov r10, rdx
+    "48 8B D1"     // mov rdx, rcx
+};
+
+inline constexpr Pattern<131> FTEXT_AS_CULTURE_INVARIANT_PATTERN{
+    "48 89 5C 24 ??"  // mov [rsp+08], rbx
+    "48 89 74 24 ??"  // mov [rsp+10], rsi
+    "57"              // push rdi
+    "48 83 EC 30"     // sub rsp, 30
+    "48 63 7A ??"     // movsxd rdi, dword ptr [rdx+08]
+    "33 C0"           // xor eax, eax
+    "48 8B 32"        // mov rsi, [rdx]
+    "48 8B D9"        // mov rbx, rcx
+    "48 89 44 24 ??"  // mov [rsp+20], rax
+    "89 7C 24 ??"     // mov [rsp+28], edi
+    "85 FF"           // test edi, edi
+    "75 ??"           // jne Borderlands3.exe+15F7D6E
+    "89 44 24 ??"     // mov [rsp+2C], eax
+    "EB ??"           // jmp Borderlands3.exe+15F7D90
+    "45 33 C0"        // xor r8d, r8d
+    "48 8D 4C 24 ??"  // lea rcx, [rsp+20]
+    "8B D7"           // mov edx, edi
+    "E8 ????????"     // call Borderlands3.AK::MemoryMgr::StartProfileThreadUsage+CFD0
+    "48 8B 4C 24 ??"  // mov rcx, [rsp+20]
+    "4C 8B C7"        // mov r8, rdi
+    "4D 03 C0"        // add r8, r8
+    "48 8B D6"        // mov rdx, rsi
+    "E8 ????????"     // call Borderlands3.exe+3DDBB70 { ->->VCRUNTIME140.memcpy }
+    "48 8D 54 24 ??"  // lea rdx, [rsp+20]
+    "48 8B CB"        // mov rcx, rbx
+    "E8 ????????"     // call Borderlands3.exe+15EC100
+    "48 8B 4C 24 ??"  // mov rcx, [rsp+20]
+    "48 85 C9"        // test rcx, rcx
+    "74 05"           // je Borderlands3.exe+15F7DAC
+    "E8 ????????"     // call Borderlands3.exe+15D37B0
+    "83 4B ?? 02"     // or dword ptr [rbx+10], 02
+    // Note that the actual required signature ends here
+    // Since we're so close to the end, might as well just finish the function though
+    "48 8B C3"        // mov rax, rbx
+    "48 8B 5C 24 ??"  // mov rbx, [rsp+40]
+    "48 8B 74 24 ??"  // mov rsi, [rsp+48]
+    "48 83 C4 30"     // add rsp, 30
+    "5F"              // pop rdi
+    "C3"              // ret
+};
+
+inline constexpr Pattern<26> GOBJECTS_SIG{
+    "48 8D 0D {????????}"  // lea rcx, [Borderlands3.exe+69EBDA0]
+    "C6 05 ???????? 01"    // mov byte ptr [Borderlands3.exe+69EA290], 01
+    "E8 ????????"          // call Borderlands3.exe+17854D0
+    "C6 05 ???????? 01"    // mov byte ptr [Borderlands3.exe+64B78E0], 01
+};
+
+inline constexpr Pattern<27> GNAMES_SIG{
+    "E8 ????????"          // call Borderlands3.exe+3DDBB7C
+    "48 8B C3"             // mov rax, rbx
+    "48 89 1D {????????}"  // mov [Borderlands3.exe+69E71E8], rbx
+    "48 8B 5C 24 ??"       // mov rbx, [rsp+20]
+    "48 83 C4 28"          // add rsp, 28
+    "C3"                   // ret
+    "33 DB"                // xor ebx, ebx
+};
+
+inline constexpr Pattern<19> PROCESS_EVENT_SIG{
+    "40 55"              // push rbp
+    "56"                 // push rsi
+    "57"                 // push rdi
+    "41 54"              // push r12
+    "41 55"              // push r13
+    "41 56"              // push r14
+    "41 57"              // push r15
+    "48 81 EC F0000000"  // sub rsp, 000000F0
+};
+
+inline constexpr Pattern<20> CALL_FUNCTION_SIG{
+    "40 55"              // push rbp
+    "53"                 // push rbx
+    "56"                 // push rsi
+    "57"                 // push rdi
+    "41 54"              // push r12
+    "41 55"              // push r13
+    "41 56"              // push r14
+    "41 57"              // push r15
+    "48 81 EC 28010000"  // sub rsp, 00000128
+};
+
+inline constexpr Pattern<25> MALLOC_PATTERN{
+    "48 89 5C 24 ??"     // mov [rsp+08], rbx
+    "57"                 // push rdi
+    "48 83 EC 20"        // sub rsp, 20
+    "48 8B F9"           // mov rdi, rcx
+    "8B DA"              // mov ebx, edx
+    "48 8B 0D ????????"  // mov rcx, [Borderlands3.exe+68C4E08]
+    "48 85 C9"           // test rcx, rcx
+};
+
+inline constexpr Pattern<31> REALLOC_PATTERN{
+    "48 89 5C 24 ??"     // mov [rsp+08], rbx
+    "48 89 74 24 ??"     // mov [rsp+10], rsi
+    "57"                 // push rdi
+    "48 83 EC 20"        // sub rsp, 20
+    "48 8B F1"           // mov rsi, rcx
+    "41 8B D8"           // mov ebx, r8d
+    "48 8B 0D ????????"  // mov rcx, [Borderlands3.exe+68C4E08]
+    "48 8B FA"           // mov rdi, rdx
+};
+
+inline constexpr Pattern<20> FREE_PATTERN{
+    "48 85 C9"           // test rcx, rcx
+    "74 ??"              // je Borderlands3.exe+15D37E3
+    "53"                 // push rbx
+    "48 83 EC 20"        // sub rsp, 20
+    "48 8B D9"           // mov rbx, rcx
+    "48 8B 0D ????????"  // mov rcx, [Borderlands3.exe+68C4E08]
+};
+
+inline constexpr Pattern<55> CONSTRUCT_OBJECT_PATTERN{
+    "48 89 5C 24 18"        // mov [rsp+18], rbx
+    "55"                    // push rbp
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "41 54"                 // push r12
+    "41 55"                 // push r13
+    "41 56"                 // push r14
+    "41 57"                 // push r15
+    "48 8D AC 24 ????????"  // lea rbp, [rsp-000000C0]
+    "48 81 EC C0010000"     // sub rsp, 000001C0
+    "48 8B 05 ????????"     // mov rax, [Borderlands3.exe+683B348]
+    "48 33 C4"              // xor rax, rsp
+    "48 89 85 ????????"     // mov [rbp+000000B0], rax
+    "44 8B A5 ????????"     // mov r12d, [rbp+00000120]
+};
+
+inline constexpr Pattern<21> GET_PATH_NAME_PATTERN{
+    "48 89 5C 24 ??"  // mov [rsp+18], rbx
+    "48 89 6C 24 ??"  // mov [rsp+20], rbp
+    "57"              // push rdi
+    "48 83 EC 20"     // sub rsp, 20
+    "49 8B F8"        // mov rdi, r8
+    "48 8B E9"        // mov rbp, rcx
+};
+
+inline constexpr Pattern<27> STATIC_FIND_OBJECT_PATTERN{
+    "48 89 5C 24 ??"     // mov [rsp+08], rbx
+    "48 89 6C 24 ??"     // mov [rsp+10], rbp
+    "48 89 74 24 ??"     // mov [rsp+18], rsi
+    "57"                 // push rdi
+    "48 83 EC 30"        // sub rsp, 30
+    "80 3D ???????? 00"  // cmp byte ptr [Borderlands3.exe+69EAA10], 00
+};
+
+inline constexpr Pattern<16> LOAD_PACKAGE_PATTERN{
+    "48 8B C4"     // mov rax, rsp
+    "53"           // push rbx
+    "56"           // push rsi
+    "48 83 EC 68"  // sub rsp, 68
+    "48 89 68 ??"  // mov [rax+08], rbp
+    "48 8B EA"     // mov rbp, rdx
+};
+
+inline constexpr Pattern<43> SET_SOFT_OBJ_PTR_PATTERN{
+    "E8 ????????"          // call FSoftObjectPath::FSoftObjectPath
+    "48 8B D0"             // mov rdx, rax
+    "48 8D 4D ??"          // lea rcx, [rbp-20]
+    "E8 ????????"          // call FSoftObjectPath::operator=   <-- Move assignment
+    "48 8B D6"             // mov rdx, rsi
+    "48 8D 4D D0"          // lea rcx, [rbp-30]
+    "E8 ????????"          // call FWeakObjectPtr::operator=
+    "33 C0"                // xor eax, eax
+    "F0 0FB1 1D ????????"  // lock cmpxchg [FSoftObjectPath::CurrentTag], ebx
+    "48 8B 4D ??"          // mov rcx, [rbp-20]
+};
+
+inline constexpr Pattern<36> SET_LAZY_OBJ_PTR_PATTERN{
+    "E8 ????????"          // call FLazyObjectPath::FLazyObjectPath
+    "48 8B D6"             // mov rdx, rsi
+    "48 8D 4C 24 ??"       // lea rcx, [rsp+30]
+    "0F10 00"              // movups xmm0, [rax]        <--- Effectively FLazyObjectPath::operator=
+    "0F11 44 24 ??"        // movups [rsp+3C], xmm0     <---
+    "E8 ????????"          // call FWeakObjectPtr::operator=
+    "33 C0"                // xor eax, eax
+    "F0 0FB1 1D ????????"  // lock cmpxchg [FLazyObjectPath::CurrentTag], ebx
+};
+
+}  // namespace unrealsdk::game::bl3::patterns
+
+#endif /* UNREALSDK_GAME_BL3_PATTERNS_H */
@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/game/bl3/bl3.h"
+#include "unrealsdk/game/bl3/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/unreal/structs/fstring.h"
 #include "unrealsdk/unreal/structs/fweakobjectptr.h"
@@ -14,6 +15,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl3::patterns;
 
 namespace unrealsdk::game {
 
@@ -38,19 +40,6 @@ static_assert(std::atomic<int32_t>::is_always_lock_free
                   && alignof(std::atomic<int32_t>) == alignof(int32_t),
               "atomic int32_t soft object ptr tags might not be implemented in hardware");
 
-const constinit Pattern<43> SET_SOFT_OBJ_PTR_PATTERN{
-    "E8 ????????"          // call FSoftObjectPath::FSoftObjectPath
-    "48 8B D0"             // mov rdx, rax
-    "48 8D 4D ??"          // lea rcx, [rbp-20]
-    "E8 ????????"          // call FSoftObjectPath::operator=   <-- Move assignment
-    "48 8B D6"             // mov rdx, rsi
-    "48 8D 4D D0"          // lea rcx, [rbp-30]
-    "E8 ????????"          // call FWeakObjectPtr::operator=
-    "33 C0"                // xor eax, eax
-    "F0 0FB1 1D ????????"  // lock cmpxchg [FSoftObjectPath::CurrentTag], ebx
-    "48 8B 4D ??"          // mov rcx, [rbp-20]
-};
-
 const constexpr auto SOFT_OBJ_PATH_CONSTRUCTOR_OFFSET = 1;
 const constexpr auto SOFT_OBJ_PATH_CURRENT_TAG_OFFSET = 35;
 
@@ -60,17 +49,6 @@ using fsoftobjectpath_tag_type = const std::atomic<int32_t>*;
 fsoftobjectpath_constructor_func fsoftobjectpath_constructor_ptr;
 fsoftobjectpath_tag_type fsoftobjectpath_tag_ptr;
 
-const constinit Pattern<36> SET_LAZY_OBJ_PTR_PATTERN{
-    "E8 ????????"          // call FLazyObjectPath::FLazyObjectPath
-    "48 8B D6"             // mov rdx, rsi
-    "48 8D 4C 24 ??"       // lea rcx, [rsp+30]
-    "0F10 00"              // movups xmm0, [rax]        <--- Effectively FLazyObjectPath::operator=
-    "0F11 44 24 ??"        // movups [rsp+3C], xmm0     <---
-    "E8 ????????"          // call FWeakObjectPtr::operator=
-    "33 C0"                // xor eax, eax
-    "F0 0FB1 1D ????????"  // lock cmpxchg [FLazyObjectPath::CurrentTag], ebx
-};
-
 const constexpr auto LAZY_OBJ_PATH_CONSTRUCTOR_OFFSET = 1;
 const constexpr auto LAZY_OBJ_PATH_CURRENT_TAG_OFFSET = 32;
 
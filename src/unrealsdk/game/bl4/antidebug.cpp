@@ -1,11 +1,13 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/config.h"
 #include "unrealsdk/game/bl4/bl4.h"
+#include "unrealsdk/game/bl4/patterns.h"
 #include "unrealsdk/memory.h"
 
 #if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK2
 
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl4::patterns;
 
 namespace unrealsdk::game {
 
@@ -82,13 +84,6 @@ void restore_antidebugd_functions(void) {
     }
 }
 
-const constexpr Pattern<13> SYMBIOTE_ENTRY_POINT_PATTERN{
-    "E8 ????????"  // call 168C5A9D9
-    "55"           // push rbp
-    "48 8B EC"     // mov rbp, rsp
-    "48 83 E4 F0"  // and rsp, -10
-};
-
 [[noreturn]] void symbiote_hook(void) {
     // In case these get edited between init and this call?
     restore_antidebugd_functions();
@@ -1,7 +1,9 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl4/bl4.h"
+#include "unrealsdk/game/bl4/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/multi_sigscan.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/structs/fframe.h"
 #include "unrealsdk/unreal/structs/fname.h"
@@ -13,11 +15,18 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl4::patterns;
 
 namespace unrealsdk::game {
 void BL4Hook::hook(void) {
-    hook_antidebug();
-    hook_process_event_and_wait_for_unpack();
+    {
+        const profiling::ScopedTimer timer{"hook_antidebug", "startup"};
+        hook_antidebug();
+    }
+    {
+        const profiling::ScopedTimer timer{"hook_process_event_and_wait_for_unpack", "startup"};
+        hook_process_event_and_wait_for_unpack();
+    }
 
     multi_sigscan(                                       //
         &bl4::gnatives_multi,                            //
@@ -43,6 +52,7 @@ void BL4Hook::hook(void) {
         &bl4::load_package_multi                         //
     );
 
+    const profiling::ScopedTimer timer{"find_natives", "startup"};
     hook_call_function();
     find_fname_funcs();
     find_gmalloc();
@@ -57,6 +67,7 @@ void BL4Hook::hook(void) {
 
 void BL4Hook::post_init(void) {
     inject_console();
+    hook_begin_destroy();
 }
 
 uintptr_t BL4Hook::choose_pattern(const memory::MultiPattern& pgo,
@@ -77,15 +88,6 @@ using gnatives_func = void (*)(UObject* obj, FFrame* stack, void* param);
 
 gnatives_func* gnatives_table_ptr;
 
-const constexpr Pattern<26> GNATIVES_PTR{
-    "48 89 F?"             // mov rdx, rdi              | mov rdx, rsi
-    "4C 8D 45 ??"          // lea r8, [rbp-08]
-    "4C 8D 0D {????????}"  // lea r9, [Borderlands4.exe+C5CBDB0]
-    "41 FF 14 C1"          // call qword ptr [r9+rax*8]
-    "48 83 C4 ??"          // add rsp, 20
-    "80 7D F8 01"          // cmp byte ptr [rbp-08], 01
-};
-
 }  // namespace
 namespace bl4 {
 constinit MultiPattern gnatives_multi{GNATIVES_PTR};
@@ -18,6 +18,7 @@ class BL4Hook : public AbstractHook {
    protected:
     static void hook_antidebug(void);
     static void hook_call_function(void);
+    static void hook_begin_destroy(void);
     static void hook_process_event_and_wait_for_unpack(void);
 
     static void find_fname_funcs(void);
@@ -77,6 +78,9 @@ class BL4Hook : public AbstractHook {
     void fname_init(unreal::FName* name, const wchar_t* str, uint32_t number) const override;
     [[nodiscard]] std::variant<const std::string_view, const std::wstring_view> fname_get_str(
         const unreal::FName& name) const override;
+    size_t fname_iterate(size_t start,
+                         const std::function<void(uint32_t)>& callback,
+                         const std::function<void(uint32_t)>& empty_callback) const override;
     void fframe_step(unreal::FFrame* frame, unreal::UObject* obj, void* param) const override;
     void process_event(unreal::UObject* object,
                        unreal::UFunction* func,
@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl4/bl4.h"
 #include "unrealsdk/game/bl4/offsets.h"
+#include "unrealsdk/game/bl4/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/multi_sigscan.h"
 #include "unrealsdk/unreal/structs/gnames.h"
@@ -10,69 +11,20 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl4::patterns;
 
 namespace unrealsdk::game {
 
 namespace {
 
-const constexpr Pattern<37> FNAMEPOOL_PGO_SIG{
-    "75 ??"              // jne Borderlands4.exe+1158B33
-    "48 8D 05 ????????"  // lea rax, [Borderlands4.exe+1150CD40]        <--- FNamePool
-    "48 89 CE"           // mov rsi, rcx
-    "48 89 C1"           // mov rcx, rax
-    "89 D7"              // mov edi, edx
-    "E8 ????????"        // call Borderlands4.exe+114D380               <--- Init func
-    "89 FA"              // mov edx, edi
-    "48 89 F1"           // mov rcx, rsi
-    "C6 05 ???????? 01"  // mov byte ptr [Borderlands4.exe+1150CD30], 1 <--- Initialized flag
-    "83 FA 01"           // cmp edx, 1
-};
 const constexpr auto FNAMEPOOL_PGO_PTR_OFFSET = 5;
 const constexpr auto FNAMEPOOL_PGO_INITIALIZED_OFFSET = 29;
 
-const constexpr Pattern<34> FNAMEPOOL_NON_PGO_SIG{
-    "48 89 CE"           // mov rsi, rcx
-    "80 3D ???????? 00"  // cmp cs:byte_14C4E7C08, 0
-    "75 ??"              // jne Borderlands4.exe+1B158
-    "48 8D 0D ????????"  // lea rcx, [Borderlands4.exe+C4E7C40]          <--- FNamePool
-    "E8 ????????"        // call Borderlands4.exe+3172E                  <--- Init func
-    "C6 05 ???????? 01"  // mov byte ptr [Borderlands4.exe+C4E7C08], 01  <--- Initialized flag
-    "83 FF 01"           // cmp edi, 01
-};
 const constexpr auto FNAMEPOOL_NON_PGO_PTR_OFFSET = 15;
 const constexpr auto FNAMEPOOL_NON_PGO_INITIALIZED_OFFSET = 26;
 
 FNamePool* name_pool_ptr = nullptr;
 
-// Search for the string `ERROR_NAME_SIZE_EXCEEDED`, check refs, should only be one. It is *not*
-// this function that directly points at, need to go one more ref out, this time there are a lot
-// more. We're looking for one that takes a string view, which includes some logic comparing against
-// '_'/95/0x5F (to split the name). Remember it's wchar-indexed.
-const constexpr Pattern<39> FNAME_FIND_OR_STORE_WSTRING_PGO{
-    "41 57"                 // push r15
-    "41 56"                 // push r14
-    "56"                    // push rsi
-    "57"                    // push rdi
-    "53"                    // push rbx
-    "48 81 EC ????????"     // sub rsp, 00000440
-    "48 89 CE"              // mov rsi, rcx
-    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+11399940]
-    "48 31 E0"              // xor rax, rsp
-    "48 89 84 24 ????????"  // mov [rsp+00000438], rax
-    "48 63 42 08"           // movsxd rax, dword ptr [rdx+08]
-};
-const constexpr Pattern<35> FNAME_FIND_OR_STORE_WSTRING_NON_PGO{
-    "56"                    // push rsi
-    "57"                    // push rdi
-    "53"                    // push rbx
-    "48 81 EC ????????"     // sub rsp, 00000440
-    "48 89 CE"              // mov rsi, rcx
-    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+C372940]
-    "48 31 E0"              // xor rax, rsp
-    "48 89 84 24 ????????"  // mov [rsp+00000438], rax
-    "48 63 42 08"           // movsxd rax, dword ptr [rdx+08]
-};
-
 struct FNameStringView {
     const wchar_t* str;
     uint32_t len;
@@ -131,6 +83,53 @@ std::variant<const std::string_view, const std::wstring_view> BL4Hook::fname_get
     return std::string_view{&entry->Name.Ansi[0], size};
 }
 
+size_t BL4Hook::fname_iterate(size_t start,
+                              const std::function<void(uint32_t)>& callback,
+                              const std::function<void(uint32_t)>& /*empty_callback*/) const {
+    // Entries are packed back to back, and we stop at the allocator's cursor, so there are never
+    // any empty slots to report
+    // Name indexes are the block index in the upper 16 bits, and the offset into the block in the
+    // lower, in units of 2 bytes (the entries' alignment)
+    const constexpr auto block_bits = 16;
+    const constexpr size_t offset_mask = (1 << block_bits) - 1;
+    const constexpr size_t stride = 2;
+
+    const size_t last_block = name_pool_ptr->last_chunk_idx;
+    // Despite it's name, this lines up with the allocator's byte cursor into the current block.
+    // Anything past it hasn't been written yet, and may be uninitialized.
+    const size_t last_block_end = name_pool_ptr->num_entries / stride;
+
+    auto block = start >> block_bits;
+    auto offset = start & offset_mask;
+    for (; block <= last_block; block++, offset = 0) {
+        auto block_end = block == last_block ? last_block_end : offset_mask + 1;
+
+        while (offset < block_end) {
+            auto idx = static_cast<uint32_t>((block << block_bits) | offset);
+            auto entry = reinterpret_cast<bl4::FNameEntry*>(name_pool_ptr->at(idx));
+            const size_t size = entry->Metadata >> bl4::FNameEntry::META_SIZE_BIT_OFFSET;
+            // When a block fills up, any unused space at the end starts with a zero length entry
+            if (size == 0) {
+                break;
+            }
+            callback(idx);
+
+            auto bytes = sizeof(entry->Metadata)
+                         + (size * ((entry->Metadata & FNameEntry::NAME_WIDE_MASK) != 0
+                                        ? sizeof(wchar_t)
+                                        : sizeof(char)));
+            offset += (bytes + stride - 1) / stride;
+        }
+
+        if (block == last_block) {
+            return (block << block_bits) | offset;
+        }
+    }
+
+    // Only reachable if we were given a position past the last block
+    return start;
+}
+
 void BL4Hook::fname_init(FName* name, const wchar_t* str, uint32_t number) const {
     const constexpr auto max_ascii_char = L'\x7F';
     const constexpr auto fname_add = 1;
@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/unreal/structs/ftext.h"
 #include "unrealsdk/game/bl4/bl4.h"
+#include "unrealsdk/game/bl4/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/multi_sigscan.h"
 #include "unrealsdk/unreal/structs/fstring.h"
@@ -10,6 +11,7 @@
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::memory;
+using namespace unrealsdk::game::bl4::patterns;
 
 namespace unrealsdk::game {
 
@@ -19,21 +21,6 @@ namespace {
 
 // FTextHistory::AsCultureInvariant seems to get entirely inlined, replicate it
 
-// binfold finds a couple of FTextHistory_Base funcs, xrefs to find table, xrefs and pick any
-// This is the entire initializer, this sig gets hundreds of matches
-const constexpr Pattern<46> FTEXTHISTORY_BASE_VFTABLE_PATTERN{
-    "B9 30000000"           // mov ecx, 00000030
-    "E8 ????????"           // call Borderlands4.exe+B17F7A0        <--- malloc wrapper
-    "0F 57 C0"              // xorps xmm0, xmm0
-    "0F 29 00"              // movaps [rax], xmm0
-    "48 8D 0D ????????"     // lea rcx, [Borderlands4.exe+EC372D0]  <--- FTextHistory_Base vftable
-    "48 89 08"              // mov [rax], rcx
-    "48 C7 40 10 FFFFFFFF"  // mov qword ptr [rax+10], FFFFFFFFFFFFFFFF
-    "0F 11 40 18"           // movups [rax+18], xmm0
-    "48 C7 40 28 00000000"  // mov qword ptr [rax+28], 00000000
-    ,
-    19};
-
 // NOLINTNEXTLINE(readability-identifier-naming)
 struct FTextHistory_Base {
     uintptr_t* vftable;  // = vftable
@@ -98,17 +85,6 @@ namespace {
 using ftext_as_culture_invariant_func = void (*)(FText* self, const wchar_t* str);
 ftext_as_culture_invariant_func ftext_as_culture_invariant_ptr;
 
-const constexpr Pattern<30> FTEXT_AS_CULTURE_INVARIANT_PATTERN{
-    "56"                 // push rsi
-    "48 83 EC ??"        // sub rsp, 40
-    "48 89 CE"           // mov rsi, rcx
-    "48 8B 05 ????????"  // mov rax, [Borderlands4.exe+C372940]
-    "48 31 E0"           // xor rax, rsp
-    "48 89 44 24 ??"     // mov [rsp+38], rax
-    "48 89 54 24 ??"     // mov [rsp+28], rdx
-    "31 C0"              // xor eax, eax
-};
-
 }  // namespace
 namespace bl4 {
 constinit MultiPattern ftext_as_culture_invariant_non_pgo_multi{FTEXT_AS_CULTURE_INVARIANT_PATTERN};
@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/unreal/wrappers/gobjects.h"
 #include "unrealsdk/game/bl4/bl4.h"
+#include "unrealsdk/game/bl4/patterns.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/multi_sigscan.h"
 
@@ -8,17 +9,12 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl4::patterns;
 
 namespace unrealsdk::game {
 
 namespace {
 
-const constexpr Pattern<15> GOBJECTS_SIG{
-    "44 8B 05 {????????}"  // mov r8d, [Borderlands4.exe+C5CD8F8]
-    "8B 15 ????????"       // mov edx, [Borderlands4.exe+C5CD91C]
-    "89 F9"                // mov ecx, edi
-};
-
 GObjects gobjects_wrapper{};
 
 }  // namespace
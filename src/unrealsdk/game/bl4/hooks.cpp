@@ -1,15 +1,19 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/game/bl4/bl4.h"
+#include "unrealsdk/game/bl4/patterns.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/locks.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/multi_sigscan.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/unreal/structs/fframe.h"
 
 #if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_OAK2 && !defined(UNREALSDK_IMPORTING)
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl4::patterns;
 
 namespace unrealsdk::game {
 
@@ -20,23 +24,6 @@ namespace {
 using call_function_func = void(UObject* obj, FFrame* stack, void* result, UFunction* func);
 call_function_func* call_function_ptr;
 
-// binfold seems good at picking up UObject::execVirtualFunction, it calls two functions, first is
-// UObject::FindFunctionChecked, second is this
-const constexpr Pattern<27> CALL_FUNCTION_SIG{
-    "55"              // push rbp
-    "41 57"           // push r15
-    "41 56"           // push r14
-    "41 55"           // push r13
-    "41 54"           // push r12
-    "56"              // push rsi
-    "57"              // push rdi
-    "53"              // push rbx
-    "48 83 EC ??"     // sub rsp, 38
-    "48 8D 6C 24 ??"  // lea rbp, [rsp+30]
-    "4C 89 C?"        // mov rbx, r9        | mov rsi, r9
-    "4D 89 C6"        // mov r14, r8
-};
-
 }  // namespace
 namespace bl4 {
 constinit MultiPattern call_function_multi{CALL_FUNCTION_SIG};
@@ -83,6 +70,7 @@ void call_function_hook(UObject* obj, FFrame* stack, void* result, UFunction* fu
 
             if (!block_execution) {
                 hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL,
@@ -124,22 +112,6 @@ namespace {
 using process_event_func = void(UObject* obj, UFunction* func, void* params);
 process_event_func* process_event_ptr;
 
-const constexpr Pattern<41> PROCESS_EVENT_SIG{
-    "55"                    // push rbp
-    "41 57"                 // push r15
-    "41 56"                 // push r14
-    "41 55"                 // push r13
-    "41 54"                 // push r12
-    "56"                    // push rsi
-    "57"                    // push rdi
-    "53"                    // push rbx
-    "48 81 EC ????????"     // sub rsp, 000000C8
-    "48 8D AC 24 ????????"  // lea rbp, [rsp+80h]
-    "48 8B 05 ????????"     // mov rax, [rip+0]
-    "48 31 E8"              // xor rax, rbp
-    "48 89 45 40"           // mov [rbp+40h], rax
-};
-
 }  // namespace
 namespace bl4 {
 constinit MultiPattern process_event_multi{PROCESS_EVENT_SIG};
@@ -180,6 +152,7 @@ void process_event_hook(UObject* obj, UFunction* func, void* params) {
 
             if (!block_execution) {
                 hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST, hook);
+                hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_ASYNC, hook);
             }
 
             hook_manager::impl::run_hooks_of_type(data, hook_manager::Type::POST_UNCONDITIONAL,
@@ -209,6 +182,7 @@ static_assert(std::is_same_v<decltype(process_event_hook), decltype(locking_proc
 void BL4Hook::hook_process_event_and_wait_for_unpack(void) {
     // HACK: The exe is packed, we don't have a proper hook after unpack yet, so instead just repeat
     //       sigscan until it works (or timeout). This is normally the first sigscan.
+    const profiling::ScopedTimer timer{"unpack", "wait"};
     const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{30};
     while (std::chrono::steady_clock::now() < timeout) {
         auto process_event_addr = PROCESS_EVENT_SIG.sigscan_nullable();
@@ -235,6 +209,37 @@ void BL4Hook::process_event(UObject* object, UFunction* func, void* params) cons
 
 #pragma endregion
 
+#pragma region BeginDestroy
+
+namespace {
+
+using begin_destroy_func = void(UObject* obj);
+begin_destroy_func* begin_destroy_ptr;
+
+void begin_destroy_hook(UObject* obj) {
+    try {
+        gc::impl::object_destroyed(obj);
+    } catch (const std::exception& ex) {
+        LOG(ERROR, "An exception occurred during the BeginDestroy hook: {}", ex.what());
+    }
+
+    begin_destroy_ptr(obj);
+}
+
+static_assert(std::is_same_v<decltype(begin_destroy_hook), begin_destroy_func>,
+              "begin_destroy signature is incorrect");
+
+}  // namespace
+
+void BL4Hook::hook_begin_destroy(void) {
+    auto addr = gc::impl::find_begin_destroy();
+    if (addr != 0 && detour(addr, begin_destroy_hook, &begin_destroy_ptr, "BeginDestroy")) {
+        gc::impl::start_tracking();
+    }
+}
+
+#pragma endregion
+
 }  // namespace unrealsdk::game
 
 #endif
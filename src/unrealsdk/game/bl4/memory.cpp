@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/memory.h"
 #include "unrealsdk/game/bl4/bl4.h"
+#include "unrealsdk/game/bl4/patterns.h"
 #include "unrealsdk/multi_sigscan.h"
 #include "unrealsdk/unreal/alignment.h"
 
@@ -8,56 +9,12 @@
 
 using namespace unrealsdk::memory;
 using namespace unrealsdk::unreal;
+using namespace unrealsdk::game::bl4::patterns;
 
 namespace unrealsdk::game {
 
 namespace {
 
-const constexpr Pattern<84> GMALLOC_PGO_SIG{
-    // This is the inlined initialization code, it gets thousands of matches
-    "48 8B 0D {????????}"      // mov rcx, [Borderlands4.exe+114F8EA0]
-    "48 85 C9"                 // test rcx, rcx
-    "75 ??"                    // jne Borderlands4.exe+E6DE28
-    "8B 05 ????????"           // mov eax, [Borderlands4.exe+114D2468]
-    "8B 0D ????????"           // mov ecx, [Borderlands4.AK::IAkStreamMgr::m_pStreamMgr+15AC]
-    "65 4C 8B 04 25 ????????"  // mov r8, gs:[00000058]
-    "49 8B 0C C8"              // mov rcx, [r8+rcx*8]
-    "3B 81 ????????"           // cmp eax, [rcx+00000110]
-    "7F 1D"                    // jg Borderlands4.exe+E6DE3E
-    "48 8B 0D ????????"        // mov rcx, [Borderlands4.exe+114F8EA0]
-    "48 8B 01"                 // mov rax, [rcx]
-    "48 8B 40 48"              // mov rax, [rax+48]
-    "48 83 C4 20"              // add rsp, 20
-    "5E"                       // pop rsi
-    "48 FF E0"                 // jmp rax
-    // Not entirely sure this is still part of initialization, adding just to try get an 89 for the
-    // multi sigscan
-    "90"                 // nop
-    "48 83 C4 ??"        // add rsp, 20h
-    "5E"                 // pop rsi
-    "C3"                 // retn
-    "48 8D 0D ????????"  // lea rcx, cs:1514D2468h
-    "48 89 D6"           // mov rsi, rdx
-};
-const constexpr Pattern<52> GMALLOC_NON_PGO_SIG{
-    "48 8B 0D {????????}"  // mov rcx, [Borderlands4.exe+C4DBF30]
-    "48 85 C9"             // test rcx, rcx
-    "74 ??"                // je Borderlands4.exe+1D843
-    "48 8B 01"             // mov rax, [rcx]
-    "48 8B 40 ??"          // mov rax, [rax+28]
-    "48 89 FA"             // mov rdx, rdi
-    "41 89 F0"             // mov r8d, esi
-    "48 83 C4 ??"          // add rsp, 28
-    "5F"                   // pop rdi
-    "5E"                   // pop rsi
-    "48 FF E0"             // jmp rax
-    "E8 ????????"          // call Borderlands4.exe+5B4E598
-    "48 8B 0D ????????"    // mov rcx, [Borderlands4.exe+C4DBF30]
-    "EB ??"                // jmp Borderlands4.exe+1D82D
-    "CC"                   // int 3
-    "48 89 C8"             // mov rax, rcx
-};
-
 struct FMalloc;
 struct FMallocVFtable {
     uintptr_t unknown00;
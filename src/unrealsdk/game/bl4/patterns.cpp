@@ -0,0 +1,31 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/game/bl4/patterns.h"
+
+// Unlike the rest of the game hooks, this isn't limited to the current flavour, so that offline
+// tools may validate every game's patterns at once
+namespace unrealsdk::game::bl4::patterns {
+
+UNREALSDK_REGISTER_PATTERN("bl4", SYMBIOTE_ENTRY_POINT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", GNATIVES_PTR);
+UNREALSDK_REGISTER_PATTERN("bl4", FNAMEPOOL_PGO_SIG);
+UNREALSDK_REGISTER_PATTERN("bl4", FNAMEPOOL_NON_PGO_SIG);
+UNREALSDK_REGISTER_PATTERN("bl4", FNAME_FIND_OR_STORE_WSTRING_PGO);
+UNREALSDK_REGISTER_PATTERN("bl4", FNAME_FIND_OR_STORE_WSTRING_NON_PGO);
+UNREALSDK_REGISTER_PATTERN("bl4", FTEXTHISTORY_BASE_VFTABLE_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", FTEXT_AS_CULTURE_INVARIANT_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", GOBJECTS_SIG);
+UNREALSDK_REGISTER_PATTERN("bl4", CALL_FUNCTION_SIG);
+UNREALSDK_REGISTER_PATTERN("bl4", PROCESS_EVENT_SIG);
+UNREALSDK_REGISTER_PATTERN("bl4", GMALLOC_PGO_SIG);
+UNREALSDK_REGISTER_PATTERN("bl4", GMALLOC_NON_PGO_SIG);
+UNREALSDK_REGISTER_PATTERN("bl4", GET_OBJ_PATH_NAME_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", GET_OBJ_PATH_NAME_NON_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", GET_FIELD_PATH_NAME_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", GET_FIELD_PATH_NAME_NON_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", CONSTRUCT_OBJECT_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", CONSTRUCT_OBJECT_NON_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", STATIC_FIND_OBJECT_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", STATIC_FIND_OBJECT_NON_PGO_PATTERN);
+UNREALSDK_REGISTER_PATTERN("bl4", LOAD_PACKAGE_PATTERN);
+
+}  // namespace unrealsdk::game::bl4::patterns
@@ -0,0 +1,340 @@
+#ifndef UNREALSDK_GAME_BL4_PATTERNS_H
+#define UNREALSDK_GAME_BL4_PATTERNS_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the patterns can be validated offline, on any platform, without the rest of the sdk.
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::game::bl4::patterns {
+
+using unrealsdk::memory::Pattern;
+
+inline constexpr Pattern<13> SYMBIOTE_ENTRY_POINT_PATTERN{
+    "E8 ????????"  // call 168C5A9D9
+    "55"           // push rbp
+    "48 8B EC"     // mov rbp, rsp
+    "48 83 E4 F0"  // and rsp, -10
+};
+
+inline constexpr Pattern<26> GNATIVES_PTR{
+    "48 89 F?"             // mov rdx, rdi              | mov rdx, rsi
+    "4C 8D 45 ??"          // lea r8, [rbp-08]
+    "4C 8D 0D {????????}"  // lea r9, [Borderlands4.exe+C5CBDB0]
+    "41 FF 14 C1"          // call qword ptr [r9+rax*8]
+    "48 83 C4 ??"          // add rsp, 20
+    "80 7D F8 01"          // cmp byte ptr [rbp-08], 01
+};
+
+inline constexpr Pattern<37> FNAMEPOOL_PGO_SIG{
+    "75 ??"              // jne Borderlands4.exe+1158B33
+    "48 8D 05 ????????"  // lea rax, [Borderlands4.exe+1150CD40]        <--- FNamePool
+    "48 89 CE"           // mov rsi, rcx
+    "48 89 C1"           // mov rcx, rax
+    "89 D7"              // mov edi, edx
+    "E8 ????????"        // call Borderlands4.exe+114D380               <--- Init func
+    "89 FA"              // mov edx, edi
+    "48 89 F1"           // mov rcx, rsi
+    "C6 05 ???????? 01"  // mov byte ptr [Borderlands4.exe+1150CD30], 1 <--- Initialized flag
+    "83 FA 01"           // cmp edx, 1
+};
+
+inline constexpr Pattern<34> FNAMEPOOL_NON_PGO_SIG{
+    "48 89 CE"           // mov rsi, rcx
+    "80 3D ???????? 00"  // cmp cs:byte_14C4E7C08, 0
+    "75 ??"              // jne Borderlands4.exe+1B158
+    "48 8D 0D ????????"  // lea rcx, [Borderlands4.exe+C4E7C40]          <--- FNamePool
+    "E8 ????????"        // call Borderlands4.exe+3172E                  <--- Init func
+    "C6 05 ???????? 01"  // mov byte ptr [Borderlands4.exe+C4E7C08], 01  <--- Initialized flag
+    "83 FF 01"           // cmp edi, 01
+};
+
+// Search for the string `ERROR_NAME_SIZE_EXCEEDED`, check refs, should only be one. It is *not*
+// this function that directly points at, need to go one more ref out, this time there are a lot
+// more. We're looking for one that takes a string view, which includes some logic comparing against
+// '_'/95/0x5F (to split the name). Remember it's wchar-indexed.
+inline constexpr Pattern<39> FNAME_FIND_OR_STORE_WSTRING_PGO{
+    "41 57"                 // push r15
+    "41 56"                 // push r14
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000440
+    "48 89 CE"              // mov rsi, rcx
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+11399940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000438], rax
+    "48 63 42 08"           // movsxd rax, dword ptr [rdx+08]
+};
+
+inline constexpr Pattern<35> FNAME_FIND_OR_STORE_WSTRING_NON_PGO{
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000440
+    "48 89 CE"              // mov rsi, rcx
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+C372940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000438], rax
+    "48 63 42 08"           // movsxd rax, dword ptr [rdx+08]
+};
+
+// binfold finds a couple of FTextHistory_Base funcs, xrefs to find table, xrefs and pick any
+// This is the entire initializer, this sig gets hundreds of matches
+inline constexpr Pattern<46> FTEXTHISTORY_BASE_VFTABLE_PATTERN{
+    "B9 30000000"           // mov ecx, 00000030
+    "E8 ????????"           // call Borderlands4.exe+B17F7A0        <--- malloc wrapper
+    "0F 57 C0"              // xorps xmm0, xmm0
+    "0F 29 00"              // movaps [rax], xmm0
+    "48 8D 0D ????????"     // lea rcx, [Borderlands4.exe+EC372D0]  <--- FTextHistory_Base vftable
+    "48 89 08"              // mov [rax], rcx
+    "48 C7 40 10 FFFFFFFF"  // mov qword ptr [rax+10], FFFFFFFFFFFFFFFF
+    "0F 11 40 18"           // movups [rax+18], xmm0
+    "48 C7 40 28 00000000"  // mov qword ptr [rax+28], 00000000
+    ,
+    19};
+
+inline constexpr Pattern<30> FTEXT_AS_CULTURE_INVARIANT_PATTERN{
+    "56"                 // push rsi
+    "48 83 EC ??"        // sub rsp, 40
+    "48 89 CE"           // mov rsi, rcx
+    "48 8B 05 ????????"  // mov rax, [Borderlands4.exe+C372940]
+    "48 31 E0"           // xor rax, rsp
+    "48 89 44 24 ??"     // mov [rsp+38], rax
+    "48 89 54 24 ??"     // mov [rsp+28], rdx
+    "31 C0"              // xor eax, eax
+};
+
+inline constexpr Pattern<15> GOBJECTS_SIG{
+    "44 8B 05 {????????}"  // mov r8d, [Borderlands4.exe+C5CD8F8]
+    "8B 15 ????????"       // mov edx, [Borderlands4.exe+C5CD91C]
+    "89 F9"                // mov ecx, edi
+};
+
+// binfold seems good at picking up UObject::execVirtualFunction, it calls two functions, first is
+// UObject::FindFunctionChecked, second is this
+inline constexpr Pattern<27> CALL_FUNCTION_SIG{
+    "55"              // push rbp
+    "41 57"           // push r15
+    "41 56"           // push r14
+    "41 55"           // push r13
+    "41 54"           // push r12
+    "56"              // push rsi
+    "57"              // push rdi
+    "53"              // push rbx
+    "48 83 EC ??"     // sub rsp, 38
+    "48 8D 6C 24 ??"  // lea rbp, [rsp+30]
+    "4C 89 C?"        // mov rbx, r9        | mov rsi, r9
+    "4D 89 C6"        // mov r14, r8
+};
+
+inline constexpr Pattern<41> PROCESS_EVENT_SIG{
+    "55"                    // push rbp
+    "41 57"                 // push r15
+    "41 56"                 // push r14
+    "41 55"                 // push r13
+    "41 54"                 // push r12
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 000000C8
+    "48 8D AC 24 ????????"  // lea rbp, [rsp+80h]
+    "48 8B 05 ????????"     // mov rax, [rip+0]
+    "48 31 E8"              // xor rax, rbp
+    "48 89 45 40"           // mov [rbp+40h], rax
+};
+
+inline constexpr Pattern<84> GMALLOC_PGO_SIG{
+    // This is the inlined initialization code, it gets thousands of matches
+    "48 8B 0D {????????}"      // mov rcx, [Borderlands4.exe+114F8EA0]
+    "48 85 C9"                 // test rcx, rcx
+    "75 ??"                    // jne Borderlands4.exe+E6DE28
+    "8B 05 ????????"           // mov eax, [Borderlands4.exe+114D2468]
+    "8B 0D ????????"           // mov ecx, [Borderlands4.AK::IAkStreamMgr::m_pStreamMgr+15AC]
+    "65 4C 8B 04 25 ????????"  // mov r8, gs:[00000058]
+    "49 8B 0C C8"              // mov rcx, [r8+rcx*8]
+    "3B 81 ????????"           // cmp eax, [rcx+00000110]
+    "7F 1D"                    // jg Borderlands4.exe+E6DE3E
+    "48 8B 0D ????????"        // mov rcx, [Borderlands4.exe+114F8EA0]
+    "48 8B 01"                 // mov rax, [rcx]
+    "48 8B 40 48"              // mov rax, [rax+48]
+    "48 83 C4 20"              // add rsp, 20
+    "5E"                       // pop rsi
+    "48 FF E0"                 // jmp rax
+    // Not entirely sure this is still part of initialization, adding just to try get an 89 for the
+    // multi sigscan
+    "90"                 // nop
+    "48 83 C4 ??"        // add rsp, 20h
+    "5E"                 // pop rsi
+    "C3"                 // retn
+    "48 8D 0D ????????"  // lea rcx, cs:1514D2468h
+    "48 89 D6"           // mov rsi, rdx
+};
+
+inline constexpr Pattern<52> GMALLOC_NON_PGO_SIG{
+    "48 8B 0D {????????}"  // mov rcx, [Borderlands4.exe+C4DBF30]
+    "48 85 C9"             // test rcx, rcx
+    "74 ??"                // je Borderlands4.exe+1D843
+    "48 8B 01"             // mov rax, [rcx]
+    "48 8B 40 ??"          // mov rax, [rax+28]
+    "48 89 FA"             // mov rdx, rdi
+    "41 89 F0"             // mov r8d, esi
+    "48 83 C4 ??"          // add rsp, 28
+    "5F"                   // pop rdi
+    "5E"                   // pop rsi
+    "48 FF E0"             // jmp rax
+    "E8 ????????"          // call Borderlands4.exe+5B4E598
+    "48 8B 0D ????????"    // mov rcx, [Borderlands4.exe+C4DBF30]
+    "EB ??"                // jmp Borderlands4.exe+1D82D
+    "CC"                   // int 3
+    "48 89 C8"             // mov rax, rcx
+};
+
+// Search for the string L"Cannot replace existing object of a different class.", xrefs
+// This error message contains two object path names, so it calls get path twice before
+// The get path you get from there is just the raw fstring version (?), and first function called
+// by it is the inner string builder we hook here
+inline constexpr Pattern<39> GET_OBJ_PATH_NAME_PGO_PATTERN{
+    "41 56"                 // push r14
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000088
+    "4C 89 C6"              // mov rsi, r8
+    "48 89 CF"              // mov rdi, rcx
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+11399940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000080], rax
+    "48 39 D1"              // cmp rcx, rdx
+};
+
+inline constexpr Pattern<42> GET_OBJ_PATH_NAME_NON_PGO_PATTERN{
+    "41 56"                 // push r14
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000088
+    "4C 89 C6"              // mov rsi, r8
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+C372940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000080], rax
+    "48 85 C9"              // test rcx, rcx
+    "0F84 ????????"         // je Borderlands4.exe+4261FF6
+};
+
+// Search for the string "CoreUObject/Private/UObject/PropertyBaseObject.cpp", xrefs
+// It calls UObjectBaseUtility::GetPathName, then FField::GetPathName, then the log function
+inline constexpr Pattern<43> GET_FIELD_PATH_NAME_PGO_PATTERN{
+    "41 57"                 // push r15
+    "41 56"                 // push r14
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000250
+    "4C 89 C0"              // mov rax, r8
+    "48 89 D6"              // mov rsi, rdx
+    "48 8B 15 ????????"     // mov rdx, [Borderlands4.exe+11399940]
+    "48 31 E2"              // xor rdx, rsp
+    "48 89 94 24 ????????"  // mov [rsp+00000248], rdx
+    "48 8D 54 24 ??"        // lea rdx,[rsp+58]
+};
+
+inline constexpr Pattern<67> GET_FIELD_PATH_NAME_NON_PGO_PATTERN{
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "48 81 EC ????????"     // sub rsp, 00000258
+    "48 89 D6"              // mov rsi, rdx
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+C372940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000250], rax
+    "48 8D 44 24 ??"        // lea rax, [rsp+50]
+    "C6 40 F8 00"           // mov byte ptr [rax-08], 00
+    "48 89 40 E0"           // mov [rax-20], rax
+    "48 89 40 E8"           // mov [rax-18], rax
+    "48 8D 94 24 ????????"  // lea rdx, [rsp+00000250]
+    "48 89 50 F0"           // mov [rax-10], rdx
+    "48 8D 7C 24 ??"        // lea rdi, [rsp+30]
+    "4C 89 C2"              // mov rdx, r8
+};
+
+inline constexpr Pattern<41> CONSTRUCT_OBJECT_PGO_PATTERN{
+    "41 56"                 // push r14
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "55"                    // push rbp
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000280
+    "48 89 CE"              // mov rsi, rcx
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+11399940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000278], rax
+    "48 8B 39"              // mov rdi, [rcx]
+    "48 8B 51 08"           // mov rdx, [rcx+08]
+};
+
+inline constexpr Pattern<39> CONSTRUCT_OBJECT_NON_PGO_PATTERN{
+    "41 57"                 // push r15
+    "41 56"                 // push r14
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "55"                    // push rbp
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000278
+    "48 89 CE"              // mov rsi, rcx
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+C372940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000270], rax
+    "48 8B 39"              // mov rdi, [rcx]
+};
+
+// Search for the string L"FindImportedObject", xrefs. This function makes several calls to it,
+// easiest to find is near the top of the function, first call inside the loop.
+inline constexpr Pattern<35> STATIC_FIND_OBJECT_PGO_PATTERN{
+    "41 56"              // push r14
+    "56"                 // push rsi
+    "57"                 // push rdi
+    "53"                 // push rbx
+    "48 83 EC ??"        // sub rsp, 38
+    "48 8B 05 ????????"  // mov rax, [Borderlands4.exe+11399940]
+    "48 31 E0"           // xor rax, rsp
+    "48 89 44 24 ??"     // mov [rsp+30], rax
+    "F6 05 ???????? 01"  // test byte ptr [Borderlands4.exe+115D7A00], 01
+    "74 ??"              // jz short loc_14153EB78
+    "31 C0"              // xor eax, eax
+};
+
+inline constexpr Pattern<32> STATIC_FIND_OBJECT_NON_PGO_PATTERN{
+    "41 57"              // push r15
+    "41 56"              // push r14
+    "41 55"              // push r13
+    "41 54"              // push r12
+    "56"                 // push rsi
+    "57"                 // push rdi
+    "55"                 // push rbp
+    "53"                 // push rbx
+    "48 83 EC 28"        // sub rsp, 28
+    "F6 05 ???????? 01"  // test byte ptr [Borderlands4.exe+C5B2940], 01
+    "0F 85 ????????"     // jnz loc_14005F0E1
+    "44 89 CB"           // mov ebx, r9d
+};
+
+inline constexpr Pattern<50> LOAD_PACKAGE_PATTERN{
+    "41 57"                 // push r15
+    "41 56"                 // push r14
+    "41 55"                 // push r13
+    "41 54"                 // push r12
+    "56"                    // push rsi
+    "57"                    // push rdi
+    "55"                    // push rbp
+    "53"                    // push rbx
+    "48 81 EC ????????"     // sub rsp, 00000188
+    "48 8B 05 ????????"     // mov rax, [Borderlands4.exe+C372940]
+    "48 31 E0"              // xor rax, rsp
+    "48 89 84 24 ????????"  // mov [rsp+00000180], rax
+    "48 83 3A 00"           // cmp qword ptr [rdx], 00
+    "0F84 ????????"         // je Borderlands4.exe+2546480
+    "4D 89 CF"              // mov r15, r9
+};
+
+}  // namespace unrealsdk::game::bl4::patterns
+
+#endif /* UNREALSDK_GAME_BL4_PATTERNS_H */
@@ -0,0 +1,208 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/game/abstract_hook.h"
+#include "unrealsdk/game/fname_index.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+using namespace unrealsdk::unreal;
+
+namespace unrealsdk::game {
+
+namespace {
+
+// FNV-1a
+const constexpr uint64_t HASH_OFFSET_BASIS = 0xCBF29CE484222325;
+const constexpr uint64_t HASH_PRIME = 0x100000001B3;
+
+const constexpr size_t MAX_BUILD_THREADS = 8;
+// Below this it's not worth the overhead of starting threads
+const constexpr size_t MIN_NAMES_PER_THREAD = 0x4000;
+
+/**
+ * @brief Case folds a single character.
+ * @note Like unreal, only folds ascii and latin-1 letters, which also keeps it locale independent.
+ * @note Narrow names are treated as latin-1, same as when unreal widens them.
+ *
+ * @tparam T The character type.
+ * @param chr The character to fold.
+ * @return The folded character.
+ */
+template <typename T>
+wchar_t fold(T chr) {
+    const constexpr wchar_t case_offset = L'a' - L'A';
+    const constexpr wchar_t latin_1_upper_start = L'\xC0';
+    const constexpr wchar_t latin_1_upper_end = L'\xDE';
+    const constexpr wchar_t latin_1_multiply = L'\xD7';
+
+    if constexpr (std::is_same_v<T, char>) {
+        return fold(static_cast<wchar_t>(static_cast<unsigned char>(chr)));
+    } else {
+        if ((chr >= L'A' && chr <= L'Z')
+            || (chr >= latin_1_upper_start && chr <= latin_1_upper_end
+                && chr != latin_1_multiply)) {
+            return static_cast<wchar_t>(chr + case_offset);
+        }
+        return chr;
+    }
+}
+
+/**
+ * @brief Hashes a string, ignoring case.
+ *
+ * @tparam T The character type.
+ * @param str The string to hash.
+ * @return The hash.
+ */
+template <typename T>
+uint64_t hash_folded(std::basic_string_view<T> str) {
+    uint64_t hash = HASH_OFFSET_BASIS;
+    for (auto chr : str) {
+        hash ^= static_cast<uint16_t>(fold(chr));
+        hash *= HASH_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hashes the string of the name at the given index.
+ *
+ * @param hook The game hook to use to read the names table.
+ * @param idx The name index.
+ * @return The hash.
+ */
+uint64_t hash_entry(const AbstractHook& hook, uint32_t idx) {
+    return std::visit([](auto str) { return hash_folded(str); }, hook.fname_get_str(FName{idx, 0}));
+}
+
+/**
+ * @brief Checks if the string of the name at the given index matches a string, ignoring case.
+ *
+ * @param hook The game hook to use to read the names table.
+ * @param idx The name index.
+ * @param str The string to compare against.
+ * @return True if the strings match.
+ */
+bool entry_matches(const AbstractHook& hook, uint32_t idx, std::wstring_view str) {
+    return std::visit(
+        [str](auto entry) {
+            return entry.size() == str.size()
+                   && std::ranges::equal(entry, str, {}, fold<typename decltype(entry)::value_type>,
+                                         fold<wchar_t>);
+        },
+        hook.fname_get_str(FName{idx, 0}));
+}
+
+}  // namespace
+
+void FNameIndex::extend(const AbstractHook& hook) {
+    auto old_position = this->next_position;
+    auto old_empty_count = this->empty_slots.size();
+    this->next_position = hook.fname_iterate(
+        this->next_position,
+        [this, &hook](uint32_t idx) { this->indexes.emplace(hash_entry(hook, idx), idx); },
+        [this](uint32_t idx) { this->empty_slots.push_back(idx); });
+
+    // Most lookups happen while the table hasn't changed, so don't pay to recheck every hole unless
+    // it has. A slot which is still being written when the table stops growing will only be picked
+    // up next time it grows.
+    if (this->next_position == old_position || old_empty_count == 0) {
+        return;
+    }
+    // Only the holes from before, we've only just seen the new ones
+    auto old_end = this->empty_slots.begin() + static_cast<ptrdiff_t>(old_empty_count);
+    auto filled_end =
+        std::remove_if(this->empty_slots.begin(), old_end, [this, &hook](uint32_t idx) {
+            if (!hook.fname_is_filled(idx)) {
+                return false;
+            }
+            this->indexes.emplace(hash_entry(hook, idx), idx);
+            return true;
+        });
+    this->empty_slots.erase(filled_end, old_end);
+}
+
+void FNameIndex::build(const AbstractHook& hook) {
+    const std::scoped_lock lock(this->mutex);
+    if (!this->built) {
+        this->build_locked(hook);
+    }
+}
+
+void FNameIndex::build_locked(const AbstractHook& hook) {
+    this->built = true;
+
+    std::vector<uint32_t> found{};
+    this->next_position = hook.fname_iterate(
+        this->next_position, [&found](uint32_t idx) { found.push_back(idx); },
+        [this](uint32_t idx) { this->empty_slots.push_back(idx); });
+
+    // If reading the names table is thread safe, we can split hashing over a few threads, and only
+    // need to insert into the map back on this one. Otherwise, we must do it all on this thread.
+    auto num_threads =
+        CONCURRENT_READS
+            ? std::clamp<size_t>(std::min<size_t>(std::thread::hardware_concurrency(),
+                                                  found.size() / MIN_NAMES_PER_THREAD),
+                                 1, MAX_BUILD_THREADS)
+            : 1;
+    std::vector<std::optional<uint64_t>> hashes(found.size());
+    auto hash_range = [&hook, &found, &hashes](size_t start, size_t end) {
+        for (auto i = start; i < end; i++) {
+            try {
+                hashes[i] = hash_entry(hook, found[i]);
+            } catch (const std::exception&) {
+                // Leave it as nullopt, we'll skip it below
+            }
+        }
+    };
+
+    if (num_threads == 1) {
+        hash_range(0, found.size());
+    } else {
+        auto per_thread = (found.size() + num_threads - 1) / num_threads;
+        std::vector<std::thread> threads{};
+        for (size_t start = 0; start < found.size(); start += per_thread) {
+            threads.emplace_back(hash_range, start, std::min(start + per_thread, found.size()));
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    this->indexes.reserve(this->indexes.size() + found.size());
+    size_t skipped = 0;
+    for (size_t i = 0; i < found.size(); i++) {
+        if (hashes[i].has_value()) {
+            this->indexes.emplace(*hashes[i], found[i]);
+        } else {
+            skipped++;
+        }
+    }
+
+    LOG(MISC, "Indexed {} names", found.size() - skipped);
+    if (skipped > 0) {
+        LOG(WARNING, "Failed to read {} names while building name index", skipped);
+    }
+}
+
+std::optional<uint32_t> FNameIndex::find(const AbstractHook& hook, std::wstring_view str) {
+    const std::scoped_lock lock(this->mutex);
+    if (this->built) {
+        this->extend(hook);
+    } else {
+        this->build_locked(hook);
+    }
+
+    auto [begin, end] = this->indexes.equal_range(hash_folded(str));
+    for (auto iter = begin; iter != end; iter++) {
+        if (entry_matches(hook, iter->second, str)) {
+            return iter->second;
+        }
+    }
+    return std::nullopt;
+}
+
+}  // namespace unrealsdk::game
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef UNREALSDK_GAME_FNAME_INDEX_H
+#define UNREALSDK_GAME_FNAME_INDEX_H
+
+#include "unrealsdk/pch.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::game {
+
+class AbstractHook;
+
+/**
+ * @brief A local reverse index of the names table, mapping strings back to their name index.
+ * @note This lets us check if a name exists without calling into the engine, which would add it if
+ *       it didn't.
+ */
+class FNameIndex {
+   public:
+    // UE4's names pool is chunked, and existing entries never move, so it may be read from any
+    // thread. UE3's names table is a plain TArray, which the engine reallocates while adding names,
+    // so like any other name access, it's only safe to read from the game thread. We can't build in
+    // the background there, and must instead build on the first lookup.
+    static constexpr bool CONCURRENT_READS = UNREALSDK_FLAVOUR != UNREALSDK_FLAVOUR_WILLOW;
+
+   private:
+    std::mutex mutex;
+    bool built = false;
+    // Maps the hash of the case folded string to it's name index. Since we only store hashes, there
+    // may be collisions, which we resolve by comparing against the names table on lookup.
+    std::unordered_multimap<uint64_t, uint32_t> indexes;
+    // The position to resume iterating the names table from.
+    size_t next_position = 0;
+    // Slots we've already iterated past which were empty at the time. These may be permanently
+    // unused, or may still be being written by another thread, so we need to recheck them. Since
+    // UE3 tables have many permanent holes, we only do so when the table has grown.
+    std::vector<uint32_t> empty_slots;
+
+    /**
+     * @brief Adds any names which have been added since we last checked to the index, including
+     *        any which have since been written into previously empty slots.
+     * @note Assumes the mutex is already held.
+     *
+     * @param hook The game hook to use to read the names table.
+     */
+    void extend(const AbstractHook& hook);
+
+    /**
+     * @brief Builds the initial index.
+     * @note Assumes the mutex is already held.
+     *
+     * @param hook The game hook to use to read the names table.
+     */
+    void build_locked(const AbstractHook& hook);
+
+   public:
+    /**
+     * @brief Builds the initial index, splitting the hashing work over multiple threads.
+     * @note Intended to be run in the background during init, if `CONCURRENT_READS` is set.
+     *       Lookups block until it finishes. If it's not called, the first lookup builds it.
+     *
+     * @param hook The game hook to use to read the names table.
+     */
+    void build(const AbstractHook& hook);
+
+    /**
+     * @brief Looks up the index of the given name, without adding it if it doesn't exist.
+     * @note Like unreal, lookups are case insensitive.
+     * @note If `CONCURRENT_READS` is not set, must be called from the game thread.
+     *
+     * @param hook The game hook to use to read the names table.
+     * @param str The string to look up. Should not include a number suffix.
+     * @return The name index, or std::nullopt if it doesn't exist.
+     */
+    [[nodiscard]] std::optional<uint32_t> find(const AbstractHook& hook, std::wstring_view str);
+};
+
+}  // namespace unrealsdk::game
+
+#endif
+
+#endif /* UNREALSDK_GAME_FNAME_INDEX_H */
@@ -0,0 +1,89 @@
+#ifndef UNREALSDK_GAME_LAZY_NATIVE_H
+#define UNREALSDK_GAME_LAZY_NATIVE_H
+
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/memory.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::game {
+
+/**
+ * @brief A pointer to a native function, which is only sigscanned for the first time it's needed.
+ * @note Intended for natives which most sessions never call, so they stay off the startup path.
+ *
+ * @tparam Func The native function pointer type.
+ */
+template <typename Func>
+class LazyNative {
+   private:
+    std::string_view name;
+    const void* pattern;
+    uintptr_t (*scan)(const void* pattern);
+
+    std::once_flag resolved;
+    std::atomic<Func> func = nullptr;
+
+   public:
+    /**
+     * @brief Creates a new lazy native.
+     * @note Does not perform any scanning.
+     *
+     * @param name The name of the native, used in logging.
+     * @param pattern The pattern to sigscan for. Must outlive this object.
+     */
+    template <size_t n>
+    LazyNative(std::string_view name, const memory::Pattern<n>& pattern)
+        : name(name), pattern(&pattern), scan([](const void* pattern) {
+              return static_cast<const memory::Pattern<n>*>(pattern)->sigscan_nullable();
+          }) {}
+
+    LazyNative(const LazyNative&) = delete;
+    LazyNative(LazyNative&&) = delete;
+    LazyNative& operator=(const LazyNative&) = delete;
+    LazyNative& operator=(LazyNative&&) = delete;
+    ~LazyNative() = default;
+
+    /**
+     * @brief Sigscans for the native, if this hasn't been done yet.
+     * @note Thread safe, only one scan will ever run, other callers wait for it to finish.
+     *
+     * @return The native, or nullptr if it couldn't be found.
+     */
+    Func resolve(void) {
+        auto func_ptr = this->func.load(std::memory_order_acquire);
+        if (func_ptr != nullptr) {
+            return func_ptr;
+        }
+
+        std::call_once(this->resolved, [this]() {
+            auto found = reinterpret_cast<Func>(this->scan(this->pattern));
+            LOG(MISC, "{}: {:p}", this->name, reinterpret_cast<void*>(found));
+            this->func.store(found, std::memory_order_release);
+        });
+        return this->func.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Calls the native, sigscanning for it first if required.
+     * @note Throws if the native couldn't be found.
+     *
+     * @param args The args to call the native with.
+     * @return The native's return value.
+     */
+    template <typename... Args>
+    decltype(auto) operator()(Args&&... args) {
+        auto func_ptr = this->resolve();
+        if (func_ptr == nullptr) {
+            throw std::runtime_error(std::format("Couldn't find native {}", this->name));
+        }
+        return func_ptr(std::forward<Args>(args)...);
+    }
+};
+
+}  // namespace unrealsdk::game
+
+#endif
+
+#endif /* UNREALSDK_GAME_LAZY_NATIVE_H */
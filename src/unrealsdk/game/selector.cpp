@@ -20,7 +20,24 @@ namespace {
 
 // Tuple of all hook types to consider.
 // The first matching hook will be used, order matters.
-#if UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW
+#ifdef UNREALSDK_STATIC_OFFSETS
+// If we've baked in offsets, we can only support the game they came from
+#if UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1
+using all_known_games = std::tuple<BL1Hook>;
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1E
+using all_known_games = std::tuple<BL1EHook>;
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL2
+using all_known_games = std::tuple<BL2Hook>;
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_TPS
+using all_known_games = std::tuple<TPSHook>;
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL3
+using all_known_games = std::tuple<BL3Hook>;
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL4
+using all_known_games = std::tuple<BL4Hook>;
+#else
+#error Unknown static offsets game
+#endif
+#elif UNREALSDK_FLAVOUR == UNREALSDK_FLAVOUR_WILLOW
 using all_known_32_bit_games = std::tuple<BL1Hook, BL2Hook, TPSHook>;
 using all_known_64_bit_games = std::tuple<BL1EHook>;
 
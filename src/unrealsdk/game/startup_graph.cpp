@@ -0,0 +1,168 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/config.h"
+#include "unrealsdk/game/startup_graph.h"
+#include "unrealsdk/profiling.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::game {
+
+namespace {
+
+// May be returned as 0 if not supported, in which case just pick a reasonable amount
+const constexpr size_t DEFAULT_STARTUP_THREADS = 8;
+
+using duration_ms = std::chrono::duration<float, std::milli>;
+
+}  // namespace
+
+StartupGraph& StartupGraph::add(std::string_view name,
+                                std::function<void(void)> func,
+                                std::initializer_list<std::string_view> dependencies) {
+    auto find_step = [this](std::string_view step_name) {
+        return std::ranges::find(this->steps, step_name, &Step::name);
+    };
+
+    if (find_step(name) != this->steps.end()) {
+        throw std::invalid_argument(std::format("Duplicate startup step '{}'", name));
+    }
+
+    const size_t idx = this->steps.size();
+    for (const auto& dependency : dependencies) {
+        auto dep_step = find_step(dependency);
+        if (dep_step == this->steps.end()) {
+            throw std::invalid_argument(
+                std::format("Startup step '{}' depends on unknown step '{}'", name, dependency));
+        }
+        dep_step->dependents.push_back(idx);
+    }
+
+    this->steps.push_back({.name = name,
+                           .func = std::move(func),
+                           .num_dependencies = dependencies.size(),
+                           .dependents = {}});
+    return *this;
+}
+
+void StartupGraph::run(void) {
+    if (this->steps.empty()) {
+        return;
+    }
+
+    size_t num_threads = std::thread::hardware_concurrency();
+    if (num_threads == 0) {
+        num_threads = DEFAULT_STARTUP_THREADS;
+    }
+    auto configured_threads = config::get_int("unrealsdk.startup_threads");
+    if (configured_threads.has_value() && *configured_threads > 0) {
+        num_threads = static_cast<size_t>(*configured_threads);
+    }
+    num_threads = std::min(num_threads, this->steps.size());
+
+    std::mutex mutex{};
+    std::condition_variable step_finished{};
+    std::queue<size_t> ready{};
+    size_t num_running = 0;
+    std::exception_ptr error = nullptr;
+    duration_ms serial_time{};
+
+    std::vector<size_t> remaining_dependencies{};
+    remaining_dependencies.reserve(this->steps.size());
+    for (size_t i = 0; i < this->steps.size(); i++) {
+        remaining_dependencies.push_back(this->steps[i].num_dependencies);
+        if (this->steps[i].num_dependencies == 0) {
+            ready.push(i);
+        }
+    }
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock{mutex};
+        while (true) {
+            // Since there are no cycles, if nothing's ready and nothing's running, we're done
+            step_finished.wait(lock, [&]() {
+                return (!ready.empty() && error == nullptr) || num_running == 0;
+            });
+            if (error != nullptr || ready.empty()) {
+                return;
+            }
+
+            const auto idx = ready.front();
+            ready.pop();
+            num_running++;
+            lock.unlock();
+
+            auto& step = this->steps[idx];
+            std::exception_ptr step_error = nullptr;
+
+            auto start = std::chrono::steady_clock::now();
+            try {
+                const profiling::ScopedTimer timer{step.name, "startup"};
+                step.func();
+            } catch (...) {
+                step_error = std::current_exception();
+            }
+            const duration_ms step_time = std::chrono::steady_clock::now() - start;
+
+            LOG(MISC, "Startup step {} {} in {:.2f}ms", step.name,
+                step_error == nullptr ? "finished" : "failed", step_time.count());
+
+            lock.lock();
+            num_running--;
+            serial_time += step_time;
+
+            if (step_error != nullptr) {
+                if (error == nullptr) {
+                    error = step_error;
+                }
+            } else {
+                for (auto dependent : step.dependents) {
+                    if (--remaining_dependencies[dependent] == 0) {
+                        ready.push(dependent);
+                    }
+                }
+            }
+            step_finished.notify_all();
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    // The current thread counts as one of the workers
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; i++) {
+        threads.emplace_back([&worker]() {
+            SetThreadDescription(GetCurrentThread(), L"unrealsdk startup");
+            worker();
+        });
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const duration_ms total_time = std::chrono::steady_clock::now() - start;
+    LOG(MISC, "Ran {} startup steps on {} threads in {:.2f}ms ({:.2f}ms if run serially)",
+        this->steps.size(), num_threads, total_time.count(), serial_time.count());
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+void StartupGraph::run_in_background(void) {
+    std::thread([graph = std::move(*this)]() mutable {
+        SetThreadDescription(GetCurrentThread(), L"unrealsdk background startup");
+        try {
+            graph.run();
+        } catch (const std::exception& ex) {
+            LOG(ERROR, "Background startup step failed: {}", ex.what());
+        }
+    }).detach();
+    this->steps.clear();
+}
+
+}  // namespace unrealsdk::game
+
+#endif
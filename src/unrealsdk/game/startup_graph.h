@@ -0,0 +1,60 @@
+#ifndef UNREALSDK_GAME_STARTUP_GRAPH_H
+#define UNREALSDK_GAME_STARTUP_GRAPH_H
+
+#include "unrealsdk/pch.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::game {
+
+/**
+ * @brief A set of initialization steps, which run concurrently where their dependencies allow.
+ * @note Intended for game hooks, to run all their independent sigscans at the same time.
+ */
+class StartupGraph {
+   private:
+    struct Step {
+        std::string_view name;
+        std::function<void(void)> func;
+        size_t num_dependencies;
+        std::vector<size_t> dependents;
+    };
+
+    std::vector<Step> steps;
+
+   public:
+    /**
+     * @brief Adds a step to the graph.
+     * @note All dependencies must have already been added, which also means there can't be cycles.
+     *
+     * @param name The name of the step. Used both to refer to it in dependencies, and in logging.
+     * @param func The function to run.
+     * @param dependencies The names of the steps which must complete before this one starts.
+     * @return A reference to this graph.
+     */
+    StartupGraph& add(std::string_view name,
+                      std::function<void(void)> func,
+                      std::initializer_list<std::string_view> dependencies = {});
+
+    /**
+     * @brief Runs all steps, logging how long each one took.
+     * @note The number of threads may be limited using the `unrealsdk.startup_threads` setting.
+     * @note If any step throws, no new steps are started, and the first exception is rethrown once
+     *       all running steps finish.
+     */
+    void run(void);
+
+    /**
+     * @brief Runs all steps on a detached background thread.
+     * @note Intended for work which isn't on the critical path, e.g. resolving lazy natives ahead
+     *       of time. Any exceptions are logged rather than rethrown.
+     * @note Moves out of this graph, it is left empty.
+     */
+    void run_in_background(void);
+};
+
+}  // namespace unrealsdk::game
+
+#endif
+
+#endif /* UNREALSDK_GAME_STARTUP_GRAPH_H */
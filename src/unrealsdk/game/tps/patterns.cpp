@@ -0,0 +1,10 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/game/tps/patterns.h"
+
+// Unlike the rest of the game hooks, this isn't limited to the current flavour, so that offline
+// tools may validate every game's patterns at once
+namespace unrealsdk::game::tps::patterns {
+
+UNREALSDK_REGISTER_PATTERN("tps", ARRAY_LIMIT_MESSAGE);
+
+}  // namespace unrealsdk::game::tps::patterns
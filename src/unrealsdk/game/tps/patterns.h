@@ -0,0 +1,20 @@
+#ifndef UNREALSDK_GAME_TPS_PATTERNS_H
+#define UNREALSDK_GAME_TPS_PATTERNS_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the patterns can be validated offline, on any platform, without the rest of the sdk.
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::game::tps::patterns {
+
+using unrealsdk::memory::Pattern;
+
+inline constexpr Pattern<11> ARRAY_LIMIT_MESSAGE{
+    "7C ??"           // jl BorderlandsPreSequel.exe+C3826
+    "8B 8D ????????"  // mov ecx, [ebp-0000116C]
+    "83 C0 9D"        // add eax, -63
+};
+
+}  // namespace unrealsdk::game::tps::patterns
+
+#endif /* UNREALSDK_GAME_TPS_PATTERNS_H */
@@ -12,7 +12,7 @@ namespace unrealsdk::game {
 
 class TPSHook : public BL2Hook {
    protected:
-    void hexedit_array_limit_message(void) const override;
+    [[nodiscard]] memory::PatchSpec array_limit_message_patch(void) const override;
 
    public:
     void fname_init(unreal::FName* name, const wchar_t* str, uint32_t number) const override;
@@ -0,0 +1,391 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/config.h"
+#include "unrealsdk/gc.h"
+#include "unrealsdk/memory.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/find_class.h"
+#include "unrealsdk/utils.h"
+
+using namespace unrealsdk::unreal;
+
+namespace unrealsdk::gc {
+
+namespace {
+
+using DLLSafeCallback = utils::DLLSafeCallback<Callback>;
+
+/*
+The generation table is split into lazily allocated chunks, so we don't need to know how many
+objects there are up front, and so that it's never reallocated while another thread's reading it.
+Since it's never reallocated, other modules can also read it directly, rather than going through an
+exported function call every time.
+*/
+
+const constexpr size_t GENERATION_CHUNK_SIZE = 0x10000;
+const constexpr size_t GENERATION_MAX_CHUNKS = MAX_TRACKED_GENERATIONS / GENERATION_CHUNK_SIZE;
+
+using GenerationChunk = std::array<std::atomic<uint32_t>, GENERATION_CHUNK_SIZE>;
+using GenerationTable = std::array<std::atomic<GenerationChunk*>, GENERATION_MAX_CHUNKS>;
+
+#ifndef UNREALSDK_IMPORTING
+
+enum class TrackingState : uint8_t {
+    // BeginDestroy hasn't been hooked.
+    NOT_HOOKED,
+    // We've hooked the configured function, but haven't yet seen it called on an object which is
+    // actually being destroyed.
+    UNVERIFIED,
+    // The hook has been confirmed to be BeginDestroy.
+    TRACKING,
+    // The hook turned out not to be BeginDestroy, so we're ignoring it.
+    DISABLED,
+};
+std::atomic<TrackingState> tracking_state = TrackingState::NOT_HOOKED;
+
+/*
+Unreal sets RF_BeginDestroyed just before calling BeginDestroy, and RF_FinishDestroyed just before
+calling FinishDestroy - conveniently, they have the same values in every engine version we support.
+If we see the hooked function called on an object without this combination, it's not BeginDestroy,
+and we must have been given the wrong vf index.
+*/
+const constexpr uint64_t RF_BEGIN_DESTROYED = 0x8000;
+const constexpr uint64_t RF_FINISH_DESTROYED = 0x10000;
+
+std::atomic<uint64_t> current_epoch = 0;
+
+// Subscriptions are shared pointers so that we can safely run them outside of the lock, in case a
+// callback tries to (un)subscribe
+std::mutex subscriptions_mutex{};
+utils::StringViewMap<std::wstring, std::shared_ptr<DLLSafeCallback>> subscriptions{};
+std::atomic<bool> have_subscriptions = false;
+
+GenerationTable generations{};
+
+/**
+ * @brief Gets the entry in the generation table for the given index, allocating it if needed.
+ *
+ * @param idx The slot's index.
+ * @return A pointer to the entry, or nullptr if the index is out of range.
+ */
+std::atomic<uint32_t>* get_generation_entry(size_t idx) {
+    auto chunk_idx = idx / GENERATION_CHUNK_SIZE;
+    if (chunk_idx >= GENERATION_MAX_CHUNKS) {
+        return nullptr;
+    }
+
+    auto& chunk_ptr = generations.at(chunk_idx);
+    auto chunk = chunk_ptr.load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        auto new_chunk = std::make_unique<GenerationChunk>();
+        if (chunk_ptr.compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel)) {
+            chunk = new_chunk.release();
+        }
+        // Otherwise another thread beat us to it, and chunk has been set to theirs
+    }
+
+    return &chunk->at(idx % GENERATION_CHUNK_SIZE);
+}
+
+std::mutex pending_mutex{};
+std::vector<int32_t> pending_indexes{};
+std::atomic<bool> have_pending = false;
+
+#endif
+
+}  // namespace
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] bool, gc_is_tracking);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] bool, gc_is_tracking) {
+    return tracking_state.load() == TrackingState::TRACKING;
+}
+#endif
+
+bool is_tracking(void) {
+    return UNREALSDK_MANGLE(gc_is_tracking)();
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] uint64_t, gc_epoch);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] uint64_t, gc_epoch) {
+    return current_epoch.load(std::memory_order_acquire);
+}
+#endif
+
+uint64_t epoch(void) {
+    return UNREALSDK_MANGLE(gc_epoch)();
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] const GenerationTable*, gc_generation_table);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] const GenerationTable*, gc_generation_table) {
+    return &generations;
+}
+#endif
+
+uint32_t generation(size_t index) {
+    // This is hit on some hot paths, so only look up the table once, then read it directly
+    static const GenerationTable* table = UNREALSDK_MANGLE(gc_generation_table)();
+
+    auto chunk_idx = index / GENERATION_CHUNK_SIZE;
+    if (chunk_idx >= GENERATION_MAX_CHUNKS) {
+        return 0;
+    }
+
+    // Don't allocate when reading, a missing chunk just means nothing in it was destroyed yet
+    auto chunk = table->at(chunk_idx).load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        return 0;
+    }
+    return chunk->at(index % GENERATION_CHUNK_SIZE).load(std::memory_order_acquire);
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(bool,
+               gc_subscribe,
+               const wchar_t* identifier,
+               size_t size,
+               DLLSafeCallback&& callback);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(bool,
+               gc_subscribe,
+               const wchar_t* identifier,
+               size_t size,
+               DLLSafeCallback&& callback) {
+    const std::scoped_lock lock(subscriptions_mutex);
+
+    const std::wstring_view identifier_view{identifier, size};
+    if (subscriptions.contains(identifier_view)) {
+        return false;
+    }
+
+    subscriptions.emplace(identifier_view, std::make_shared<DLLSafeCallback>(std::move(callback)));
+    have_subscriptions.store(true);
+    return true;
+}
+#endif
+
+bool subscribe(std::wstring_view identifier, const Callback& callback) {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return UNREALSDK_MANGLE(gc_subscribe)(identifier.data(), identifier.size(), {callback});
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] bool, gc_is_subscribed, const wchar_t* identifier, size_t size);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] bool, gc_is_subscribed, const wchar_t* identifier, size_t size) {
+    const std::scoped_lock lock(subscriptions_mutex);
+    return subscriptions.contains(std::wstring_view{identifier, size});
+}
+#endif
+
+bool is_subscribed(std::wstring_view identifier) {
+    return UNREALSDK_MANGLE(gc_is_subscribed)(identifier.data(), identifier.size());
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(bool, gc_unsubscribe, const wchar_t* identifier, size_t size);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(bool, gc_unsubscribe, const wchar_t* identifier, size_t size) {
+    const std::scoped_lock lock(subscriptions_mutex);
+
+    auto iter = subscriptions.find(std::wstring_view{identifier, size});
+    if (iter == subscriptions.end()) {
+        return false;
+    }
+
+    subscriptions.erase(iter);
+    have_subscriptions.store(!subscriptions.empty());
+    return true;
+}
+#endif
+
+bool unsubscribe(std::wstring_view identifier) {
+    return UNREALSDK_MANGLE(gc_unsubscribe)(identifier.data(), identifier.size());
+}
+
+namespace impl {
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace {
+
+/**
+ * @brief Gets one of the base object's virtual functions, checking it looks valid.
+ *
+ * @param idx The vf index to get.
+ * @param log_errors True if to log why the index is invalid.
+ * @return The address of the function, or 0 if the index is invalid.
+ */
+uintptr_t get_object_vf(size_t idx, bool log_errors) {
+    // Every override eventually calls the base implementation, so hooking it on the base object
+    // class is enough to catch all objects
+    auto default_obj = find_class(L"Object"_fn)->ClassDefaultObject();
+
+    // A bad index could easily run off the end of the vftable, make sure what we read is at least
+    // still a function in the exe before we try hook it
+    auto [exe_start, exe_size] = memory::get_exe_range();
+    auto entry = reinterpret_cast<uintptr_t>(&default_obj->vftable[idx]);
+    if (entry < exe_start || entry + sizeof(uintptr_t) > exe_start + exe_size) {
+        if (log_errors) {
+            LOG(ERROR,
+                "Not tracking destroyed objects, BeginDestroy vf index {} is outside the exe", idx);
+        }
+        return 0;
+    }
+    auto addr = default_obj->vftable[idx];
+    if (!memory::is_exe_code(addr)) {
+        if (log_errors) {
+            LOG(ERROR,
+                "Not tracking destroyed objects, BeginDestroy vf index {} doesn't point at any "
+                "code",
+                idx);
+        }
+        return 0;
+    }
+
+    return addr;
+}
+
+}  // namespace
+
+uintptr_t find_begin_destroy(void) {
+    auto idx = config::get_int<size_t>("unrealsdk.uobject_begin_destroy_vf_index");
+    if (!idx.has_value()) {
+#if UNREALSDK_DEFAULT_BEGIN_DESTROY_VF_IDX < 0
+        LOG(MISC, "Not tracking destroyed objects, since BeginDestroy's vf index isn't set");
+        return 0;
+#else
+        idx = UNREALSDK_DEFAULT_BEGIN_DESTROY_VF_IDX;
+#endif
+    }
+
+    return get_object_vf(*idx, true);
+}
+
+uintptr_t find_begin_destroy(const uint8_t* bytes,
+                             const uint8_t* mask,
+                             size_t pattern_size,
+                             const memory::PatternSearchInfo& info) {
+    auto idx = config::get_int<size_t>("unrealsdk.uobject_begin_destroy_vf_index");
+    if (idx.has_value()) {
+        return get_object_vf(*idx, true);
+    }
+
+    // Only searching the object's own virtual functions, rather than the whole exe, means the
+    // pattern only needs to tell BeginDestroy apart from it's siblings. The vftable has no explicit
+    // end, so keep going until we run into something which isn't code.
+    auto [exe_start, exe_size] = memory::get_exe_range();
+    for (size_t i = 0;; i++) {
+        auto addr = get_object_vf(i, false);
+        if (addr == 0) {
+            break;
+        }
+
+        auto search_size = std::min<size_t>(BEGIN_DESTROY_SEARCH_SIZE, exe_start + exe_size - addr);
+        if (memory::sigscan(bytes, mask, pattern_size, info, addr, search_size) != 0) {
+            LOG(MISC, "Found BeginDestroy at vf index {}", i);
+            return addr;
+        }
+    }
+
+    LOG(ERROR, "Not tracking destroyed objects, couldn't find BeginDestroy in the object vftable");
+    return 0;
+}
+
+void start_tracking(void) {
+    // Don't actually start tracking until we've verified the hook, see `object_destroyed`
+    tracking_state.store(TrackingState::UNVERIFIED);
+}
+
+void object_destroyed(const UObject* obj) {
+    auto state = tracking_state.load(std::memory_order_relaxed);
+    if (state != TrackingState::TRACKING) {
+        if (state != TrackingState::UNVERIFIED) {
+            return;
+        }
+
+        auto flags = static_cast<uint64_t>(obj->ObjectFlags());
+        if ((flags & (RF_BEGIN_DESTROYED | RF_FINISH_DESTROYED)) != RF_BEGIN_DESTROYED) {
+            if (tracking_state.compare_exchange_strong(state, TrackingState::DISABLED)) {
+                LOG(ERROR,
+                    "Hooked function was called on an object which isn't being destroyed, the "
+                    "BeginDestroy vf index must be wrong. Destroyed objects will not be tracked.");
+            }
+            return;
+        }
+
+        // Only one thread can win the swap, so we only log this once. If we lose, another thread
+        // has already verified it.
+        if (tracking_state.compare_exchange_strong(state, TrackingState::TRACKING)) {
+            LOG(MISC, "Verified BeginDestroy hook, now tracking destroyed objects");
+        }
+    }
+
+    // Need to bump the epoch on every single object, rather than once per batch, since a cache may
+    // have added something to be destroyed later in the same batch
+    current_epoch.fetch_add(1, std::memory_order_release);
+
+    auto entry = get_generation_entry(static_cast<size_t>(obj->InternalIndex()));
+    if (entry != nullptr) {
+        entry->fetch_add(1, std::memory_order_release);
+    }
+
+    if (!have_subscriptions.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    const std::scoped_lock lock(pending_mutex);
+    pending_indexes.push_back(obj->InternalIndex());
+    have_pending.store(true, std::memory_order_relaxed);
+}
+
+void flush_destroyed_objects(void) {
+    if (!have_pending.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::vector<int32_t> batch{};
+    {
+        const std::scoped_lock lock(pending_mutex);
+        batch.swap(pending_indexes);
+        have_pending.store(false, std::memory_order_relaxed);
+    }
+    if (batch.empty()) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<DLLSafeCallback>> callbacks{};
+    {
+        const std::scoped_lock lock(subscriptions_mutex);
+        callbacks.reserve(subscriptions.size());
+        for (const auto& [_, callback] : subscriptions) {
+            callbacks.push_back(callback);
+        }
+    }
+
+    for (const auto& callback : callbacks) {
+        try {
+            (*callback)(batch.data(), batch.size());
+        } catch (const std::exception& ex) {
+            LOG(ERROR, "An exception occurred during a destroyed objects callback: {}", ex.what());
+        }
+    }
+}
+
+#endif
+
+}  // namespace impl
+
+}  // namespace unrealsdk::gc
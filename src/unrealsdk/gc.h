@@ -0,0 +1,161 @@
+#ifndef UNREALSDK_GC_H
+#define UNREALSDK_GC_H
+
+#include "unrealsdk/pch.h"
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::unreal {
+
+class UObject;
+
+}  // namespace unrealsdk::unreal
+
+namespace unrealsdk::gc {
+
+/*
+You can use this module to find out when unreal destroys objects, so that caches holding raw object
+pointers don't need to re-query GObjects to check if they're still valid.
+
+The simplest way is via the epoch, which is incremented every time an object starts being destroyed.
+If you record the epoch when adding an entry to a cache, and it's still the same when you read it
+back, no objects have been destroyed in between, so the entry is still valid.
+
+For finer grained invalidation, you can subscribe to be notified of exactly which objects were
+destroyed. Destroyed objects are collected into batches, which are delivered the next time the game
+runs a hooked function - i.e. typically just after the garbage collection pass which destroyed them.
+
+Objects are tracked by hooking `UObject::BeginDestroy`. Since it's virtual function index varies
+between games, we only have a default for some of them, the rest search the base object's vftable
+for an entry matching a sigscan pattern, which can be overwritten using the
+`uobject_begin_destroy_vf_index` setting. Since a wrong function could otherwise silently
+corrupt the generation table, tracking only starts once the hook has been seen running on an object
+which unreal has flagged as being destroyed - if it's ever called on one which isn't, tracking stays
+disabled for good. Use `is_tracking` to check if it's active. While not tracking, the epoch never
+changes.
+
+We also keep a generation counter for each GObjects slot, incremented whenever the object in it is
+destroyed. Much like the serial numbers UE4 uses for it's weak pointers, if a slot's generation is
+the same as when you first saw an object in it, it's still the same, live, object.
+*/
+
+/// Slots at or past this index don't have their generations tracked.
+constexpr size_t MAX_TRACKED_GENERATIONS = 0x4000000;
+
+/**
+ * @brief A callback for when a batch of objects gets destroyed.
+ *
+ * @param indexes Pointer to the internal indexes of each destroyed object. The objects themselves
+ *                are no longer safe to access.
+ * @param count The number of indexes.
+ */
+using Callback = std::function<void(const int32_t*, size_t)>;
+
+/**
+ * @brief Checks if object destruction is being tracked.
+ *
+ * @return True if tracking, false if the epoch will never change, and callbacks will never run.
+ */
+[[nodiscard]] bool is_tracking(void);
+
+/**
+ * @brief Gets the current gc epoch.
+ * @note This is monotonically increasing, and changes every time an object starts being destroyed.
+ *
+ * @return The current epoch.
+ */
+[[nodiscard]] uint64_t epoch(void);
+
+/**
+ * @brief Gets the generation of a GObjects slot.
+ * @note Always 0 while not tracking, or for slots past `MAX_TRACKED_GENERATIONS`.
+ *
+ * @param index The slot's index.
+ * @return The slot's generation.
+ */
+[[nodiscard]] uint32_t generation(size_t index);
+
+/**
+ * @brief Subscribes to notifications of destroyed objects.
+ *
+ * @param identifier The subscription identifier.
+ * @param callback The callback to run on each batch of destroyed objects.
+ * @return True if successfully subscribed, false if a subscription with the same identifier exists.
+ */
+bool subscribe(std::wstring_view identifier, const Callback& callback);
+
+/**
+ * @brief Checks if a subscription exists.
+ *
+ * @param identifier The subscription identifier.
+ * @return True if subscribed.
+ */
+[[nodiscard]] bool is_subscribed(std::wstring_view identifier);
+
+/**
+ * @brief Removes a subscription.
+ *
+ * @param identifier The subscription identifier.
+ * @return True if successfully removed, false if no such subscription exists.
+ */
+bool unsubscribe(std::wstring_view identifier);
+
+namespace impl {  // These functions are only relevant when implementing a game hook
+
+#ifndef UNREALSDK_IMPORTING
+
+/**
+ * @brief Finds the address of `UObject::BeginDestroy`, which game hooks should detour.
+ * @note Requires unrealsdk to be initialized.
+ * @note Checks the address is code within the exe, but can't check that it's the right function.
+ * @note If given a pattern, and the vf index isn't configured, instead of the flavour's default
+ *       index, picks the first of the base object's virtual functions which matches the pattern
+ *       somewhere within it's first `BEGIN_DESTROY_SEARCH_SIZE` bytes.
+ *
+ * @tparam n The size of the sigscan pattern (should be picked up automatically).
+ * @param bytes The bytes to search for. Must already be masked.
+ * @param mask The mask over the bytes to search for.
+ * @param pattern_size The size of the bytes + mask.
+ * @param info Precomputed search metadata for the pattern.
+ * @param pattern A sigscan pattern matching code near the start of the function.
+ * @return The address of the function, or 0 if it's not been configured, or looks invalid.
+ */
+[[nodiscard]] uintptr_t find_begin_destroy(void);
+[[nodiscard]] uintptr_t find_begin_destroy(const uint8_t* bytes,
+                                           const uint8_t* mask,
+                                           size_t pattern_size,
+                                           const memory::PatternSearchInfo& info);
+template <size_t n>
+[[nodiscard]] uintptr_t find_begin_destroy(const memory::Pattern<n>& pattern) {
+    return find_begin_destroy(pattern.bytes.data(), pattern.mask.data(), n, pattern.search);
+}
+
+/// How far into each virtual function `find_begin_destroy` searches for the pattern.
+constexpr size_t BEGIN_DESTROY_SEARCH_SIZE = 0x80;
+
+/**
+ * @brief Marks that the BeginDestroy hook has been set up.
+ * @note Tracking only actually starts once `object_destroyed` has verified the hook.
+ */
+void start_tracking(void);
+
+/**
+ * @brief Records that an object started being destroyed.
+ * @note Should be called at the start of the `UObject::BeginDestroy` hook.
+ * @note The first call verifies the hook, by checking the object's flags.
+ *
+ * @param obj The object being destroyed.
+ */
+void object_destroyed(const unreal::UObject* obj);
+
+/**
+ * @brief Notifies all subscribers of any objects destroyed since the last flush.
+ */
+void flush_destroyed_objects(void);
+
+#endif
+
+}  // namespace impl
+
+}  // namespace unrealsdk::gc
+
+#endif /* UNREALSDK_GC_H */
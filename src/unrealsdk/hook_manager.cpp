@@ -1,7 +1,10 @@
 #include "unrealsdk/pch.h"
 
+#include "unrealsdk/async_hooks.h"
 #include "unrealsdk/config.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/hook_manager.h"
+#include "unrealsdk/unreal/classes/uclass.h"
 #include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/structs/fframe.h"
@@ -16,6 +19,20 @@ namespace unrealsdk::hook_manager {
 
 using DLLSafeCallback = utils::DLLSafeCallback<Callback>;
 
+bool Filter::matches(const UObject* obj) const {
+    // Check in rough order of cost
+    if (this->name.has_value() && (obj == nullptr || obj->Name() != *this->name)) {
+        return false;
+    }
+    if (this->obj.has_value() && (obj == nullptr || **this->obj != obj)) {
+        return false;
+    }
+    if (this->cls != nullptr && (obj == nullptr || !obj->is_instance(this->cls))) {
+        return false;
+    }
+    return true;
+}
+
 #pragma region Implementation
 #ifndef UNREALSDK_IMPORTING
 namespace impl {
@@ -79,13 +96,112 @@ Collection | [A] -> [B]    [C]    [D] -> [E]    [F]    [G]
 Each column is a single node, a node may be in multiple linked lists.
 */
 
+namespace {
+
+/// Per-thread state for a throttled hook.
+struct ThrottleState {
+    // The id of the hook this state belongs to, since slots get recycled
+    uint64_t owner;
+    uint32_t calls;
+    bool selected;
+};
+
+/// A throttled hook's index into the per-thread states, plus a unique id to detect reuse.
+struct ThrottleSlot {
+    size_t index;
+    uint64_t id;
+};
+
+const constexpr size_t MIN_THROTTLE_STATES_CAPACITY = 16;
+
+std::mutex throttle_slots_mutex{};
+std::vector<size_t> free_throttle_slots{};
+size_t next_throttle_slot = 0;
+uint64_t next_throttle_id = 1;
+// How many states each thread should hold. Only grows, and only while registering a hook.
+std::atomic<size_t> throttle_states_capacity = 0;
+
+thread_local std::vector<ThrottleState> throttle_states{};
+
+/**
+ * @brief Allocates a slot in the per-thread throttle states, reusing a freed one if possible.
+ *
+ * @return The allocated slot.
+ */
+ThrottleSlot alloc_throttle_slot(void) {
+    const std::scoped_lock lock(throttle_slots_mutex);
+
+    size_t index{};
+    if (free_throttle_slots.empty()) {
+        index = next_throttle_slot++;
+        auto capacity = throttle_states_capacity.load(std::memory_order_relaxed);
+        if (index >= capacity) {
+            capacity = std::max(capacity * 2, MIN_THROTTLE_STATES_CAPACITY);
+            throttle_states_capacity.store(capacity, std::memory_order_release);
+        }
+    } else {
+        index = free_throttle_slots.back();
+        free_throttle_slots.pop_back();
+    }
+
+    // Size this thread's states now, other threads catch up the first time they run a hook past
+    // the end of theirs - which, since the capacity doubles, should only happen a few times ever
+    if (throttle_states.size() < throttle_states_capacity.load(std::memory_order_relaxed)) {
+        throttle_states.resize(throttle_states_capacity.load(std::memory_order_relaxed));
+    }
+
+    return {.index = index, .id = next_throttle_id++};
+}
+
+/**
+ * @brief Frees a slot in the per-thread throttle states, so it can be reused.
+ *
+ * @param slot The slot to free.
+ */
+void free_throttle_slot(const ThrottleSlot& slot) {
+    const std::scoped_lock lock(throttle_slots_mutex);
+    free_throttle_slots.push_back(slot.index);
+}
+
+/**
+ * @brief Checks if a throttle actually limits anything.
+ *
+ * @param throttle The throttle to check.
+ * @return True if the throttle may skip calls.
+ */
+bool is_throttled(const Throttle& throttle) {
+    return throttle.sample_every > 1 || throttle.max_per_second > 0;
+}
+
+}  // namespace
+
 struct Node {
    public:
     FName fname;
     std::wstring full_name;
     Type type;
     std::wstring identifier;
-    DLLSafeCallback callback;
+    // Shared, since wildcard hooks use the same callback on every function they match
+    std::shared_ptr<DLLSafeCallback> callback;
+    Filter filter;
+    Throttle throttle;
+    // True if this node was added by matching a wildcard hook. These use a separate set of
+    // identifiers to normal hooks.
+    bool wildcard;
+
+    // If this node was added or removed as part of a batch, the flag which is set once the batch is
+    // committed. This lets an entire batch become visible at once.
+    std::shared_ptr<const std::atomic<bool>> added_flag;
+    std::atomic<const std::atomic<bool>*> removal_flag = nullptr;
+    std::shared_ptr<const std::atomic<bool>> removal_flag_owner;
+
+    // Slot in the per-thread throttle states, only used if throttled.
+    ThrottleSlot throttle_slot;
+
+    // Rate limiting is a token bucket, stored as the time at which it'll be completely refilled,
+    // so that it can be updated with a single atomic.
+    int64_t rate_interval_ns;
+    std::atomic<int64_t> bucket_full_at_ns = 0;
 
     // Using shared pointers because it's easy
     // Since we use std::make_shared, we're not really wasting allocations, but as a future
@@ -100,12 +216,129 @@ struct Node {
          std::wstring_view full_name,
          Type type,
          std::wstring_view identifier,
-         DLLSafeCallback&& callback)
+         std::shared_ptr<DLLSafeCallback> callback,
+         const Filter& filter,
+         const Throttle& throttle,
+         bool wildcard,
+         std::shared_ptr<const std::atomic<bool>> added_flag)
         : fname(fname),
           full_name(full_name),
           type(type),
           identifier(identifier),
-          callback(std::move(callback)) {}
+          callback(std::move(callback)),
+          filter(filter),
+          throttle(throttle),
+          wildcard(wildcard),
+          added_flag(std::move(added_flag)),
+          throttle_slot(is_throttled(throttle) ? alloc_throttle_slot() : ThrottleSlot{}),
+          rate_interval_ns(throttle.max_per_second > 0
+                               ? std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::duration<double>{1 / throttle.max_per_second})
+                                     .count()
+                               : 0) {}
+
+    Node(const Node&) = delete;
+    Node(Node&&) = delete;
+    Node& operator=(const Node&) = delete;
+    Node& operator=(Node&&) = delete;
+    ~Node() {
+        if (is_throttled(this->throttle)) {
+            free_throttle_slot(this->throttle_slot);
+        }
+    }
+
+    /**
+     * @brief Checks if this node is live, i.e. it's not part of a batch which is yet to be
+     *        committed, and it's not been removed by a batch which has been.
+     *
+     * @return True if this node is live.
+     */
+    [[nodiscard]] bool live(void) const {
+        if (this->added_flag != nullptr && !this->added_flag->load(std::memory_order_acquire)) {
+            return false;
+        }
+        const auto* removal = this->removal_flag.load(std::memory_order_acquire);
+        return removal == nullptr || !removal->load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Decides if this hook should run on the current call, based on it's throttle.
+     * @note Advances the throttle, so must only be called once per call.
+     *
+     * @return True if the hook should run.
+     */
+    bool select(void) {
+        if (!is_throttled(this->throttle)) {
+            return true;
+        }
+        if (this->throttle_slot.index >= throttle_states.size()) {
+            // Another thread registered this hook, catch up to the capacity it left
+            throttle_states.resize(throttle_states_capacity.load(std::memory_order_acquire));
+        }
+        auto& state = throttle_states[this->throttle_slot.index];
+        if (state.owner != this->throttle_slot.id) {
+            // This slot was last used by a since removed hook, start fresh
+            state = {.owner = this->throttle_slot.id, .calls = 0, .selected = false};
+        }
+
+        state.selected = false;
+        if (this->throttle.sample_every > 1) {
+            const bool sampled = state.calls == 0;
+            if (++state.calls >= this->throttle.sample_every) {
+                state.calls = 0;
+            }
+            if (!sampled) {
+                return false;
+            }
+        }
+        if (this->rate_interval_ns > 0 && !this->take_token()) {
+            return false;
+        }
+        state.selected = true;
+        return true;
+    }
+
+    /**
+     * @brief Checks the decision made by the last call to `select` on this thread.
+     *
+     * @return True if the hook should run.
+     */
+    [[nodiscard]] bool selected(void) const {
+        if (!is_throttled(this->throttle)) {
+            return true;
+        }
+        if (this->throttle_slot.index >= throttle_states.size()) {
+            return false;
+        }
+        const auto& state = throttle_states[this->throttle_slot.index];
+        return state.owner == this->throttle_slot.id && state.selected;
+    }
+
+   private:
+    /**
+     * @brief Tries taking a token from this hook's rate limiting bucket.
+     *
+     * @return True if a token was available.
+     */
+    bool take_token(void) {
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count();
+        // How far past now the bucket may be refilled at while still holding a token
+        const int64_t tolerance =
+            this->rate_interval_ns * (std::max<int64_t>(this->throttle.burst, 1) - 1);
+
+        auto full_at = this->bucket_full_at_ns.load(std::memory_order_relaxed);
+        int64_t new_full_at{};
+        do {
+            if (full_at - tolerance > now) {
+                return false;
+            }
+            new_full_at = std::max(full_at, now) + this->rate_interval_ns;
+        } while (!this->bucket_full_at_ns.compare_exchange_weak(full_at, new_full_at,
+                                                                 std::memory_order_relaxed));
+        return true;
+    }
 };
 
 namespace {
@@ -113,6 +346,10 @@ namespace {
 const constexpr auto HASH_TABLE_SIZE = 0x1000;
 std::array<std::shared_ptr<Node>, HASH_TABLE_SIZE> hooks_hash_table;
 
+// Serializes everything which modifies the hash table or the wildcard hooks. Running hooks never
+// takes it, only the slow path of matching wildcard hooks against a newly seen function does.
+std::mutex hooks_mutex{};
+
 /**
  * @brief Hashes the given fname, and returns which index of the table it goes in.
  *
@@ -159,31 +396,48 @@ void inject_next_call(void) {
 }
 
 /**
- * @brief Extracts the object name from a hook function's full path name.
+ * @brief Gets the object name from a hook function's full path name.
  *
  * @param func The full function path name.
- * @return The FName we expect it's object to use.
+ * @return The name we expect it's object to use.
  */
-FName extract_func_obj_name(std::wstring_view func) {
+std::wstring_view func_obj_name(std::wstring_view func) {
     auto idx = func.find_last_of(L".:");
     if (idx == std::wstring_view::npos) {
-        return FName{std::wstring{func}};
+        return func;
     }
-    return FName{std::wstring{func.substr(idx + 1)}};
+    return func.substr(idx + 1);
 }
 
-bool add_hook(std::wstring_view func,
+/**
+ * @brief Extracts the object name from a hook function's full path name.
+ *
+ * @param func The full function path name.
+ * @return The FName we expect it's object to use.
+ */
+FName extract_func_obj_name(std::wstring_view func) {
+    return FName{std::wstring{func_obj_name(func)}};
+}
+
+bool add_hook(FName fname,
+              std::wstring_view func,
               Type type,
               std::wstring_view identifier,
-              DLLSafeCallback&& callback) {
-    auto fname = extract_func_obj_name(func);
+              const std::shared_ptr<DLLSafeCallback>& callback,
+              const Filter& filter,
+              const Throttle& throttle,
+              bool wildcard = false,
+              const std::shared_ptr<const std::atomic<bool>>& added_flag = nullptr) {
+    auto make_node = [&]() {
+        return std::make_shared<Node>(fname, func, type, identifier, callback, filter, throttle,
+                                      wildcard, added_flag);
+    };
 
     auto hash_idx = get_table_index(fname);
     auto node = hooks_hash_table.at(hash_idx);
     if (node == nullptr) {
         // This function isn't in the hash table, can just add directly.
-        hooks_hash_table.at(hash_idx) =
-            std::make_shared<Node>(fname, func, type, identifier, std::move(callback));
+        hooks_hash_table.at(hash_idx) = make_node();
         return true;
     }
 
@@ -191,8 +445,7 @@ bool add_hook(std::wstring_view func,
     while (node->fname != fname) {
         if (node->next_collision == nullptr) {
             // We found a collision, but nothing matched our name, so add it to the end
-            node->next_collision =
-                std::make_shared<Node>(fname, func, type, identifier, std::move(callback));
+            node->next_collision = make_node();
             return true;
         }
         node = node->next_collision;
@@ -202,8 +455,7 @@ bool add_hook(std::wstring_view func,
     while (node->full_name != func) {
         if (node->next_function == nullptr) {
             // We found another function with the same fname, but nothing matches the full name
-            node->next_function =
-                std::make_shared<Node>(fname, func, type, identifier, std::move(callback));
+            node->next_function = make_node();
             return true;
         }
         node = node->next_function;
@@ -213,19 +465,18 @@ bool add_hook(std::wstring_view func,
     while (node->type != type) {
         if (node->next_type == nullptr) {
             // We found the right function, but it doesn't have any hooks of this type yet
-            node->next_type =
-                std::make_shared<Node>(fname, func, type, identifier, std::move(callback));
+            node->next_type = make_node();
             return true;
         }
         node = node->next_type;
     }
 
     // Look through all remaining hooks to see if we can match the identifier
-    while (node->identifier != identifier) {
+    while (node->identifier != identifier || node->wildcard != wildcard) {
         if (node->next_in_collection == nullptr) {
             // Didn't find a matching identifier, add our new hook at the end
-            node->next_in_collection =
-                std::make_shared<Node>(fname, func, type, identifier, std::move(callback));
+            node->next_in_collection = make_node();
+            return true;
         }
         node = node->next_in_collection;
     }
@@ -234,21 +485,23 @@ bool add_hook(std::wstring_view func,
     return false;
 }
 
-bool has_hook(std::wstring_view func, Type type, std::wstring_view identifier) {
-    auto fname = extract_func_obj_name(func);
-
+std::shared_ptr<Node> find_hook(FName fname,
+                                std::wstring_view func,
+                                Type type,
+                                std::wstring_view identifier,
+                                bool wildcard = false) {
     auto hash_idx = get_table_index(fname);
     auto node = hooks_hash_table.at(hash_idx);
     if (node == nullptr) {
         // This function isn't even in the hash table
-        return false;
+        return nullptr;
     }
 
     // Look through hash collisions
     while (node->fname != fname) {
         if (node->next_collision == nullptr) {
             // We found a collision, but nothing matched our name
-            return false;
+            return nullptr;
         }
         node = node->next_collision;
     }
@@ -257,7 +510,7 @@ bool has_hook(std::wstring_view func, Type type, std::wstring_view identifier) {
     while (node->full_name != func) {
         if (node->next_function == nullptr) {
             // We found another function with the same fname, but nothing matches the full name
-            return false;
+            return nullptr;
         }
         node = node->next_function;
     }
@@ -266,26 +519,28 @@ bool has_hook(std::wstring_view func, Type type, std::wstring_view identifier) {
     while (node->type != type) {
         if (node->next_type == nullptr) {
             // We found the right function, but it doesn't have any hooks of this type
-            return false;
+            return nullptr;
         }
         node = node->next_type;
     }
 
     // Look through all remaining hooks to see if we can match the identifier
-    while (node->identifier != identifier) {
+    while (node->identifier != identifier || node->wildcard != wildcard) {
         if (node->next_in_collection == nullptr) {
             // Didn't find a matching identifier
-            return false;
+            return nullptr;
         }
         node = node->next_in_collection;
     }
 
-    return true;
+    return node;
 }
 
-bool remove_hook(std::wstring_view func, Type type, std::wstring_view identifier) {
-    auto fname = extract_func_obj_name(func);
-
+bool remove_hook(FName fname,
+                 std::wstring_view func,
+                 Type type,
+                 std::wstring_view identifier,
+                 bool wildcard = false) {
     auto hash_idx = get_table_index(fname);
     auto node = hooks_hash_table.at(hash_idx);
     if (node == nullptr) {
@@ -328,7 +583,7 @@ bool remove_hook(std::wstring_view func, Type type, std::wstring_view identifier
 
     // Look through all remaining hooks to see if we can match the identifier
     decltype(node) prev_in_collection = nullptr;
-    while (node->identifier != identifier) {
+    while (node->identifier != identifier || node->wildcard != wildcard) {
         if (node->next_in_collection == nullptr) {
             // Didn't find a matching identifier
             return false;
@@ -413,6 +668,419 @@ bool remove_hook(std::wstring_view func, Type type, std::wstring_view identifier
     return true;
 }
 
+/**
+ * @brief Decides which of the hooks on a function should run on the current call.
+ * @note Advances all throttles, so must only be called once per call.
+ *
+ * @param node The head of the function's types linked list.
+ * @param obj The object which called the function.
+ * @return True if at least one hook should run.
+ */
+bool select_hooks(std::shared_ptr<Node> node, const UObject* obj) {
+    bool any_selected = false;
+    for (; node != nullptr; node = node->next_type) {
+        for (auto hook = node; hook != nullptr; hook = hook->next_in_collection) {
+            // Only throttle calls which pass the filter
+            if (hook->live() && hook->filter.matches(obj) && hook->select()) {
+                any_selected = true;
+            }
+        }
+    }
+    return any_selected;
+}
+
+/// A set of hook changes, waiting to be committed.
+struct PendingBatch {
+    struct Change {
+        FName fname;
+        std::wstring func;
+        Type type;
+        std::wstring identifier;
+        // Null for removals
+        std::shared_ptr<DLLSafeCallback> callback;
+        Filter filter;
+        Throttle throttle;
+    };
+
+    // The FNames we've already resolved, keyed by the object name, so that each is only looked up
+    // once
+    std::unordered_map<std::wstring, FName> fnames;
+    std::vector<Change> changes;
+
+    /**
+     * @brief Gets the FName of a hook function's object, reusing it if already looked up.
+     *
+     * @param func The full function path name.
+     * @return The FName we expect it's object to use.
+     */
+    FName resolve_fname(std::wstring_view func) {
+        std::wstring name{func_obj_name(func)};
+        auto iter = this->fnames.find(name);
+        if (iter != this->fnames.end()) {
+            return iter->second;
+        }
+
+        const FName fname{name};
+        this->fnames.emplace(std::move(name), fname);
+        return fname;
+    }
+};
+
+void batch_add_hook(PendingBatch& batch,
+                    std::wstring_view func,
+                    Type type,
+                    std::wstring_view identifier,
+                    DLLSafeCallback&& callback,
+                    const Filter& filter,
+                    const Throttle& throttle) {
+    batch.changes.push_back({.fname = batch.resolve_fname(func),
+                             .func = std::wstring{func},
+                             .type = type,
+                             .identifier = std::wstring{identifier},
+                             .callback = std::make_shared<DLLSafeCallback>(std::move(callback)),
+                             .filter = filter,
+                             .throttle = throttle});
+}
+
+void batch_remove_hook(PendingBatch& batch,
+                       std::wstring_view func,
+                       Type type,
+                       std::wstring_view identifier) {
+    batch.changes.push_back({.fname = batch.resolve_fname(func),
+                             .func = std::wstring{func},
+                             .type = type,
+                             .identifier = std::wstring{identifier},
+                             .callback = nullptr,
+                             .filter = {},
+                             .throttle = {}});
+}
+
+bool commit_batch(PendingBatch& batch) {
+    const std::scoped_lock lock(hooks_mutex);
+
+    // Validate everything up front, so that we can't fail half way through. Don't touch the batch
+    // until this passes, so that a rejected batch is left as is.
+    std::vector<std::tuple<std::wstring_view, Type, std::wstring_view>> keys{};
+    keys.reserve(batch.changes.size());
+    for (const auto& change : batch.changes) {
+        keys.emplace_back(change.func, change.type, change.identifier);
+    }
+    std::ranges::sort(keys);
+    if (std::ranges::adjacent_find(keys) != keys.end()) {
+        // Changing the same hook twice
+        return false;
+    }
+
+    std::vector<std::shared_ptr<Node>> removed_nodes{};
+    for (const auto& change : batch.changes) {
+        auto existing = find_hook(change.fname, change.func, change.type, change.identifier);
+        const bool is_add = change.callback != nullptr;
+        if (is_add == (existing != nullptr)) {
+            // Adding a hook which already exists, or removing one which doesn't
+            return false;
+        }
+        if (!is_add) {
+            removed_nodes.push_back(existing);
+        }
+    }
+
+    // Only now we know we'll succeed, consume the changes
+    auto changes = std::move(batch.changes);
+    batch.changes.clear();
+
+    // Link in all the new nodes, and mark all the removed ones. Since none of the changes take
+    // effect until the flag is set, the game thread will never see a half applied batch.
+    auto committed = std::make_shared<std::atomic<bool>>(false);
+    for (const auto& change : changes) {
+        if (change.callback != nullptr) {
+            add_hook(change.fname, change.func, change.type, change.identifier, change.callback,
+                     change.filter, change.throttle, false, committed);
+        }
+    }
+    for (const auto& node : removed_nodes) {
+        node->removal_flag_owner = committed;
+        node->removal_flag.store(committed.get(), std::memory_order_release);
+    }
+
+    committed->store(true, std::memory_order_release);
+
+    // Now the removed nodes are dead, we can unlink them at our leisure
+    for (const auto& change : changes) {
+        if (change.callback == nullptr) {
+            remove_hook(change.fname, change.func, change.type, change.identifier);
+        }
+    }
+
+    return true;
+}
+
+/// A hook on every function matching a pattern.
+struct WildcardHook {
+    std::wstring pattern;
+    Type type;
+    std::wstring identifier;
+    std::shared_ptr<DLLSafeCallback> callback;
+    Filter filter;
+    Throttle throttle;
+
+    // The full names of all functions we've added nodes to for this hook
+    std::vector<std::wstring> matched_functions;
+};
+
+std::vector<WildcardHook> wildcard_hooks{};
+std::atomic<bool> have_wildcard_hooks = false;
+
+/*
+Wildcard hooks work by adding regular nodes to the hash table for every function they match, so that
+once a function's been matched, it's handled by the exact same lookup as any other hook.
+
+Matching patterns against a function's full name is slow though, we only want to do it once per
+function. To do this, we keep a side table indexed by the function's InternalIndex, which holds the
+function we last checked at that index. Checking if we've already seen a function is then a single
+load and compare. Whenever a new wildcard hook is added, we clear it, so every function is checked
+against the new pattern the next time it's called.
+
+The table entry is only ever a flag saying the function's already been matched, checking it is the
+only thing the hot path does. When it misses, we drop to a slow path which takes the hooks mutex,
+and does the actual matching/adding nodes under it. Like a batch, the new nodes for a function are
+only published all at once, with a release store, after they've all been linked in. Since the entry
+is only set after that, any thread which sees it set also sees all the nodes.
+
+The table is split into lazily allocated chunks, so we don't need to know how many objects there are
+up front, and so that it's never reallocated while another thread's reading it.
+*/
+
+const constexpr size_t CHECKED_CHUNK_SIZE = 0x10000;
+const constexpr size_t CHECKED_MAX_CHUNKS = 0x400;
+
+using CheckedChunk = std::array<std::atomic<const UFunction*>, CHECKED_CHUNK_SIZE>;
+std::array<std::atomic<CheckedChunk*>, CHECKED_MAX_CHUNKS> checked_functions{};
+
+/**
+ * @brief Gets the entry in the checked functions table for the given index.
+ *
+ * @param idx The function's InternalIndex.
+ * @return A pointer to the entry, or nullptr if the index is out of range.
+ */
+std::atomic<const UFunction*>* get_checked_entry(size_t idx) {
+    auto chunk_idx = idx / CHECKED_CHUNK_SIZE;
+    if (chunk_idx >= CHECKED_MAX_CHUNKS) {
+        return nullptr;
+    }
+
+    auto& chunk_ptr = checked_functions.at(chunk_idx);
+    auto chunk = chunk_ptr.load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        auto new_chunk = std::make_unique<CheckedChunk>();
+        if (chunk_ptr.compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel)) {
+            chunk = new_chunk.release();
+        }
+        // Otherwise another thread beat us to it, and chunk has been set to theirs
+    }
+
+    return &chunk->at(idx % CHECKED_CHUNK_SIZE);
+}
+
+/**
+ * @brief Clears the checked functions table, so that all functions get checked again.
+ */
+void clear_checked_functions(void) {
+    for (auto& chunk_ptr : checked_functions) {
+        auto chunk = chunk_ptr.load(std::memory_order_acquire);
+        if (chunk == nullptr) {
+            continue;
+        }
+        for (auto& entry : *chunk) {
+            entry.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Checks if a string matches a wildcard pattern.
+ * @note Case insensitive. `*` matches any number of characters, `?` matches any single character.
+ *
+ * @param pattern The pattern to match against.
+ * @param str The string to check.
+ * @return True if the string matches.
+ */
+bool wildcard_matches(std::wstring_view pattern, std::wstring_view str) {
+    size_t pattern_idx = 0;
+    size_t str_idx = 0;
+
+    // Where the last star we came across was, and where in the string we tried matching it up to
+    size_t star_idx = std::wstring_view::npos;
+    size_t star_str_idx = 0;
+
+    while (str_idx < str.size()) {
+        if (pattern_idx < pattern.size() && pattern[pattern_idx] == L'*') {
+            star_idx = pattern_idx++;
+            star_str_idx = str_idx;
+        } else if (pattern_idx < pattern.size()
+                   && (pattern[pattern_idx] == L'?'
+                       || std::towlower(pattern[pattern_idx]) == std::towlower(str[str_idx]))) {
+            pattern_idx++;
+            str_idx++;
+        } else if (star_idx != std::wstring_view::npos) {
+            // Backtrack, and let the last star swallow one more character
+            pattern_idx = star_idx + 1;
+            str_idx = ++star_str_idx;
+        } else {
+            return false;
+        }
+    }
+
+    while (pattern_idx < pattern.size() && pattern[pattern_idx] == L'*') {
+        pattern_idx++;
+    }
+    return pattern_idx == pattern.size();
+}
+
+/**
+ * @brief Adds nodes for all wildcard hooks matching a function, if it hasn't been checked yet.
+ * @note Only takes the hooks mutex if the function hasn't been checked yet.
+ *
+ * @param func The function which was called.
+ * @param func_name The function's full path name. If empty, and it's needed, it's filled in.
+ */
+void apply_wildcard_hooks(const UFunction* func, std::wstring& func_name) {
+    auto entry = get_checked_entry(static_cast<size_t>(func->InternalIndex()));
+    if (entry != nullptr && entry->load(std::memory_order_acquire) == func) {
+        return;
+    }
+
+    if (func_name.empty()) {
+        func_name = func->get_path_name();
+    }
+
+    const std::scoped_lock lock(hooks_mutex);
+
+    // Another thread may have matched it while we were waiting
+    if (entry != nullptr && entry->load(std::memory_order_acquire) == func) {
+        return;
+    }
+
+    auto added = std::make_shared<std::atomic<bool>>(false);
+    for (auto& hook : wildcard_hooks) {
+        if (wildcard_matches(hook.pattern, func_name)
+            && add_hook(func->Name(), func_name, hook.type, hook.identifier, hook.callback,
+                        hook.filter, hook.throttle, true, added)) {
+            hook.matched_functions.push_back(func_name);
+        }
+    }
+    added->store(true, std::memory_order_release);
+
+    if (entry != nullptr) {
+        entry->store(func, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Finds a wildcard hook.
+ *
+ * @param pattern The hook's pattern.
+ * @param type The hook's type.
+ * @param identifier The hook's identifier.
+ * @return An iterator to the hook, or the end iterator if it doesn't exist.
+ */
+auto find_wildcard_hook(std::wstring_view pattern, Type type, std::wstring_view identifier) {
+    return std::ranges::find_if(wildcard_hooks, [&](const WildcardHook& hook) {
+        return hook.pattern == pattern && hook.type == type && hook.identifier == identifier;
+    });
+}
+
+bool add_wildcard_hook(std::wstring_view pattern,
+                       Type type,
+                       std::wstring_view identifier,
+                       DLLSafeCallback&& callback,
+                       const Filter& filter,
+                       const Throttle& throttle) {
+    const std::scoped_lock lock(hooks_mutex);
+
+    if (find_wildcard_hook(pattern, type, identifier) != wildcard_hooks.end()) {
+        return false;
+    }
+
+    wildcard_hooks.push_back({.pattern = std::wstring{pattern},
+                              .type = type,
+                              .identifier = std::wstring{identifier},
+                              .callback = std::make_shared<DLLSafeCallback>(std::move(callback)),
+                              .filter = filter,
+                              .throttle = throttle,
+                              .matched_functions = {}});
+    have_wildcard_hooks.store(true, std::memory_order_relaxed);
+    clear_checked_functions();
+    return true;
+}
+
+bool has_wildcard_hook(std::wstring_view pattern, Type type, std::wstring_view identifier) {
+    const std::scoped_lock lock(hooks_mutex);
+    return find_wildcard_hook(pattern, type, identifier) != wildcard_hooks.end();
+}
+
+bool remove_wildcard_hook(std::wstring_view pattern, Type type, std::wstring_view identifier) {
+    const std::scoped_lock lock(hooks_mutex);
+
+    auto hook = find_wildcard_hook(pattern, type, identifier);
+    if (hook == wildcard_hooks.end()) {
+        return false;
+    }
+
+    for (const auto& func_name : hook->matched_functions) {
+        remove_hook(extract_func_obj_name(func_name), func_name, hook->type, hook->identifier,
+                    true);
+    }
+    wildcard_hooks.erase(hook);
+
+    // If another hook with the same identifier matched the same functions, it would have failed to
+    // add it's nodes, so make sure to check everything again
+    have_wildcard_hooks.store(!wildcard_hooks.empty(), std::memory_order_relaxed);
+    clear_checked_functions();
+    return true;
+}
+
+/// A snapshot of a hooked call, for async hooks to run on.
+struct AsyncSnapshot {
+    std::vector<std::shared_ptr<Node>> hooks;
+    WrappedStruct args;
+    Details details;
+};
+
+/**
+ * @brief Snapshots a call, and queues the async hooks on it to run on the worker thread.
+ *
+ * @param node The head of the async hooks collection.
+ * @param hook The hook details to snapshot.
+ */
+void queue_async_hooks(std::shared_ptr<Node> node, const Details& hook) {
+    std::vector<std::shared_ptr<Node>> hooks{};
+    for (; node != nullptr; node = node->next_in_collection) {
+        if (node->live() && node->filter.matches(hook.obj) && node->selected()) {
+            hooks.push_back(node);
+        }
+    }
+    if (hooks.empty()) {
+        return;
+    }
+
+    auto snapshot = std::make_shared<AsyncSnapshot>(
+        std::move(hooks), hook.args == nullptr ? WrappedStruct{nullptr} : *hook.args,
+        Details{.obj = hook.obj, .args = nullptr, .ret = hook.ret, .func = hook.func});
+    snapshot->details.args = &snapshot->args;
+
+    queue_async_job([snapshot]() {
+        for (const auto& async_hook : snapshot->hooks) {
+            try {
+                (*async_hook->callback)(snapshot->details);
+            } catch (const std::exception& ex) {
+                LOG(ERROR, "An exception occurred during async hook processing");
+                LOG(ERROR, L"Function: {}", async_hook->full_name);
+                LOG(ERROR, "Exception: {}", ex.what());
+            }
+        }
+    });
+}
+
 }  // namespace
 
 std::shared_ptr<Node> preprocess_hook(std::wstring_view source,
@@ -427,6 +1095,10 @@ std::shared_ptr<Node> preprocess_hook(std::wstring_view source,
         return nullptr;
     }
 
+    // There's no good hook for the end of a gc pass, so instead deliver anything destroyed since
+    // last time as soon as we're back running regular game code
+    gc::impl::flush_destroyed_objects();
+
     if (should_inject_next_call) {
         should_inject_next_call = false;
         return nullptr;
@@ -446,6 +1118,10 @@ std::shared_ptr<Node> preprocess_hook(std::wstring_view source,
         }
     }
 
+    if (have_wildcard_hooks.load(std::memory_order_relaxed)) {
+        apply_wildcard_hooks(func, func_name);
+    }
+
     auto fname = func->Name();
 
     auto hash_idx = get_table_index(fname);
@@ -465,7 +1141,7 @@ std::shared_ptr<Node> preprocess_hook(std::wstring_view source,
     }
 
     // At this point we need the full path name
-    if (!should_log_all_calls) {
+    if (func_name.empty()) {
         func_name = func->get_path_name();
     }
 
@@ -478,6 +1154,11 @@ std::shared_ptr<Node> preprocess_hook(std::wstring_view source,
         node = node->next_function;
     }
 
+    // If every hook is filtered out or throttled, we can still early exit before extracting args
+    if (!select_hooks(node, obj)) {
+        return nullptr;
+    }
+
     // Break off at this point - we know we have hooks on this function, so the hook processing will
     // need to start extracting args.
     return node;
@@ -486,7 +1167,8 @@ std::shared_ptr<Node> preprocess_hook(std::wstring_view source,
 bool has_post_hooks(std::shared_ptr<Node> node) {
     // We got the node from preprocess_hook, it's pointing to the start of the types linked list
     for (; node != nullptr; node = node->next_type) {
-        if (node->type == Type::POST || node->type == Type::POST_UNCONDITIONAL) {
+        if (node->type == Type::POST || node->type == Type::POST_UNCONDITIONAL
+            || node->type == Type::POST_ASYNC) {
             return true;
         }
     }
@@ -505,11 +1187,19 @@ bool run_hooks_of_type(std::shared_ptr<Node> node, Type type, Details& hook) {
         node = node->next_type;
     }
 
+    if (type == Type::POST_ASYNC) {
+        queue_async_hooks(node, hook);
+        return false;
+    }
+
     // We've got the final list of hooks, run them all
     bool ret = false;
     for (; node != nullptr; node = node->next_in_collection) {
+        if (!node->live() || !node->filter.matches(hook.obj) || !node->selected()) {
+            continue;
+        }
         try {
-            ret |= node->callback(hook);
+            ret |= (*node->callback)(hook);
         } catch (const std::exception& ex) {
             LOG(ERROR, "An exception occurred during hook processing");
             LOG(ERROR, L"Function: {}", hook.func.func->get_path_name());
@@ -560,7 +1250,9 @@ UNREALSDK_CAPI(bool,
                Type type,
                const wchar_t* identifier,
                size_t identifier_size,
-               DLLSafeCallback&& callback);
+               DLLSafeCallback&& callback,
+               const Filter* filter,
+               const Throttle* throttle);
 #endif
 #ifndef UNREALSDK_IMPORTING
 UNREALSDK_CAPI(bool,
@@ -570,19 +1262,27 @@ UNREALSDK_CAPI(bool,
                Type type,
                const wchar_t* identifier,
                size_t identifier_size,
-               DLLSafeCallback&& callback) {
-    return impl::add_hook({func, func_size}, type, {identifier, identifier_size},
-                          std::move(callback));
+               DLLSafeCallback&& callback,
+               const Filter* filter,
+               const Throttle* throttle) {
+    const std::wstring_view func_view{func, func_size};
+    const std::scoped_lock lock(impl::hooks_mutex);
+    return impl::add_hook(impl::extract_func_obj_name(func_view), func_view, type,
+                          {identifier, identifier_size},
+                          std::make_shared<DLLSafeCallback>(std::move(callback)), *filter,
+                          *throttle);
 }
 #endif
 
 bool add_hook(std::wstring_view func,
               Type type,
               std::wstring_view identifier,
-              const Callback& callback) {
+              const Callback& callback,
+              const Filter& filter,
+              const Throttle& throttle) {
     // NOLINTBEGIN(cppcoreguidelines-owning-memory)
     return UNREALSDK_MANGLE(add_hook)(func.data(), func.size(), type, identifier.data(),
-                                      identifier.size(), {callback});
+                                      identifier.size(), {callback}, &filter, &throttle);
     // NOLINTEND(cppcoreguidelines-owning-memory)
 }
 
@@ -603,7 +1303,11 @@ UNREALSDK_CAPI(bool,
                Type type,
                const wchar_t* identifier,
                size_t identifier_size) {
-    return impl::has_hook({func, func_size}, type, {identifier, identifier_size});
+    const std::wstring_view func_view{func, func_size};
+    const std::scoped_lock lock(impl::hooks_mutex);
+    return impl::find_hook(impl::extract_func_obj_name(func_view), func_view, type,
+                           {identifier, identifier_size})
+           != nullptr;
 }
 #endif
 
@@ -630,7 +1334,10 @@ UNREALSDK_CAPI(bool,
                Type type,
                const wchar_t* identifier,
                size_t identifier_size) {
-    return impl::remove_hook({func, func_size}, type, {identifier, identifier_size});
+    const std::wstring_view func_view{func, func_size};
+    const std::scoped_lock lock(impl::hooks_mutex);
+    return impl::remove_hook(impl::extract_func_obj_name(func_view), func_view, type,
+                             {identifier, identifier_size});
 }
 
 #endif
@@ -640,6 +1347,198 @@ bool remove_hook(std::wstring_view func, Type type, std::wstring_view identifier
                                          identifier.size());
 }
 
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(bool,
+               add_wildcard_hook,
+               const wchar_t* pattern,
+               size_t pattern_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size,
+               DLLSafeCallback&& callback,
+               const Filter* filter,
+               const Throttle* throttle);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(bool,
+               add_wildcard_hook,
+               const wchar_t* pattern,
+               size_t pattern_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size,
+               DLLSafeCallback&& callback,
+               const Filter* filter,
+               const Throttle* throttle) {
+    return impl::add_wildcard_hook({pattern, pattern_size}, type, {identifier, identifier_size},
+                                   std::move(callback), *filter, *throttle);
+}
+#endif
+
+bool add_wildcard_hook(std::wstring_view pattern,
+                       Type type,
+                       std::wstring_view identifier,
+                       const Callback& callback,
+                       const Filter& filter,
+                       const Throttle& throttle) {
+    // NOLINTBEGIN(cppcoreguidelines-owning-memory)
+    return UNREALSDK_MANGLE(add_wildcard_hook)(pattern.data(), pattern.size(), type,
+                                               identifier.data(), identifier.size(), {callback},
+                                               &filter, &throttle);
+    // NOLINTEND(cppcoreguidelines-owning-memory)
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(bool,
+               has_wildcard_hook,
+               const wchar_t* pattern,
+               size_t pattern_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(bool,
+               has_wildcard_hook,
+               const wchar_t* pattern,
+               size_t pattern_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size) {
+    return impl::has_wildcard_hook({pattern, pattern_size}, type, {identifier, identifier_size});
+}
+#endif
+
+bool has_wildcard_hook(std::wstring_view pattern, Type type, std::wstring_view identifier) {
+    return UNREALSDK_MANGLE(has_wildcard_hook)(pattern.data(), pattern.size(), type,
+                                               identifier.data(), identifier.size());
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(bool,
+               remove_wildcard_hook,
+               const wchar_t* pattern,
+               size_t pattern_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(bool,
+               remove_wildcard_hook,
+               const wchar_t* pattern,
+               size_t pattern_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size) {
+    return impl::remove_wildcard_hook({pattern, pattern_size}, type,
+                                      {identifier, identifier_size});
+}
+#endif
+
+bool remove_wildcard_hook(std::wstring_view pattern, Type type, std::wstring_view identifier) {
+    return UNREALSDK_MANGLE(remove_wildcard_hook)(pattern.data(), pattern.size(), type,
+                                                  identifier.data(), identifier.size());
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] void*, hook_batch_create);
+UNREALSDK_CAPI(void, hook_batch_destroy, void* batch);
+UNREALSDK_CAPI(void,
+               hook_batch_add,
+               void* batch,
+               const wchar_t* func,
+               size_t func_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size,
+               DLLSafeCallback&& callback,
+               const Filter* filter,
+               const Throttle* throttle);
+UNREALSDK_CAPI(void,
+               hook_batch_remove,
+               void* batch,
+               const wchar_t* func,
+               size_t func_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size);
+UNREALSDK_CAPI(bool, hook_batch_commit, void* batch);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] void*, hook_batch_create) {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return new impl::PendingBatch{};
+}
+UNREALSDK_CAPI(void, hook_batch_destroy, void* batch) {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    delete static_cast<impl::PendingBatch*>(batch);
+}
+UNREALSDK_CAPI(void,
+               hook_batch_add,
+               void* batch,
+               const wchar_t* func,
+               size_t func_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size,
+               DLLSafeCallback&& callback,
+               const Filter* filter,
+               const Throttle* throttle) {
+    impl::batch_add_hook(*static_cast<impl::PendingBatch*>(batch), {func, func_size}, type,
+                         {identifier, identifier_size}, std::move(callback), *filter, *throttle);
+}
+UNREALSDK_CAPI(void,
+               hook_batch_remove,
+               void* batch,
+               const wchar_t* func,
+               size_t func_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size) {
+    impl::batch_remove_hook(*static_cast<impl::PendingBatch*>(batch), {func, func_size}, type,
+                            {identifier, identifier_size});
+}
+UNREALSDK_CAPI(bool, hook_batch_commit, void* batch) {
+    return impl::commit_batch(*static_cast<impl::PendingBatch*>(batch));
+}
+#endif
+
+HookBatch::HookBatch(void) : batch(UNREALSDK_MANGLE(hook_batch_create)()) {}
+HookBatch::HookBatch(HookBatch&& other) noexcept : batch(std::exchange(other.batch, nullptr)) {}
+HookBatch& HookBatch::operator=(HookBatch&& other) noexcept {
+    std::swap(this->batch, other.batch);
+    return *this;
+}
+HookBatch::~HookBatch() {
+    if (this->batch != nullptr) {
+        UNREALSDK_MANGLE(hook_batch_destroy)(this->batch);
+        this->batch = nullptr;
+    }
+}
+
+void HookBatch::add(std::wstring_view func,
+                    Type type,
+                    std::wstring_view identifier,
+                    const Callback& callback,
+                    const Filter& filter,
+                    const Throttle& throttle) {
+    // NOLINTBEGIN(cppcoreguidelines-owning-memory)
+    UNREALSDK_MANGLE(hook_batch_add)(this->batch, func.data(), func.size(), type,
+                                     identifier.data(), identifier.size(), {callback}, &filter,
+                                     &throttle);
+    // NOLINTEND(cppcoreguidelines-owning-memory)
+}
+
+void HookBatch::remove(std::wstring_view func, Type type, std::wstring_view identifier) {
+    UNREALSDK_MANGLE(hook_batch_remove)(this->batch, func.data(), func.size(), type,
+                                        identifier.data(), identifier.size());
+}
+
+bool HookBatch::commit(void) {
+    return UNREALSDK_MANGLE(hook_batch_commit)(this->batch);
+}
+
 }  // namespace unrealsdk::hook_manager
 
 #pragma endregion
@@ -2,11 +2,14 @@
 #define UNREALSDK_HOOK_MANAGER_H
 
 #include "unrealsdk/pch.h"
+#include "unrealsdk/unreal/structs/fname.h"
 #include "unrealsdk/unreal/wrappers/bound_function.h"
 #include "unrealsdk/unreal/wrappers/property_proxy.h"
+#include "unrealsdk/unreal/wrappers/weak_pointer.h"
 
 namespace unrealsdk::unreal {
 
+class UClass;
 class UObject;
 class UFunction;
 
@@ -22,6 +25,8 @@ enum class Type : uint8_t {
     PRE,                 /// Before running the hooked function.
     POST,                /// After the hooked function, only if it was allowed to run.
     POST_UNCONDITIONAL,  /// After the hooked function, even if it got blocked.
+    POST_ASYNC,          /// After the hooked function, only if it was allowed to run, on a worker
+                         /// thread. Gets a snapshot of the call, and may not call into unreal.
 };
 
 /// Information about a hooked function call
@@ -47,8 +52,55 @@ struct Details {
     unreal::BoundFunction func{};
 };
 
+/// A native filter on which calls a hook runs on. This is checked before any args are extracted, so
+/// calls which don't match are discarded as quickly as if the function wasn't hooked at all.
+/// All fields which are set must match. A default constructed filter matches every call.
+struct Filter {
+    /// If set, only runs when called on an instance of this class, or of one of it's subclasses.
+    const unreal::UClass* cls{};
+
+    /// If set, only runs when called on this specific object. If the object gets destroyed, the
+    /// hook will never run again.
+    std::optional<unreal::WeakPointer> obj{};
+
+    /// If set, only runs when called on an object with this name.
+    std::optional<unreal::FName> name{};
+
+    /**
+     * @brief Checks if a call on the given object passes this filter.
+     *
+     * @param obj The object the hooked function was called on.
+     * @return True if the hook should run.
+     */
+    [[nodiscard]] bool matches(const unreal::UObject* obj) const;
+};
+
+/// Limits on how often a hook runs. Like filters, this is checked before any args are extracted, so
+/// skipped calls are about as cheap as unhooked ones. It's only checked on calls which pass the
+/// hook's filter.
+/// Whether to run is decided once per call, and applies to both pre and post hooks. If a hooked
+/// function recursively calls itself, post hooks follow the decision made for the innermost call.
+struct Throttle {
+    /// If above 1, only runs on every nth call. Calls are counted separately on each thread, and
+    /// the first call on each thread always runs.
+    uint32_t sample_every{};
+
+    /// If above 0, runs at most this many times per second, across all threads.
+    double max_per_second{};
+
+    /// How many calls may run back to back before being limited to `max_per_second`.
+    uint32_t burst = 1;
+};
+
 /**
  * @brief A callback for a hook.
+ * @note Async hooks run on a worker thread, after the hooked function has already returned. They
+ *       get an owned copy of the args and return value, but the object and function are the same
+ *       raw pointers, which the game may have destroyed since. Async hooks may not call back into
+ *       unreal, attempting to do so throws - they should only be used to record data.
+ * @note The async hooks on a single call run in sequence, with the same details. By default there's
+ *       a single worker thread, so calls are processed in order, but this isn't guaranteed if more
+ *       are configured. If the worker falls too far behind, further calls are dropped.
  *
  * @param hook The hook details.
  * @return In pre-hooks: If to block execution - if any pre-hook returns true, the unreal function
@@ -78,12 +130,16 @@ void inject_next_call(void);
  * @param type Which type of hook to add.
  * @param identifier The hook identifier.
  * @param callback The callback to run when the hooked function is called.
+ * @param filter A filter on which calls the callback runs on. Defaults to running on all calls.
+ * @param throttle Limits on how often the callback runs. Defaults to no limits.
  * @return True if successfully added, false if an identical hook already existed.
  */
 bool add_hook(std::wstring_view func,
               Type type,
               std::wstring_view identifier,
-              const Callback& callback);
+              const Callback& callback,
+              const Filter& filter = {},
+              const Throttle& throttle = {});
 
 /**
  * @brief Checks if a hook exists.
@@ -105,6 +161,124 @@ bool has_hook(std::wstring_view func, Type type, std::wstring_view identifier);
  */
 bool remove_hook(std::wstring_view func, Type type, std::wstring_view identifier);
 
+/**
+ * @brief Adds a hook to every function whose full path name matches a pattern.
+ * @note Patterns are case insensitive. `*` matches any number of characters, `?` matches any single
+ *       character. For example, `WillowGame.WillowPawn:*` hooks every function on `WillowPawn`,
+ *       while `*:*Tick` hooks every function ending in `Tick`.
+ * @note Each function is only matched against the patterns the first time it's called after a
+ *       wildcard hook was added, after that it costs the same as a regular hook.
+ * @note Wildcard hooks use a separate set of identifiers to regular hooks. Throttles are tracked
+ *       separately on each function which was matched.
+ *
+ * @param pattern The pattern of functions to hook.
+ * @param type Which type of hook to add.
+ * @param identifier The hook identifier.
+ * @param callback The callback to run when any of the hooked functions are called.
+ * @param filter A filter on which calls the callback runs on. Defaults to running on all calls.
+ * @param throttle Limits on how often the callback runs. Defaults to no limits.
+ * @return True if successfully added, false if an identical hook already existed.
+ */
+bool add_wildcard_hook(std::wstring_view pattern,
+                       Type type,
+                       std::wstring_view identifier,
+                       const Callback& callback,
+                       const Filter& filter = {},
+                       const Throttle& throttle = {});
+
+/**
+ * @brief Checks if a wildcard hook exists.
+ *
+ * @param pattern The pattern of functions to hook.
+ * @param type Which type of hook to check.
+ * @param identifier The hook identifier.
+ * @return True if a wildcard hook with the given details exists.
+ */
+bool has_wildcard_hook(std::wstring_view pattern, Type type, std::wstring_view identifier);
+
+/**
+ * @brief Removes a wildcard hook.
+ *
+ * @param pattern The pattern of functions to hook.
+ * @param type Which type of hook to remove.
+ * @param identifier The hook identifier.
+ * @return True if successfully removed, false if no wildcard hook with the given details exists.
+ */
+bool remove_wildcard_hook(std::wstring_view pattern, Type type, std::wstring_view identifier);
+
+/**
+ * @brief A set of hook changes, which are all committed at once.
+ * @note Function names are resolved as changes are added, so that committing is cheap.
+ * @note Only supports regular hooks, not wildcard hooks.
+ */
+class HookBatch {
+   private:
+    void* batch;
+
+   public:
+    /**
+     * @brief Creates a new, empty, batch.
+     *
+     * @param other The other batch to move from. It may not be used afterwards.
+     */
+    HookBatch(void);
+    HookBatch(const HookBatch&) = delete;
+    HookBatch(HookBatch&& other) noexcept;
+
+    /**
+     * @brief Move assigns to this batch.
+     *
+     * @param other The other batch to move from. It may not be used afterwards.
+     * @return A reference to this batch.
+     */
+    HookBatch& operator=(const HookBatch&) = delete;
+    HookBatch& operator=(HookBatch&& other) noexcept;
+
+    /**
+     * @brief Destroys this batch, discarding any uncommitted changes.
+     */
+    ~HookBatch();
+
+    /**
+     * @brief Adds a hook as part of this batch.
+     *
+     * @param func The function to hook.
+     * @param type Which type of hook to add.
+     * @param identifier The hook identifier.
+     * @param callback The callback to run when the hooked function is called.
+     * @param filter A filter on which calls the callback runs on. Defaults to running on all calls.
+     * @param throttle Limits on how often the callback runs. Defaults to no limits.
+     */
+    void add(std::wstring_view func,
+             Type type,
+             std::wstring_view identifier,
+             const Callback& callback,
+             const Filter& filter = {},
+             const Throttle& throttle = {});
+
+    /**
+     * @brief Removes a hook as part of this batch.
+     *
+     * @param func The function to hook.
+     * @param type Which type of hook to remove.
+     * @param identifier The hook identifier.
+     */
+    void remove(std::wstring_view func, Type type, std::wstring_view identifier);
+
+    /**
+     * @brief Commits all changes in this batch.
+     * @note All or nothing - if any change conflicts, i.e. adding a hook which already exists,
+     *       removing one which doesn't, or changing the same hook twice, no changes are made.
+     * @note Hooks never see a partially committed batch, all changes become visible at once.
+     * @note If successful, the batch is empty afterwards, and may be reused. If there was a
+     *       conflict, the batch is left untouched, so it may be committed again once the conflict
+     *       is resolved.
+     *
+     * @return True if successfully committed, false if there was a conflict.
+     */
+    bool commit(void);
+};
+
 #ifndef UNREALSDK_IMPORTING
 namespace impl {  // These functions are only relevant when implementing a game hook
 
@@ -120,8 +294,9 @@ even be able to do so for every single call (have to assume functions like that
 To deal with this, hook processing is split in three.
 
 Firstly, call `preprocess_hook`. This does some basic logging (if required), and then determines if
-the function is hooked. If it isn't, it returns `nullptr`, and calling code can early exit. If there
-is, it returns the list of hooks, to be passed to the next step.
+the function is hooked, if any of the hooks' filters match the object, and if any of their throttles
+allow them to run on this call. If not, it returns `nullptr`, and calling code can early exit. If
+there is, it returns the list of hooks, to be passed to the next step.
 
 If there is a hook, calling code can then spend more time retrieving the remaining information,
 before calling `run_hooks_of_type` using pre-hooks. This actually runs all the hooks, and returns
@@ -130,7 +305,8 @@ required.
 
 Extracting the return value may not be trivial either, so the calling code can run `has_post_hooks`
 to work out if to early exit again. If it does, it can spend a bit longer extracting it, then call
-`run_hooks_of_type` with the two post-hook types.
+`run_hooks_of_type` with the three post-hook types. Running the async type takes a snapshot of the
+details and queues the hooks to run on a worker thread, rather than running them inline.
 */
 
 /**
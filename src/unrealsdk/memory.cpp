@@ -1,15 +1,18 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/memory.h"
+#include "unrealsdk/profiling.h"
 
 namespace unrealsdk::memory {
 
-std::pair<uintptr_t, size_t> get_exe_range(void) {
-    static std::optional<std::pair<uintptr_t, size_t>> range = std::nullopt;
-    if (range) {
-        return *range;
-    }
+namespace {
 
+/**
+ * @brief Looks up the address range covered by the exe's module.
+ *
+ * @return A tuple of the exe start address and it's length.
+ */
+std::pair<uintptr_t, size_t> find_exe_range(void) {
     HMODULE exe_module = GetModuleHandleA(nullptr);
 
     MEMORY_BASIC_INFORMATION mem;
@@ -27,17 +30,46 @@ std::pair<uintptr_t, size_t> get_exe_range(void) {
                                                          + dos_header->e_lfanew);
     auto module_length = nt_header->OptionalHeader.SizeOfImage;
 
-    range = {reinterpret_cast<uintptr_t>(allocation_base), module_length};
+    const std::pair<uintptr_t, size_t> range{reinterpret_cast<uintptr_t>(allocation_base),
+                                             module_length};
 
     if constexpr (sizeof(uintptr_t) == 4) {
-        LOG(MISC, "Executable memory range: {:08x}-{:08x}", range->first,
-            range->first + range->second);
+        LOG(MISC, "Executable memory range: {:08x}-{:08x}", range.first,
+            range.first + range.second);
     } else {
-        LOG(MISC, "Executable memory range: {:012x}-{:012x}", range->first,
-            range->first + range->second);
+        LOG(MISC, "Executable memory range: {:012x}-{:012x}", range.first,
+            range.first + range.second);
     }
 
-    return *range;
+    return range;
+}
+
+}  // namespace
+
+std::pair<uintptr_t, size_t> get_exe_range(void) {
+    // Startup steps sigscan concurrently, so this must be initialized thread safely
+    static const auto range = find_exe_range();
+    return range;
+}
+
+bool is_exe_code(uintptr_t addr) {
+    auto [start, size] = get_exe_range();
+    if (addr < start || addr >= start + size) {
+        return false;
+    }
+
+    auto dos_header = reinterpret_cast<IMAGE_DOS_HEADER*>(start);
+    auto nt_header = reinterpret_cast<IMAGE_NT_HEADERS*>(start + dos_header->e_lfanew);
+
+    auto rva = addr - start;
+    auto section = IMAGE_FIRST_SECTION(nt_header);
+    for (WORD i = 0; i < nt_header->FileHeader.NumberOfSections; i++, section++) {
+        if (rva >= section->VirtualAddress
+            && rva < section->VirtualAddress + section->Misc.VirtualSize) {
+            return (section->Characteristics & IMAGE_SCN_MEM_EXECUTE) != 0;
+        }
+    }
+    return false;
 }
 
 uintptr_t sigscan(const uint8_t* bytes, const uint8_t* mask, size_t pattern_size) {
@@ -49,23 +81,29 @@ uintptr_t sigscan(const uint8_t* bytes,
                   size_t pattern_size,
                   uintptr_t start,
                   size_t size) {
-    auto start_ptr = reinterpret_cast<uint8_t*>(start);
-    // The naive O(nm) search works well enough, even repeating it for each different pattern
-    for (size_t i = 0; i < (size - pattern_size); i++) {
-        bool found = true;
-        for (size_t j = 0; j < pattern_size; j++) {
-            auto val = start_ptr[i + j];
-            if ((val & mask[j]) != bytes[j]) {
-                found = false;
-                break;
-            }
-        }
-        if (found) {
-            return reinterpret_cast<uintptr_t>(&start_ptr[i]);
-        }
-    }
+    return sigscan(bytes, mask, pattern_size, {bytes, mask, pattern_size}, start, size);
+}
+uintptr_t sigscan(const uint8_t* bytes,
+                  const uint8_t* mask,
+                  size_t pattern_size,
+                  const PatternSearchInfo& info) {
+    auto [start, size] = get_exe_range();
+    return sigscan(bytes, mask, pattern_size, info, start, size);
+}
+uintptr_t sigscan(const uint8_t* bytes,
+                  const uint8_t* mask,
+                  size_t pattern_size,
+                  const PatternSearchInfo& info,
+                  uintptr_t start,
+                  size_t size) {
+    const profiling::ScopedTimer timer{"sigscan", "memory"};
+    return find_pattern(bytes, mask, pattern_size, info, start, size);
+}
 
-    return 0;
+void impl::sigscan_failed(std::string_view name) {
+    // Make sure to log something on error, even if calling code doesn't catch it
+    LOG(ERROR, "Sigscan for {} failed!", name);
+    throw std::runtime_error("sigscan failed");
 }
 
 #ifdef UNREALSDK_SHARED
@@ -87,6 +125,7 @@ bool detour(uintptr_t addr, void* detour_func, void** original_func, std::string
         LOG(ERROR, "Detour for {} was passed a null address!", name);
         return false;
     }
+    const profiling::ScopedTimer timer{name, "detour"};
 
     MH_STATUS status = MH_OK;
 
@@ -3,6 +3,7 @@
 
 #include "unrealsdk/pch.h"
 #include "unrealsdk/memory.h"
+#include "unrealsdk/profiling.h"
 
 namespace unrealsdk::memory {
 
@@ -233,6 +234,7 @@ void multi_sigscan_thread(const uint8_t* pos,
  */
 template <typename... T>
 void multi_sigscan(T*... patterns_arg) {
+    const profiling::ScopedTimer timer{"multi_sigscan", "memory"};
     std::array<MultiPattern*, sizeof...(T)> patterns{{patterns_arg...}};
 
     auto [byte, overscan] = multi_sigscan_preprocess(patterns);
@@ -263,6 +265,7 @@ void multi_sigscan(T*... patterns_arg) {
         auto* thread_end = thread_pos + size_per_thread + overscan;
         thread_end = std::min(thread_end, reinterpret_cast<uint8_t*>(start) + size);
         threads.emplace_back([thread_pos, thread_end, &patterns, byte]() {
+            const profiling::ScopedTimer thread_timer{"multi_sigscan_thread", "memory"};
             multi_sigscan_thread(thread_pos, thread_end, patterns, byte);
         });
     }
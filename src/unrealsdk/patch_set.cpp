@@ -0,0 +1,145 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/memory.h"
+#include "unrealsdk/patch_set.h"
+
+namespace unrealsdk::memory {
+
+namespace {
+
+using byte_write = std::pair<uintptr_t, std::span<const uint8_t>>;
+
+/**
+ * @brief Writes a set of bytes to (potentially) read only memory, only unlocking each page once.
+ * @note Restores the original protection of each page afterwards.
+ *
+ * @param writes The writes to perform, as pairs of the address and the bytes to write there.
+ */
+void write_batch(const std::vector<byte_write>& writes) {
+    if (writes.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<uintptr_t, size_t>> ranges{};
+    ranges.reserve(writes.size());
+    for (const auto& [addr, data] : writes) {
+        ranges.emplace_back(addr, data.size());
+    }
+
+    SYSTEM_INFO info{};
+    GetSystemInfo(&info);
+    const size_t page_size = info.dwPageSize;
+
+    std::vector<std::pair<uintptr_t, DWORD>> unlocked_pages{};
+    auto restore_protections = [&unlocked_pages, page_size]() {
+        for (const auto& [page, protection] : unlocked_pages) {
+            DWORD unused = 0;
+            if (VirtualProtect(reinterpret_cast<LPVOID>(page), page_size, protection, &unused)
+                == 0) {
+                LOG(WARNING, "Failed to restore protection of page {:p}",
+                    reinterpret_cast<void*>(page));
+            }
+        }
+    };
+
+    for (auto page : group_by_page(ranges, page_size)) {
+        DWORD old_protect = 0;
+        if (VirtualProtect(reinterpret_cast<LPVOID>(page), page_size, PAGE_EXECUTE_READWRITE,
+                           &old_protect)
+            == 0) {
+            restore_protections();
+            throw std::runtime_error("VirtualProtect failed!");
+        }
+        unlocked_pages.emplace_back(page, old_protect);
+    }
+
+    for (const auto& [addr, data] : writes) {
+        std::memcpy(reinterpret_cast<void*>(addr), data.data(), data.size());
+    }
+
+    restore_protections();
+
+    auto process = GetCurrentProcess();
+    for (const auto& [addr, data] : writes) {
+        FlushInstructionCache(process, reinterpret_cast<LPCVOID>(addr), data.size());
+    }
+}
+
+/**
+ * @brief Checks if the given memory currently holds the given bytes.
+ *
+ * @param addr The address to check.
+ * @param data The bytes to compare against.
+ * @return True if the memory matches.
+ */
+bool memory_matches(uintptr_t addr, std::span<const uint8_t> data) {
+    return std::memcmp(reinterpret_cast<const void*>(addr), data.data(), data.size()) == 0;
+}
+
+}  // namespace
+
+PatchSet::PatchSet(std::initializer_list<PatchSpec> patches) : patches(patches) {}
+
+size_t PatchSet::apply(void) {
+    if (!this->applied.empty()) {
+        return this->applied.size();
+    }
+
+    auto [start, size] = get_exe_range();
+    auto addresses = find_patches(this->patches, start, size);
+
+    std::vector<byte_write> writes{};
+    for (size_t i = 0; i < this->patches.size(); i++) {
+        const auto& patch = this->patches[i];
+        auto addr = addresses[i];
+        if (addr == 0) {
+            LOG(ERROR, "Couldn't find {} signature", patch.name);
+            continue;
+        }
+        LOG(MISC, "{}: {:p}", patch.name, reinterpret_cast<void*>(addr));
+
+        const auto* original = reinterpret_cast<const uint8_t*>(addr);
+        this->applied.push_back({.name = patch.name,
+                                 .addr = addr,
+                                 .replacement = patch.replacement,
+                                 // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                 .original = {original, original + patch.replacement.size()}});
+        writes.emplace_back(addr, patch.replacement);
+    }
+
+    try {
+        write_batch(writes);
+    } catch (...) {
+        this->applied.clear();
+        throw;
+    }
+
+    for (const auto& patch : this->applied) {
+        if (!memory_matches(patch.addr, patch.replacement)) {
+            LOG(ERROR, "Patch {} did not apply correctly", patch.name);
+        }
+    }
+
+    return this->applied.size();
+}
+
+void PatchSet::revert(void) {
+    std::vector<byte_write> writes{};
+    for (const auto& patch : this->applied) {
+        if (!memory_matches(patch.addr, patch.replacement)) {
+            LOG(WARNING, "Not reverting patch {}, it's been overwritten since it was applied",
+                patch.name);
+            continue;
+        }
+        writes.emplace_back(patch.addr, patch.original);
+    }
+
+    write_batch(writes);
+    this->applied.clear();
+}
+
+bool PatchSet::is_applied(std::string_view name) const {
+    return std::ranges::find(this->applied, name, &AppliedPatch::name) != this->applied.end();
+}
+
+}  // namespace unrealsdk::memory
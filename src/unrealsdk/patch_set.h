@@ -0,0 +1,62 @@
+#ifndef UNREALSDK_PATCH_SET_H
+#define UNREALSDK_PATCH_SET_H
+
+#include "unrealsdk/pch.h"
+#include "unrealsdk/memory.h"
+#include "unrealsdk/pattern_search.h"
+
+namespace unrealsdk::memory {
+
+/**
+ * @brief A set of hex edits, which are found and applied as a single batch.
+ * @note Each page is only made writable once, and has it's original protection restored after.
+ * @note Not thread safe, callers must make sure not to apply/revert the same set concurrently.
+ */
+class PatchSet {
+   private:
+    struct AppliedPatch {
+        std::string_view name;
+        uintptr_t addr;
+        std::span<const uint8_t> replacement;
+        std::vector<uint8_t> original;
+    };
+
+    std::vector<PatchSpec> patches;
+    std::vector<AppliedPatch> applied;
+
+   public:
+    /**
+     * @brief Creates a new patch set.
+     * @note Does not apply any of the patches.
+     *
+     * @param patches The patches in this set.
+     */
+    PatchSet(std::initializer_list<PatchSpec> patches);
+
+    /**
+     * @brief Finds and applies all patches in this set.
+     * @note Patches which can't be found are logged and skipped, rather than throwing.
+     * @note Does nothing if already applied.
+     *
+     * @return The number of patches which were applied.
+     */
+    size_t apply(void);
+
+    /**
+     * @brief Reverts all applied patches in this set, restoring the original bytes.
+     * @note Patches which have since been overwritten by something else are left alone.
+     */
+    void revert(void);
+
+    /**
+     * @brief Checks if a patch in this set is currently applied.
+     *
+     * @param name The name of the patch.
+     * @return True if the patch is applied.
+     */
+    [[nodiscard]] bool is_applied(std::string_view name) const;
+};
+
+}  // namespace unrealsdk::memory
+
+#endif /* UNREALSDK_PATCH_SET_H */
@@ -0,0 +1,24 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/pattern.h"
+
+namespace unrealsdk::memory {
+
+namespace {
+
+std::vector<RegisteredPattern>& get_pattern_registry(void) {
+    // Function-local so that it's safe to use during static initialization
+    static std::vector<RegisteredPattern> registry{};
+    return registry;
+}
+
+}  // namespace
+
+const std::vector<RegisteredPattern>& registered_patterns(void) {
+    return get_pattern_registry();
+}
+
+void impl::register_pattern(const RegisteredPattern& pattern) {
+    get_pattern_registry().push_back(pattern);
+}
+
+}  // namespace unrealsdk::memory
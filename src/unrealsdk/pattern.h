@@ -0,0 +1,258 @@
+#ifndef UNREALSDK_PATTERN_H
+#define UNREALSDK_PATTERN_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the game's pattern tables can be built on any platform, e.g. for offline validation.
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "unrealsdk/pattern_search.h"
+
+namespace unrealsdk::memory {
+
+// Defined alongside the rest of the exe scanning code, see memory.h. Only referenced when a pattern
+// actually gets scanned for, so offline tools don't need them.
+uintptr_t sigscan(const uint8_t* bytes,
+                  const uint8_t* mask,
+                  size_t pattern_size,
+                  const PatternSearchInfo& info);
+
+namespace impl {
+
+/**
+ * @brief Logs and throws after a sigscan for a pattern fails.
+ *
+ * @param name The name of the pattern.
+ */
+[[noreturn]] void sigscan_failed(std::string_view name);
+
+}  // namespace impl
+
+/**
+ * @brief Helper holding the values involved in a sigscan pattern.
+ *
+ * @tparam n The size of the pattern, in bytes.
+ */
+template <size_t n>
+struct Pattern {
+    /// The bytes to match.
+    std::array<uint8_t, n> bytes;
+    /// A mask over the bytes to match. May be bit-level.
+    std::array<uint8_t, n> mask;
+    /// A constant offset to add to the found address.
+    ptrdiff_t offset = 0;
+    /// Metadata used to speed up searching for this pattern.
+    PatternSearchInfo search;
+
+    /**
+     * @brief Construct a pattern.
+     *
+     * @param bytes The bytes to match.
+     * @param mask The mask over the bytes to match.
+     * @param offset The constant offset to add to the found address.
+     * @return A sigscan pattern.
+     */
+    Pattern(const uint8_t (&bytes)[n], const uint8_t (&mask)[n], ptrdiff_t offset = 0)
+        : bytes(bytes),
+          mask(mask),
+          offset(offset),
+          search(this->bytes.data(), this->mask.data(), n) {}
+    Pattern(const char (&bytes)[n + 1], const char (&mask)[n + 1], ptrdiff_t offset = 0)
+        : bytes(reinterpret_cast<const uint8_t*>(bytes)),
+          mask(reinterpret_cast<const uint8_t*>(mask)),
+          offset(offset),
+          search(this->bytes.data(), this->mask.data(), n) {
+        static_assert(sizeof(uint8_t) == sizeof(char), "uint8_t is different size to char");
+    }
+
+   private:
+    /**
+     * @brief Converts a hex character to it's nibble and a mask.
+     *
+     * @param character The character.
+     * @return A pair of the nibble and it's mask.
+     */
+    consteval std::pair<uint8_t, uint8_t> char_to_nibble_and_mask(char character) {
+        // NOLINTBEGIN(readability-magic-numbers)
+        if ('0' <= character && character <= '9') {
+            return {(uint8_t)(character - '0'), (uint8_t)0xF};
+        }
+        if ('A' <= character && character <= 'F') {
+            return {(uint8_t)(character - 'A' + 0xA), (uint8_t)0xF};
+        }
+        if ('a' <= character && character <= 'f') {
+            return {(uint8_t)(character - 'a' + 0xA), (uint8_t)0xF};
+        }
+        return {(uint8_t)0, (uint8_t)0};
+        // NOLINTEND(readability-magic-numbers)
+    }
+
+   public:
+    /**
+     * @brief Constructs a pattern from a hex string, at compile time.
+     * @note An opening curly bracket sets the offset - only the first instance is used.
+     * @note Spaces and closing curly brackets are ignored.
+     * @note All other characters are considered wildcards.
+     * @note The string must contain a whole number of bytes. Nibble wildcards are allowed.
+     *
+     * @tparam m The size of the passed hex string - should be picked up automatically.
+     * @param hex The hex string to convert.
+     * @param offset The constant offset to add to the found address.
+     * @return A sigscan pattern.
+     */
+    template <size_t m>
+    consteval Pattern(const char (&hex)[m],
+                      ptrdiff_t offset = std::numeric_limits<ptrdiff_t>::max())
+        : bytes(), mask(), offset(offset), search() {
+        ptrdiff_t idx = 0;
+        bool upper_nibble = true;
+
+        for (const auto& character : hex) {
+            if (character == '\0') {
+                break;
+            }
+            if (character == ' ' || character == '}') {
+                continue;
+            }
+            if (character == '{') {
+                if (!upper_nibble) {
+                    throw std::logic_error("Cannot start pattern offset halfway through a byte");
+                }
+                if (this->offset == std::numeric_limits<ptrdiff_t>::max()) {
+                    this->offset = idx;
+                }
+                continue;
+            }
+
+            auto [nibble, nibble_mask] = char_to_nibble_and_mask(character);
+            if (upper_nibble) {
+                this->bytes[idx] = nibble << 4;
+                this->mask[idx] = nibble_mask << 4;
+
+                upper_nibble = false;
+            } else {
+                this->bytes[idx] |= nibble;
+                this->mask[idx] |= nibble_mask;
+
+                idx++;
+                upper_nibble = true;
+            }
+        }
+
+        // Make sure we completely filled the pattern, there are no missing or extra bytes, and
+        // we're not halfway through one.
+        if (idx != n || !upper_nibble) {
+            throw std::logic_error("Invalid pattern size");
+        }
+
+        if (this->offset == std::numeric_limits<ptrdiff_t>::max()) {
+            this->offset = 0;
+        }
+
+        this->search = {this->bytes.data(), this->mask.data(), n};
+    }
+
+    /**
+     * @brief Performs a sigscan for this pattern across the main executable.
+     * @note When not found, `sigscan` throws, while `sigscan_nullable` returns 0.
+     *
+     * @tparam T The type to cast the result to.
+     * @param name The name of this pattern, to use in error messages.
+     * @return The found location, or 0.
+     */
+    [[nodiscard]] uintptr_t sigscan(std::string_view name) const {
+        auto addr = memory::sigscan(this->bytes.data(), this->mask.data(), n, this->search);
+        if (addr == 0) {
+            impl::sigscan_failed(name);
+        }
+        return addr + offset;
+    }
+    template <typename T>
+    [[nodiscard]] T sigscan(std::string_view name) const {
+        return reinterpret_cast<T>(this->sigscan(name));
+    }
+    [[nodiscard]] uintptr_t sigscan_nullable(void) const {
+        auto addr = memory::sigscan(this->bytes.data(), this->mask.data(), n, this->search);
+        return addr == 0 ? 0 : addr + offset;
+    }
+    template <typename T>
+    [[nodiscard]] T sigscan_nullable(void) const {
+        return reinterpret_cast<T>(this->sigscan_nullable());
+    }
+};
+
+/// A sigscan pattern which was registered for offline validation.
+struct RegisteredPattern {
+    std::string_view game;
+    std::string_view name;
+    const uint8_t* bytes;
+    const uint8_t* mask;
+    size_t pattern_size;
+    ptrdiff_t offset;
+    const PatternSearchInfo* search;
+};
+
+/**
+ * @brief Gets all patterns registered via `UNREALSDK_REGISTER_PATTERN`.
+ * @note Always empty unless the game pattern tables were compiled with `UNREALSDK_PATTERN_REGISTRY`
+ *       defined, which only offline tools do.
+ *
+ * @return The registered patterns, in registration order.
+ */
+[[nodiscard]] const std::vector<RegisteredPattern>& registered_patterns(void);
+
+namespace impl {
+
+/**
+ * @brief Adds a pattern to the registry.
+ *
+ * @param pattern The pattern to add.
+ */
+void register_pattern(const RegisteredPattern& pattern);
+
+/**
+ * @brief Helper to register a pattern during static initialization.
+ */
+struct PatternRegistration {
+    template <size_t n>
+    PatternRegistration(std::string_view game, std::string_view name, const Pattern<n>& pattern) {
+        register_pattern({.game = game,
+                          .name = name,
+                          .bytes = pattern.bytes.data(),
+                          .mask = pattern.mask.data(),
+                          .pattern_size = n,
+                          .offset = pattern.offset,
+                          .search = &pattern.search});
+    }
+};
+
+}  // namespace impl
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#ifdef UNREALSDK_PATTERN_REGISTRY
+/**
+ * @brief Registers a pattern, so that it can be validated offline.
+ * @note Must be placed at namespace scope, after the pattern's definition. Each game registers all
+ *       it's patterns in it's own `patterns.cpp`.
+ *
+ * @param game The name of the game the pattern belongs to.
+ * @param pattern The pattern variable.
+ */
+#define UNREALSDK_REGISTER_PATTERN(game, pattern)                               \
+    const unrealsdk::memory::impl::PatternRegistration pattern##_REGISTRATION { \
+        game, #pattern, pattern                                                 \
+    }
+#else
+#define UNREALSDK_REGISTER_PATTERN(game, pattern) static_assert(true)
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+}  // namespace unrealsdk::memory
+
+#endif /* UNREALSDK_PATTERN_H */
@@ -0,0 +1,133 @@
+// Deliberately doesn't include the pch, see the header
+#include "unrealsdk/pattern_search.h"
+
+namespace unrealsdk::memory {
+
+uintptr_t find_pattern(const uint8_t* bytes,
+                       const uint8_t* mask,
+                       size_t pattern_size,
+                       const PatternSearchInfo& info,
+                       uintptr_t start,
+                       size_t size) {
+    if (pattern_size > size) {
+        return 0;
+    }
+
+    // Entirely wildcards, matches immediately
+    if (info.search_size == 0) {
+        return start;
+    }
+
+    auto start_ptr = reinterpret_cast<const uint8_t*>(start);
+    const size_t last = info.search_size - 1;
+    const size_t final_window = size - pattern_size;
+
+    // Horspool search - after each window, shift based on the byte under the last pattern byte
+    // Within each window, check the anchor byte first, since it's picked to fail fast
+    for (size_t i = 0; i <= final_window; i += info.skip[start_ptr[i + last]]) {
+        auto window = &start_ptr[i];
+        if ((window[info.anchor] & mask[info.anchor]) != bytes[info.anchor]) {
+            continue;
+        }
+
+        bool found = true;
+        for (size_t j = 0; j < info.search_size; j++) {
+            if ((window[j] & mask[j]) != bytes[j]) {
+                found = false;
+                break;
+            }
+        }
+        if (found) {
+            return reinterpret_cast<uintptr_t>(window);
+        }
+    }
+
+    return 0;
+}
+
+std::vector<uintptr_t> find_patches(std::span<const PatchSpec> patches,
+                                    uintptr_t start,
+                                    size_t size) {
+    std::vector<uintptr_t> results(patches.size(), 0);
+    std::vector<bool> found(patches.size(), false);
+
+    // For each possible byte, the patches whose anchor byte could match it. Each byte we scan then
+    // only needs to check the few patches which could possibly start relative to it.
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    std::array<std::vector<size_t>, 256> candidates{};
+    size_t remaining = 0;
+
+    for (size_t idx = 0; idx < patches.size(); idx++) {
+        const auto& patch = patches[idx];
+        if (patch.pattern_size > size) {
+            continue;
+        }
+        // Entirely wildcards, matches immediately
+        if (patch.search->search_size == 0) {
+            results[idx] = start + patch.offset;
+            found[idx] = true;
+            continue;
+        }
+
+        auto anchor = patch.search->anchor;
+        for (size_t byte = 0; byte < candidates.size(); byte++) {
+            if ((byte & patch.mask[anchor]) == patch.bytes[anchor]) {
+                candidates.at(byte).push_back(idx);
+            }
+        }
+        remaining++;
+    }
+
+    const auto* data = reinterpret_cast<const uint8_t*>(start);
+    for (size_t pos = 0; pos < size && remaining > 0; pos++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (auto idx : candidates.at(data[pos])) {
+            const auto& patch = patches[idx];
+            auto anchor = patch.search->anchor;
+            if (found[idx] || pos < anchor || pos - anchor > size - patch.pattern_size) {
+                continue;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto* window = &data[pos - anchor];
+            bool matches = true;
+            for (size_t i = 0; i < patch.search->search_size; i++) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if ((window[i] & patch.mask[i]) != patch.bytes[i]) {
+                    matches = false;
+                    break;
+                }
+            }
+            if (matches) {
+                results[idx] = reinterpret_cast<uintptr_t>(window) + patch.offset;
+                found[idx] = true;
+                remaining--;
+            }
+        }
+    }
+
+    return results;
+}
+
+std::vector<uintptr_t> group_by_page(std::span<const std::pair<uintptr_t, size_t>> ranges,
+                                     size_t page_size) {
+    const uintptr_t page_mask = ~static_cast<uintptr_t>(page_size - 1);
+
+    std::vector<uintptr_t> pages{};
+    for (const auto& [addr, size] : ranges) {
+        if (size == 0) {
+            continue;
+        }
+        const uintptr_t last_page = (addr + size - 1) & page_mask;
+        for (uintptr_t page = addr & page_mask; page <= last_page; page += page_size) {
+            pages.push_back(page);
+        }
+    }
+
+    std::ranges::sort(pages);
+    auto [first, last] = std::ranges::unique(pages);
+    pages.erase(first, last);
+    return pages;
+}
+
+}  // namespace unrealsdk::memory
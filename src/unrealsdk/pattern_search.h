@@ -0,0 +1,249 @@
+#ifndef UNREALSDK_PATTERN_SEARCH_H
+#define UNREALSDK_PATTERN_SEARCH_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that the pure searching logic can be built and tested on any platform.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace unrealsdk::memory {
+
+template <size_t n>
+struct Pattern;
+
+namespace impl {
+
+/**
+ * @brief Gets a rough estimate of how common a byte is in x86/x64 code.
+ * @note Only intended to pick between bytes, the absolute values are meaningless.
+ *
+ * @param byte The byte to check.
+ * @return The byte's commonness, where lower values are more common.
+ */
+constexpr size_t x86_byte_rarity(uint8_t byte) {
+    // Roughly ordered by how common they are, most common first. Mostly padding, REX prefixes,
+    // movs, calls, jumps, and the most common ModRM/SIB/displacement bytes.
+    // NOLINTBEGIN(readability-magic-numbers)
+    constexpr std::array<uint8_t, 40> common_bytes = {
+        0x00, 0xFF, 0x48, 0x8B, 0xCC, 0x89, 0x24, 0xE8, 0x0F, 0x4C, 0x44, 0x83, 0x8D, 0x01,
+        0x85, 0xC0, 0x74, 0x08, 0x10, 0x20, 0x45, 0x41, 0x75, 0x28, 0x40, 0x49, 0x30, 0x33,
+        0xC3, 0x18, 0x04, 0xEB, 0x90, 0x50, 0x38, 0xC7, 0x4D, 0x84, 0x14, 0x5C,
+    };
+    // NOLINTEND(readability-magic-numbers)
+
+    for (size_t i = 0; i < common_bytes.size(); i++) {
+        if (common_bytes[i] == byte) {
+            return i;
+        }
+    }
+    return common_bytes.size();
+}
+
+}  // namespace impl
+
+/**
+ * @brief Metadata used to speed up searching for a pattern.
+ * @note Computed at compile time for all patterns created from hex strings.
+ */
+struct PatternSearchInfo {
+    /// Bad character skip table, indexed by the byte under the last searched pattern byte.
+    std::array<uint8_t, 256> skip{};
+    /// How many bytes of the pattern need to be compared - excludes any trailing wildcards.
+    size_t search_size = 0;
+    /// The index of the first byte to compare, picked to be one which is rare in x86 code.
+    size_t anchor = 0;
+
+    constexpr PatternSearchInfo(void) = default;
+
+    /**
+     * @brief Analyses a pattern to create it's search metadata.
+     *
+     * @param bytes The bytes to search for. Must already be masked.
+     * @param mask The mask over the bytes to search for.
+     * @param pattern_size The size of the bytes + mask.
+     */
+    constexpr PatternSearchInfo(const uint8_t* bytes, const uint8_t* mask, size_t pattern_size) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
+
+        // Trailing wildcards can never fail to match, so just ignore them. This also means the
+        // last byte we search is never a full wildcard, which would turn every skip into 1.
+        this->search_size = pattern_size;
+        while (this->search_size > 0 && mask[this->search_size - 1] == 0) {
+            this->search_size--;
+        }
+        if (this->search_size == 0) {
+            return;
+        }
+        const size_t last = this->search_size - 1;
+
+        // This is a standard Horspool bad character table, we look at the byte which lined up
+        // with the last pattern byte, and shift so that it lines up with the next possible match
+        // to the left. The only complication is wildcards - a full wildcard matches every byte,
+        // so nothing can ever shift past it, and a partial one matches a whole set of bytes.
+        size_t first_relevant = 0;
+        for (size_t i = 0; i < last; i++) {
+            if (mask[i] == 0) {
+                first_relevant = i + 1;
+            }
+        }
+        const size_t max_skip = std::numeric_limits<uint8_t>::max();
+        this->skip.fill(
+            static_cast<uint8_t>(std::min<size_t>(this->search_size - first_relevant, max_skip)));
+
+        // Go forwards so that closer bytes overwrite further ones with smaller shifts
+        for (size_t i = first_relevant; i < last; i++) {
+            auto shift = static_cast<uint8_t>(std::min<size_t>(last - i, max_skip));
+
+            // Iterate through all the bytes this one matches, by walking subsets of the free bits
+            const auto free_bits = static_cast<uint8_t>(~mask[i]);
+            uint8_t subset = free_bits;
+            while (true) {
+                this->skip[bytes[i] | subset] = shift;
+                if (subset == 0) {
+                    break;
+                }
+                subset = static_cast<uint8_t>((subset - 1) & free_bits);
+            }
+        }
+
+        // Check the rarest fully specified byte first, to reject most windows as fast as possible
+        // If there are no fully specified bytes, fall back to the last byte, which we at least
+        // know isn't a full wildcard
+        this->anchor = last;
+        bool found_full_byte = false;
+        size_t best_rarity = 0;
+        for (size_t i = 0; i < this->search_size; i++) {
+            if (mask[i] != 0xFF) {
+                continue;
+            }
+            auto rarity = impl::x86_byte_rarity(bytes[i]);
+            if (!found_full_byte || rarity > best_rarity) {
+                this->anchor = i;
+                best_rarity = rarity;
+                found_full_byte = true;
+            }
+        }
+
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
+    }
+};
+
+/**
+ * @brief A single hex edit, overwriting the bytes at an offset from where a pattern was found.
+ * @note This is a reference type, it holds references to the pattern and replacement bytes.
+ */
+struct PatchSpec {
+    /// The name of this patch, used in logging.
+    std::string_view name;
+    /// The pattern to find.
+    const uint8_t* bytes;
+    const uint8_t* mask;
+    size_t pattern_size;
+    const PatternSearchInfo* search;
+    /// The offset from the start of the match to write the replacement bytes to.
+    ptrdiff_t offset;
+    /// The bytes to write.
+    std::span<const uint8_t> replacement;
+
+    /**
+     * @brief Creates a new patch spec.
+     *
+     * @tparam n The size of the pattern - should be picked up automatically.
+     * @param name The name of this patch, used in logging.
+     * @param pattern The pattern to find. The pattern's own offset is respected.
+     * @param replacement The bytes to write.
+     * @param offset An extra offset from the pattern's result to write the replacement bytes to.
+     */
+    template <size_t n>
+    constexpr PatchSpec(std::string_view name,
+                        const Pattern<n>& pattern,
+                        std::span<const uint8_t> replacement,
+                        ptrdiff_t offset = 0)
+        : name(name),
+          bytes(pattern.bytes.data()),
+          mask(pattern.mask.data()),
+          pattern_size(n),
+          search(&pattern.search),
+          offset(pattern.offset + offset),
+          replacement(replacement) {}
+
+    /**
+     * @brief Creates a new patch spec from a raw pattern.
+     *
+     * @param name The name of this patch, used in logging.
+     * @param bytes The bytes to search for. Must already be masked.
+     * @param mask The mask over the bytes to search for.
+     * @param pattern_size The size of the bytes + mask.
+     * @param search Precomputed search metadata for the pattern.
+     * @param replacement The bytes to write.
+     * @param offset The offset from the start of the match to write the replacement bytes to.
+     */
+    constexpr PatchSpec(std::string_view name,
+                        const uint8_t* bytes,
+                        const uint8_t* mask,
+                        size_t pattern_size,
+                        const PatternSearchInfo* search,
+                        std::span<const uint8_t> replacement,
+                        ptrdiff_t offset = 0)
+        : name(name),
+          bytes(bytes),
+          mask(mask),
+          pattern_size(pattern_size),
+          search(search),
+          offset(offset),
+          replacement(replacement) {}
+};
+
+/**
+ * @brief Finds the first match of a pattern within a region of memory.
+ * @note Does not touch page protections, so may be run over any readable buffer.
+ *
+ * @param bytes The bytes to search for. Must already be masked.
+ * @param mask The mask over the bytes to search for.
+ * @param pattern_size The size of the bytes + mask.
+ * @param info Precomputed search metadata for the pattern.
+ * @param start The address to start searching at.
+ * @param size The length of the region to search.
+ * @return The address of the first match, or 0 if not found.
+ */
+[[nodiscard]] uintptr_t find_pattern(const uint8_t* bytes,
+                                     const uint8_t* mask,
+                                     size_t pattern_size,
+                                     const PatternSearchInfo& info,
+                                     uintptr_t start,
+                                     size_t size);
+
+/**
+ * @brief Finds where to apply a set of patches, scanning the given memory range only once.
+ * @note Does not touch page protections, so may be run over any readable buffer.
+ *
+ * @param patches The patches to find.
+ * @param start The address to start searching at.
+ * @param size The length of the region to search.
+ * @return The address to write each patch to, in the same order, or 0 if it wasn't found.
+ */
+[[nodiscard]] std::vector<uintptr_t> find_patches(std::span<const PatchSpec> patches,
+                                                  uintptr_t start,
+                                                  size_t size);
+
+/**
+ * @brief Gets all the pages touched by a set of address ranges.
+ *
+ * @param ranges The ranges to check, as pairs of their start address and size.
+ * @param page_size The page size. Must be a power of two.
+ * @return The start address of every page touched, sorted and deduplicated.
+ */
+[[nodiscard]] std::vector<uintptr_t> group_by_page(
+    std::span<const std::pair<uintptr_t, size_t>> ranges,
+    size_t page_size);
+
+}  // namespace unrealsdk::memory
+
+#endif /* UNREALSDK_PATTERN_SEARCH_H */
@@ -52,6 +52,7 @@
 #include <optional>
 #include <queue>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
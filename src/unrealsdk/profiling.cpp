@@ -0,0 +1,125 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/profiling.h"
+
+namespace unrealsdk::profiling {
+
+namespace impl {
+
+std::atomic<bool> enabled = false;
+
+}  // namespace impl
+
+namespace {
+
+struct TraceEvent {
+    std::string name;
+    std::string category;
+    clock::time_point start;
+    clock::time_point end;
+    DWORD thread_id;
+};
+
+std::mutex events_mutex{};
+std::vector<TraceEvent> events{};
+
+#ifndef UNREALSDK_IMPORTING
+
+std::filesystem::path trace_file{};
+clock::time_point trace_origin{};
+
+/**
+ * @brief Escapes a string for use within a json string literal.
+ *
+ * @param str The string to escape.
+ * @return The escaped string.
+ */
+std::string escape_json(std::string_view str) {
+    std::string escaped{};
+    escaped.reserve(str.size());
+    for (auto chr : str) {
+        if (chr == '"' || chr == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(chr);
+        } else if (static_cast<unsigned char>(chr) < ' ') {
+            escaped += std::format("\\u{:04x}", static_cast<unsigned char>(chr));
+        } else {
+            escaped.push_back(chr);
+        }
+    }
+    return escaped;
+}
+
+#endif
+
+}  // namespace
+
+#ifndef UNREALSDK_IMPORTING
+
+void init(const std::filesystem::path& file, clock::time_point origin) {
+    const std::scoped_lock lock(events_mutex);
+
+    trace_file = file;
+    trace_origin = origin;
+    events.clear();
+    impl::enabled.store(true);
+}
+
+void finish(void) {
+    std::vector<TraceEvent> finished_events{};
+    {
+        const std::scoped_lock lock(events_mutex);
+        if (!impl::enabled.exchange(false)) {
+            return;
+        }
+        finished_events = std::move(events);
+        events.clear();
+    }
+
+    std::ofstream output{trace_file, std::ofstream::trunc};
+    if (!output.is_open()) {
+        LOG(ERROR, "Failed to open startup trace file {}", trace_file.string());
+        return;
+    }
+
+    const auto pid = GetCurrentProcessId();
+    using duration_us = std::chrono::duration<double, std::micro>;
+
+    output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (size_t i = 0; i < finished_events.size(); i++) {
+        const auto& event = finished_events[i];
+        output << std::format(
+            R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+            escape_json(event.name), escape_json(event.category),
+            duration_us{event.start - trace_origin}.count(),
+            duration_us{event.end - event.start}.count(), pid, event.thread_id);
+        output << (i + 1 < finished_events.size() ? ",\n" : "\n");
+    }
+    output << "]}\n";
+
+    LOG(MISC, "Wrote {} startup trace events to {}", finished_events.size(), trace_file.string());
+}
+
+#endif
+
+void record(std::string_view name,
+            std::string_view category,
+            clock::time_point start,
+            clock::time_point end) {
+    if (!is_enabled()) {
+        return;
+    }
+
+    const std::scoped_lock lock(events_mutex);
+    // Check again under the lock, in case we finished in the meantime
+    if (!is_enabled()) {
+        return;
+    }
+    events.push_back({.name = std::string{name},
+                      .category = std::string{category},
+                      .start = start,
+                      .end = end,
+                      .thread_id = GetCurrentThreadId()});
+}
+
+}  // namespace unrealsdk::profiling
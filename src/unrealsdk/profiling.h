@@ -0,0 +1,95 @@
+#ifndef UNREALSDK_PROFILING_H
+#define UNREALSDK_PROFILING_H
+
+#include "unrealsdk/pch.h"
+
+namespace unrealsdk::profiling {
+
+using clock = std::chrono::steady_clock;
+
+namespace impl {
+
+extern std::atomic<bool> enabled;
+
+}  // namespace impl
+
+#ifndef UNREALSDK_IMPORTING
+
+/**
+ * @brief Starts recording startup trace events.
+ * @note Until this is called, all timers are no-ops.
+ *
+ * @param file The file to write the trace to once finished.
+ * @param origin The time to use as the start of the trace.
+ */
+void init(const std::filesystem::path& file, clock::time_point origin);
+
+/**
+ * @brief Stops recording trace events, and writes all recorded events to the trace file.
+ * @note The file uses the Chrome trace event format, and can be opened in `chrome://tracing` or
+ *       Perfetto.
+ */
+void finish(void);
+
+#endif
+
+/**
+ * @brief Checks if we're currently recording trace events.
+ *
+ * @return True if recording.
+ */
+[[nodiscard]] inline bool is_enabled(void) {
+    return impl::enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records a complete trace event, which has already finished.
+ * @note Does nothing if not currently recording.
+ *
+ * @param name The name of the event.
+ * @param category The category of the event.
+ * @param start When the event started.
+ * @param end When the event ended.
+ */
+void record(std::string_view name,
+            std::string_view category,
+            clock::time_point start,
+            clock::time_point end);
+
+/**
+ * @brief RAII class which records a trace event covering it's lifetime.
+ * @note When not recording, this just costs a single atomic load.
+ */
+class ScopedTimer {
+   private:
+    std::string_view name;
+    std::string_view category;
+    std::optional<clock::time_point> start;
+
+   public:
+    /**
+     * @brief Starts a new timer.
+     *
+     * @param name The name of the event. Must remain valid until this timer is destroyed.
+     * @param category The category of the event. Must remain valid until this timer is destroyed.
+     */
+    ScopedTimer(std::string_view name, std::string_view category)
+        : name(name),
+          category(category),
+          start(is_enabled() ? std::optional{clock::now()} : std::nullopt) {}
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer(ScopedTimer&&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+    ~ScopedTimer() {
+        if (this->start.has_value()) {
+            record(this->name, this->category, *this->start, clock::now());
+        }
+    }
+};
+
+}  // namespace unrealsdk::profiling
+
+#endif /* UNREALSDK_PROFILING_H */
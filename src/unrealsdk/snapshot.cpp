@@ -0,0 +1,469 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/snapshot.h"
+#include "unrealsdk/snapshot_format.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/find_class.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/wrappers/gobjects.h"
+#include "unrealsdk/unrealsdk.h"
+#include "unrealsdk/utils.h"
+
+using namespace unrealsdk::unreal;
+
+namespace unrealsdk::snapshot {
+
+namespace {
+
+const constexpr size_t MAX_DUMP_THREADS = 8;
+// Below this it's not worth the overhead of starting threads
+const constexpr size_t MIN_ITEMS_PER_THREAD = 0x1000;
+
+/**
+ * @brief Runs a function over a range of indexes, split over multiple threads.
+ * @note Rethrows the first exception any thread threw, after all of them have finished.
+ *
+ * @param count The number of indexes.
+ * @param func The function to run on each slice, taking the start and end indexes.
+ */
+void parallel_for(size_t count, const std::function<void(size_t, size_t)>& func) {
+    auto num_threads = std::clamp<size_t>(
+        std::min<size_t>(std::thread::hardware_concurrency(), count / MIN_ITEMS_PER_THREAD), 1,
+        MAX_DUMP_THREADS);
+    auto per_thread = (count + num_threads - 1) / num_threads;
+
+    std::vector<std::exception_ptr> errors(num_threads);
+    std::vector<std::thread> threads{};
+    for (size_t i = 0, start = 0; start < count; i++, start += per_thread) {
+        auto end = std::min(start + per_thread, count);
+        threads.emplace_back([&func, &errors, i, start, end]() {
+            try {
+                func(start, end);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/// A property record, before we've assigned indexes to it's names.
+struct PendingProperty {
+    format::Property record;
+    FName name;
+    FName type;
+    // The property's inner property, which still needs to be added
+    const ZProperty* inner;
+};
+
+/// All pending property records for a single struct.
+struct PendingStruct {
+    // The struct's own properties, followed by any inner properties
+    std::vector<PendingProperty> properties;
+    size_t num_own;
+};
+
+enum class ObjectKind : uint8_t {
+    OTHER,
+    STRUCT,
+    ENUM,
+};
+
+class SnapshotBuilder {
+   private:
+    std::vector<const UStruct*> structs;
+    std::vector<const UEnum*> enums;
+    std::unordered_map<const UObject*, uint32_t> struct_indexes;
+    std::unordered_map<const UObject*, uint32_t> enum_indexes;
+
+    std::vector<PendingStruct> pending_structs;
+
+    std::string strings;
+    std::vector<format::StringRef> names;
+    std::unordered_map<FName, uint32_t> name_indexes;
+
+    std::vector<format::Struct> struct_records;
+    std::vector<format::Property> property_records;
+    std::vector<format::Enum> enum_records;
+    std::vector<format::EnumValue> enum_value_records;
+
+    /**
+     * @brief Looks up the index of a struct or enum.
+     *
+     * @param indexes The index map to look in.
+     * @param obj The object to look up. May be null.
+     * @return The object's index, or NONE if it's null or wasn't dumped.
+     */
+    static uint32_t index_of(const std::unordered_map<const UObject*, uint32_t>& indexes,
+                             const UObject* obj) {
+        if (obj == nullptr) {
+            return format::NONE;
+        }
+        auto iter = indexes.find(obj);
+        return iter == indexes.end() ? format::NONE : iter->second;
+    }
+
+    /**
+     * @brief Adds a string to the strings section.
+     *
+     * @param str The string to add.
+     * @return A reference to the added string.
+     */
+    format::StringRef add_string(std::string_view str) {
+        const format::StringRef ref{.offset = static_cast<uint32_t>(this->strings.size()),
+                                    .size = static_cast<uint32_t>(str.size())};
+        this->strings.append(str);
+        return ref;
+    }
+
+    /**
+     * @brief Gets the index of a name in the names section, adding it if needed.
+     *
+     * @param name The name to get.
+     * @return The name's index.
+     */
+    uint32_t add_name(const FName& name) {
+        auto [iter, inserted] =
+            this->name_indexes.try_emplace(name, static_cast<uint32_t>(this->names.size()));
+        if (inserted) {
+            this->names.push_back(this->add_string(std::string{name}));
+        }
+        return iter->second;
+    }
+
+    /**
+     * @brief Gets the pending record for a property, filling in everything but the names.
+     *
+     * @param prop The property.
+     * @param owner The index of the struct the property is in.
+     * @return The pending record.
+     */
+    [[nodiscard]] PendingProperty read_property(const ZProperty* prop, uint32_t owner) const {
+        PendingProperty pending{
+            .record = {.name = format::NONE,
+                       .type = format::NONE,
+                       .offset = prop->Offset_Internal(),
+                       .element_size = prop->ElementSize(),
+                       .array_dim = prop->ArrayDim(),
+                       .field_mask = 0,
+                       .flags = static_cast<uint64_t>(prop->PropertyFlags()),
+                       .owner = owner,
+                       .struct_ref = format::NONE,
+                       .meta_ref = format::NONE,
+                       .enum_ref = format::NONE,
+                       .inner = format::NONE,
+                       .reserved = 0},
+            .name = prop->Name(),
+            .type = prop->Class()->Name(),
+            .inner = nullptr,
+        };
+        auto& record = pending.record;
+
+        // Rather than list every property type, just check which fields each one has
+        cast<cast_options<true, true>>(
+            prop,
+            [this, &pending, &record]<typename T>(const T* casted) {
+                if constexpr (requires { casted->Struct(); }) {
+                    record.struct_ref = index_of(this->struct_indexes, casted->Struct());
+                }
+                if constexpr (requires { casted->PropertyClass(); }) {
+                    record.struct_ref = index_of(this->struct_indexes, casted->PropertyClass());
+                }
+                if constexpr (requires { casted->InterfaceClass(); }) {
+                    record.struct_ref = index_of(this->struct_indexes, casted->InterfaceClass());
+                }
+                if constexpr (requires { casted->Signature(); }) {
+                    record.struct_ref = index_of(this->struct_indexes, casted->Signature());
+                }
+                if constexpr (requires { casted->MetaClass(); }) {
+                    record.meta_ref = index_of(this->struct_indexes, casted->MetaClass());
+                }
+                if constexpr (requires { casted->Enum(); }) {
+                    record.enum_ref = index_of(this->enum_indexes, casted->Enum());
+                }
+                if constexpr (requires { casted->Inner(); }) {
+                    pending.inner = casted->Inner();
+                }
+                if constexpr (requires { casted->UnderlyingProp(); }) {
+                    pending.inner = casted->UnderlyingProp();
+                }
+                if constexpr (requires { casted->FieldMask(); }) {
+                    record.field_mask = casted->FieldMask();
+                }
+            },
+            [](const ZProperty*) {
+                // Unknown property type, still dump the base fields
+            });
+
+        return pending;
+    }
+
+    /**
+     * @brief Gets the pending records for all of a struct's own properties.
+     *
+     * @param idx The index of the struct to read.
+     * @return The pending records.
+     */
+    [[nodiscard]] PendingStruct read_struct_properties(uint32_t idx) const {
+        const auto* ustruct = this->structs[idx];
+
+        // Property iteration includes inherited properties, which always come after our own ones
+        auto total = std::ranges::distance(ustruct->properties());
+        auto inherited = ustruct->SuperField() == nullptr
+                             ? 0
+                             : std::ranges::distance(ustruct->SuperField()->properties());
+        auto num_own = static_cast<size_t>(total >= inherited ? total - inherited : total);
+
+        std::vector<PendingProperty> pending{};
+        pending.reserve(num_own);
+        for (auto prop : ustruct->properties()) {
+            if (pending.size() >= num_own) {
+                break;
+            }
+            pending.push_back(this->read_property(prop, idx));
+        }
+
+        // Append inner properties after all the struct's own ones. Since this loop also goes over
+        // the ones we append, it handles nested inner properties too.
+        for (size_t i = 0; i < pending.size(); i++) {
+            if (pending[i].inner == nullptr) {
+                continue;
+            }
+            auto inner = this->read_property(pending[i].inner, idx);
+            pending[i].record.inner = static_cast<uint32_t>(pending.size());
+            pending.push_back(inner);
+        }
+
+        return {.properties = std::move(pending), .num_own = num_own};
+    }
+
+   public:
+    /**
+     * @brief Finds all structs and enums in GObjects.
+     */
+    void find_objects(void) {
+        // Casting initializes each class' name the first time it's used, which calls into unreal,
+        // so make sure they're all initialized here, before we start any other threads
+        []<typename... Ts>(std::tuple<Ts...>* /*unused*/) {
+            (static_cast<void>(cls_fname<Ts>()), ...);
+        }(static_cast<all_unreal_classes*>(nullptr));
+
+        auto struct_cls = find_class<UStruct>();
+        auto enum_cls = find_class<UEnum>();
+
+        const auto& objects = unrealsdk::gobjects();
+        std::vector<ObjectKind> kinds(objects.size(), ObjectKind::OTHER);
+        parallel_for(kinds.size(), [&objects, &kinds, struct_cls, enum_cls](size_t start,
+                                                                             size_t end) {
+            for (auto i = start; i < end; i++) {
+                auto obj = objects.obj_at(i);
+                if (obj == nullptr) {
+                    continue;
+                }
+                if (obj->is_instance(struct_cls)) {
+                    kinds[i] = ObjectKind::STRUCT;
+                } else if (obj->is_instance(enum_cls)) {
+                    kinds[i] = ObjectKind::ENUM;
+                }
+            }
+        });
+
+        // Collect them on this thread, so the order stays deterministic
+        for (size_t i = 0; i < kinds.size(); i++) {
+            if (kinds[i] == ObjectKind::STRUCT) {
+                auto ustruct = reinterpret_cast<const UStruct*>(objects.obj_at(i));
+                this->struct_indexes.emplace(ustruct, static_cast<uint32_t>(this->structs.size()));
+                this->structs.push_back(ustruct);
+            } else if (kinds[i] == ObjectKind::ENUM) {
+                auto uenum = reinterpret_cast<const UEnum*>(objects.obj_at(i));
+                this->enum_indexes.emplace(uenum, static_cast<uint32_t>(this->enums.size()));
+                this->enums.push_back(uenum);
+            }
+        }
+    }
+
+    /**
+     * @brief Reads the properties of every struct.
+     */
+    void read_properties(void) {
+        this->pending_structs.resize(this->structs.size());
+        parallel_for(this->structs.size(), [this](size_t start, size_t end) {
+            for (auto i = start; i < end; i++) {
+                this->pending_structs[i] = this->read_struct_properties(static_cast<uint32_t>(i));
+            }
+        });
+    }
+
+    /**
+     * @brief Builds all the final records.
+     * @note Must be run on the game thread, since some of this calls back into unreal.
+     */
+    void build_records(void) {
+        auto class_cls = find_class<UClass>();
+        auto script_struct_cls = find_class<UScriptStruct>();
+        auto function_cls = find_class<UFunction>();
+
+        this->struct_records.reserve(this->structs.size());
+        for (size_t i = 0; i < this->structs.size(); i++) {
+            const auto* ustruct = this->structs[i];
+            auto& pending = this->pending_structs[i];
+
+            format::StructKind kind = format::StructKind::STRUCT;
+            uint32_t function_flags = 0;
+            if (ustruct->is_instance(function_cls)) {
+                kind = format::StructKind::FUNCTION;
+                function_flags = reinterpret_cast<const UFunction*>(ustruct)->FunctionFlags();
+            } else if (ustruct->is_instance(class_cls)) {
+                kind = format::StructKind::CLASS;
+            } else if (ustruct->is_instance(script_struct_cls)) {
+                kind = format::StructKind::SCRIPT_STRUCT;
+            }
+
+            auto first_property = static_cast<uint32_t>(this->property_records.size());
+            for (auto& prop : pending.properties) {
+                prop.record.name = this->add_name(prop.name);
+                prop.record.type = this->add_name(prop.type);
+                if (prop.record.inner != format::NONE) {
+                    prop.record.inner += first_property;
+                }
+                this->property_records.push_back(prop.record);
+            }
+            pending.properties = {};
+
+            this->struct_records.push_back({
+                .name = this->add_name(ustruct->Name()),
+                .class_name = this->add_name(ustruct->Class()->Name()),
+                .path = this->add_string(utils::narrow(ustruct->get_path_name())),
+                .kind = kind,
+                .super = index_of(this->struct_indexes, ustruct->SuperField()),
+                .outer = index_of(this->struct_indexes, ustruct->Outer()),
+                .first_property = first_property,
+                .num_properties = static_cast<uint32_t>(pending.num_own),
+                .size = static_cast<uint32_t>(ustruct->get_struct_size()),
+#if UNREALSDK_USTRUCT_HAS_ALIGNMENT
+                .alignment = static_cast<uint32_t>(ustruct->MinAlignment()),
+#else
+                .alignment = 0,
+#endif
+                .function_flags = function_flags,
+            });
+        }
+
+        this->enum_records.reserve(this->enums.size());
+        for (const auto* uenum : this->enums) {
+            std::vector<format::EnumValue> values{};
+            for (const auto& [name, value] : uenum->get_names()) {
+                values.push_back({.name = this->add_name(name), .reserved = 0, .value = value});
+            }
+            // Names are stored in a hash map, sort them so the output's deterministic
+            std::ranges::sort(values, [](const auto& lhs, const auto& rhs) {
+                return std::tie(lhs.value, lhs.name) < std::tie(rhs.value, rhs.name);
+            });
+
+            this->enum_records.push_back({
+                .name = this->add_name(uenum->Name()),
+                .reserved = 0,
+                .path = this->add_string(utils::narrow(uenum->get_path_name())),
+                .first_value = static_cast<uint32_t>(this->enum_value_records.size()),
+                .num_values = static_cast<uint32_t>(values.size()),
+            });
+            this->enum_value_records.insert(this->enum_value_records.end(), values.begin(),
+                                            values.end());
+        }
+    }
+
+    /**
+     * @brief Writes the snapshot to a file.
+     *
+     * @param path The file to write to.
+     * @return Stats about what was written.
+     */
+    DumpStats write(const std::filesystem::path& path) const {
+        format::Header header{
+            .magic = format::MAGIC,
+            .version = format::VERSION,
+            .pointer_size = sizeof(void*),
+            .reserved = 0,
+            .strings = {},
+            .names = {},
+            .structs = {},
+            .properties = {},
+            .enums = {},
+            .enum_values = {},
+        };
+
+        uint64_t pos = sizeof(header);
+        auto place = [&pos](format::Section& section, size_t count, size_t record_size) {
+            pos = (pos + format::SECTION_ALIGNMENT - 1) & ~(format::SECTION_ALIGNMENT - 1);
+            section = {.offset = pos, .count = count};
+            pos += count * record_size;
+        };
+        place(header.strings, this->strings.size(), sizeof(char));
+        place(header.names, this->names.size(), sizeof(format::StringRef));
+        place(header.structs, this->struct_records.size(), sizeof(format::Struct));
+        place(header.properties, this->property_records.size(), sizeof(format::Property));
+        place(header.enums, this->enum_records.size(), sizeof(format::Enum));
+        place(header.enum_values, this->enum_value_records.size(), sizeof(format::EnumValue));
+
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        if (!file) {
+            throw std::runtime_error("Failed to open snapshot file for writing");
+        }
+
+        auto write_section = [&file](const format::Section& section, const void* data,
+                                     size_t bytes) {
+            auto current = static_cast<uint64_t>(file.tellp());
+            const std::array<char, format::SECTION_ALIGNMENT> padding{};
+            file.write(padding.data(), static_cast<std::streamsize>(section.offset - current));
+            file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        write_section(header.strings, this->strings.data(), this->strings.size());
+        write_section(header.names, this->names.data(),
+                      this->names.size() * sizeof(format::StringRef));
+        write_section(header.structs, this->struct_records.data(),
+                      this->struct_records.size() * sizeof(format::Struct));
+        write_section(header.properties, this->property_records.data(),
+                      this->property_records.size() * sizeof(format::Property));
+        write_section(header.enums, this->enum_records.data(),
+                      this->enum_records.size() * sizeof(format::Enum));
+        write_section(header.enum_values, this->enum_value_records.data(),
+                      this->enum_value_records.size() * sizeof(format::EnumValue));
+
+        if (!file) {
+            throw std::runtime_error("Failed to write snapshot file");
+        }
+
+        return {
+            .structs = this->struct_records.size(),
+            .properties = this->property_records.size(),
+            .enums = this->enum_records.size(),
+            .names = this->names.size(),
+            .bytes = pos,
+        };
+    }
+};
+
+}  // namespace
+
+DumpStats dump(const std::filesystem::path& path) {
+    SnapshotBuilder builder{};
+    builder.find_objects();
+    builder.read_properties();
+    builder.build_records();
+    auto stats = builder.write(path);
+
+    LOG(MISC, "Dumped {} structs, {} properties and {} enums to {}", stats.structs,
+        stats.properties, stats.enums, path.string());
+    return stats;
+}
+
+}  // namespace unrealsdk::snapshot
@@ -0,0 +1,39 @@
+#ifndef UNREALSDK_SNAPSHOT_H
+#define UNREALSDK_SNAPSHOT_H
+
+#include "unrealsdk/pch.h"
+
+namespace unrealsdk::snapshot {
+
+/*
+This module dumps all reflection data to a compact binary snapshot, so that offline tools (object
+explorers, header generators, diffing between game versions, etc.) don't need to walk the live
+reflection graph one wrapper call at a time.
+
+See `snapshot_format.h` for the file format. The `snapshot_reader` library can read them back, on
+any platform.
+*/
+
+/// Summary of what was written to a snapshot.
+struct DumpStats {
+    size_t structs;
+    size_t properties;
+    size_t enums;
+    size_t names;
+    size_t bytes;
+};
+
+/**
+ * @brief Dumps the full reflection graph to a snapshot file.
+ * @note Walks GObjects and serializes properties over multiple threads, but relies on the game not
+ *       creating or destroying objects in the meantime - it should be called from the game thread,
+ *       e.g. from a hook or a console command.
+ *
+ * @param path The file to write to. Overwritten if it exists.
+ * @return Stats about what was written.
+ */
+DumpStats dump(const std::filesystem::path& path);
+
+}  // namespace unrealsdk::snapshot
+
+#endif /* UNREALSDK_SNAPSHOT_H */
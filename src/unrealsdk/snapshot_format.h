@@ -0,0 +1,135 @@
+#ifndef UNREALSDK_SNAPSHOT_FORMAT_H
+#define UNREALSDK_SNAPSHOT_FORMAT_H
+
+// This header is deliberately standalone - it doesn't include the pch, or anything windows specific
+// - so that offline tools can read snapshots on any platform.
+#include <cstdint>
+
+namespace unrealsdk::snapshot::format {
+
+/*
+A snapshot is a binary dump of the game's reflection data: every struct, class and function, their
+properties, and every enum.
+
+The file is a header, followed by a series of sections, each of which is a flat array of fixed size
+records. Everything is little endian, and every section is 8 byte aligned, so a memory mapped file
+can be used directly, without any parsing.
+
+Records refer to each other by index into the relevant section, with `NONE` meaning no reference.
+Names are an index into the names section, which holds the location of each name's string. Strings
+are stored as utf-8 in the strings section, and are not null terminated.
+
+A struct's own properties are stored contiguously, in the same order as `UStruct::properties`.
+Inherited properties are not included, follow the struct's super to find them. Inner properties,
+such as an array's inner property, are stored after them, and are only reachable through the
+property which owns them.
+*/
+
+constexpr uint32_t MAGIC = 0x50534E55;  // "UNSP"
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t NONE = 0xFFFFFFFF;
+constexpr uint64_t SECTION_ALIGNMENT = 8;
+
+struct Section {
+    // Offset from the start of the file, in bytes.
+    uint64_t offset;
+    // Number of records in the section. For the strings section, the number of bytes.
+    uint64_t count;
+};
+static_assert(sizeof(Section) == 16);
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    // The pointer size of the game which was dumped, in bytes.
+    uint32_t pointer_size;
+    uint32_t reserved;
+
+    Section strings;      // char
+    Section names;        // StringRef
+    Section structs;      // Struct
+    Section properties;   // Property
+    Section enums;        // Enum
+    Section enum_values;  // EnumValue
+};
+static_assert(sizeof(Header) == 112);
+
+struct StringRef {
+    uint32_t offset;
+    uint32_t size;
+};
+static_assert(sizeof(StringRef) == 8);
+
+enum class StructKind : uint32_t {
+    STRUCT = 0,
+    SCRIPT_STRUCT = 1,
+    CLASS = 2,
+    FUNCTION = 3,
+};
+
+struct Struct {
+    uint32_t name;
+    // The name of the struct's own class, e.g. "Class", "ScriptStruct", "Function".
+    uint32_t class_name;
+    StringRef path;
+    StructKind kind;
+    // Struct index.
+    uint32_t super;
+    // Struct index of the object containing this one, i.e. the class which owns a function. NONE
+    // if it isn't another struct.
+    uint32_t outer;
+    uint32_t first_property;
+    uint32_t num_properties;
+    // The struct's total size, including alignment.
+    uint32_t size;
+    // 0 if the game doesn't track struct alignment.
+    uint32_t alignment;
+    // Only valid for functions.
+    uint32_t function_flags;
+};
+static_assert(sizeof(Struct) == 48);
+
+struct Property {
+    uint32_t name;
+    // The name of the property's class, e.g. "IntProperty".
+    uint32_t type;
+    int32_t offset;
+    int32_t element_size;
+    int32_t array_dim;
+    // Only valid for bool properties.
+    uint32_t field_mask;
+    uint64_t flags;
+
+    // Struct index of the struct this property is in.
+    uint32_t owner;
+    // Struct index of the struct, class, interface, or delegate signature this property refers to.
+    uint32_t struct_ref;
+    // Struct index of the meta class of class properties.
+    uint32_t meta_ref;
+    // Enum index.
+    uint32_t enum_ref;
+    // Property index of array inner properties, or the underlying property of enum properties.
+    uint32_t inner;
+    uint32_t reserved;
+};
+static_assert(sizeof(Property) == 56);
+
+struct Enum {
+    uint32_t name;
+    uint32_t reserved;
+    StringRef path;
+    uint32_t first_value;
+    uint32_t num_values;
+};
+static_assert(sizeof(Enum) == 24);
+
+struct EnumValue {
+    uint32_t name;
+    uint32_t reserved;
+    uint64_t value;
+};
+static_assert(sizeof(EnumValue) == 16);
+
+}  // namespace unrealsdk::snapshot::format
+
+#endif /* UNREALSDK_SNAPSHOT_FORMAT_H */
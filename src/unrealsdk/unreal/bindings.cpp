@@ -0,0 +1,142 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/bindings.h"
+#include "unrealsdk/unreal/class_name.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/find_class.h"
+#include "unrealsdk/unreal/properties/zboolproperty.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unrealsdk.h"
+#include "unrealsdk/utils.h"
+
+namespace unrealsdk::unreal {
+
+namespace {
+
+/**
+ * @brief Checks a single field against the live property.
+ *
+ * @param field The expected layout.
+ * @param prop The live property.
+ * @return A description of the mismatch, or an empty string if the field matches.
+ */
+std::string check_field(const FieldLayout& field, const ZProperty* prop) {
+    auto type = prop->Class()->Name();
+    if (FName::find(field.type) != type) {
+        return std::format("expected {} but got {}", utils::narrow(field.type), type);
+    }
+    if (prop->Offset_Internal() != field.offset) {
+        return std::format("expected offset {:#x} but got {:#x}", field.offset,
+                           prop->Offset_Internal());
+    }
+    if (prop->ElementSize() != field.element_size) {
+        return std::format("expected element size {:#x} but got {:#x}", field.element_size,
+                           prop->ElementSize());
+    }
+    if (prop->ArrayDim() != field.array_dim) {
+        return std::format("expected array dim {} but got {}", field.array_dim, prop->ArrayDim());
+    }
+    if (type == cls_fname<ZBoolProperty>()) {
+        auto mask = static_cast<uint64_t>(validate_type<ZBoolProperty>(prop)->FieldMask());
+        if (mask != field.field_mask) {
+            return std::format("expected field mask {:#x} but got {:#x}", field.field_mask, mask);
+        }
+    }
+    return "";
+}
+
+/**
+ * @brief Finds the live version of a bound struct.
+ *
+ * @param layout The struct's expected location.
+ * @return The struct, or nullptr if it couldn't be found.
+ */
+const UStruct* find_struct(const StructLayout& layout) {
+    UObject* obj = nullptr;
+    try {
+        obj = find_object(layout.struct_class, layout.struct_path);
+    } catch (const std::invalid_argument&) {
+        // Thrown if the struct's class doesn't exist
+        return nullptr;
+    }
+
+    static const auto struct_cls = find_class<UStruct>();
+    if (obj == nullptr || !obj->is_instance(struct_cls)) {
+        return nullptr;
+    }
+    return reinterpret_cast<const UStruct*>(obj);
+}
+
+}  // namespace
+
+bool BindingSet::validate(void) {
+    this->enabled = false;
+    this->resolved_structs.clear();
+
+    size_t mismatches = 0;
+
+    for (const auto& layout : this->structs) {
+        auto ustruct = find_struct(layout);
+        if (ustruct == nullptr) {
+            mismatches++;
+            LOG(ERROR, "Couldn't find bound struct {}", utils::narrow(layout.struct_path));
+        }
+        this->resolved_structs.push_back(ustruct);
+    }
+
+    for (const auto& field : this->fields) {
+        if (field.struct_index >= this->resolved_structs.size()) {
+            mismatches++;
+            LOG(ERROR, "Binding {} has an invalid struct index", utils::narrow(field.name));
+            continue;
+        }
+
+        auto report = [&mismatches, this, &field](std::string_view reason) {
+            mismatches++;
+            LOG(ERROR, "Binding {}.{} doesn't match: {}",
+                utils::narrow(this->structs[field.struct_index].struct_path),
+                utils::narrow(field.name), reason);
+        };
+        const auto* ustruct = this->resolved_structs[field.struct_index];
+        if (ustruct == nullptr) {
+            // Already reported above
+            continue;
+        }
+
+        // Use find so that we never add new names - if the name doesn't exist, neither can the
+        // property
+        auto name = FName::find(field.name);
+        if (!name.has_value()) {
+            report("couldn't find property");
+            continue;
+        }
+
+        ZProperty* prop = nullptr;
+        try {
+            prop = ustruct->find_prop(*name);
+        } catch (const std::invalid_argument&) {
+            report("couldn't find property");
+            continue;
+        }
+
+        auto reason = check_field(field, prop);
+        if (!reason.empty()) {
+            report(reason);
+        }
+    }
+
+    if (mismatches > 0) {
+        LOG(ERROR, "Refusing to enable bindings, {} of {} structs and fields didn't match",
+            mismatches, this->structs.size() + this->fields.size());
+        return false;
+    }
+
+    LOG(MISC, "Validated {} bound fields", this->fields.size());
+    this->enabled = true;
+    return true;
+}
+
+}  // namespace unrealsdk::unreal
@@ -0,0 +1,274 @@
+#ifndef UNREALSDK_UNREAL_BINDINGS_H
+#define UNREALSDK_UNREAL_BINDINGS_H
+
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/properties/zboolproperty.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+
+/*
+Support code for statically generated bindings.
+
+The binding generator takes a reflection snapshot (see `unrealsdk/snapshot.h`), and emits a header
+containing typed accessors, which read fields directly at the offsets which were dumped - skipping
+name lookups, property searches, and type checks.
+
+Since these offsets are baked in at compile time, they're only valid on the same game build they
+were generated from. Each generated header hence also contains a `BindingSet`, describing the
+layout it expects, which must be validated against the live reflection data before any of the
+accessors may be used. If anything doesn't match, the bindings stay disabled, and the accessors
+throw, rather than silently reading garbage. Validation also resolves each bound struct, so that the
+accessors can check they're only ever used on instances of it.
+
+These checks cost a branch, plus walking the object's class hierarchy, on every access. For hot
+loops, each accessor also has an `_unchecked` variant, which reads the field directly. These may
+only be used once you've checked that the bindings are enabled, and that the object is of the right
+type, yourself - e.g. once before the loop.
+*/
+
+namespace unrealsdk::unreal {
+
+/**
+ * @brief The expected location of a struct used by a set of bindings.
+ */
+struct StructLayout {
+    // The name of the struct's class, and its full path name, used with `find_object`.
+    std::wstring_view struct_class;
+    std::wstring_view struct_path;
+};
+
+/**
+ * @brief The expected layout of a single field used by a set of bindings.
+ */
+struct FieldLayout {
+    // Index of the owning struct, in the binding set's structs.
+    size_t struct_index;
+
+    std::wstring_view name;
+    // The name of the property's class, e.g. "IntProperty".
+    std::wstring_view type;
+
+    int32_t offset;
+    int32_t element_size;
+    int32_t array_dim;
+    // Only checked for bool properties.
+    uint64_t field_mask;
+};
+
+class BindingSet {
+   private:
+    std::span<const StructLayout> structs;
+    std::span<const FieldLayout> fields;
+
+    // The live version of each struct, filled in by `validate`.
+    std::vector<const UStruct*> resolved_structs;
+    bool enabled = false;
+
+    /**
+     * @brief Gets the base address to read fields from, after checking the bindings are enabled,
+     *        and that the object is actually of the bound type.
+     * @note Throws a runtime error if the bindings are not enabled.
+     * @note Throws an invalid argument error if the object is null or of the wrong type.
+     *
+     * @param obj The object or struct holding the field.
+     * @param struct_index The index of the struct the field was bound on.
+     * @return The base address.
+     */
+    [[nodiscard]] uintptr_t base_of(const UObject* obj, size_t struct_index) const {
+        this->throw_if_disabled();
+        auto cls = reinterpret_cast<const UClass*>(this->resolved_structs[struct_index]);
+        if (obj == nullptr || !obj->is_instance(cls)) {
+            throw std::invalid_argument("Tried to use binding on an object of the wrong type");
+        }
+        return reinterpret_cast<uintptr_t>(obj);
+    }
+    [[nodiscard]] uintptr_t base_of(const WrappedStruct& obj, size_t struct_index) const {
+        this->throw_if_disabled();
+        if (obj.type == nullptr || obj.base.get() == nullptr
+            || !obj.type->inherits(this->resolved_structs[struct_index])) {
+            throw std::invalid_argument("Tried to use binding on a struct of the wrong type");
+        }
+        return reinterpret_cast<uintptr_t>(obj.base.get());
+    }
+
+    /**
+     * @brief Gets the base address to read fields from, without any checks.
+     *
+     * @param obj The object or struct holding the field.
+     * @return The base address.
+     */
+    [[nodiscard]] static uintptr_t unchecked_base_of(const UObject* obj) {
+        return reinterpret_cast<uintptr_t>(obj);
+    }
+    [[nodiscard]] static uintptr_t unchecked_base_of(const WrappedStruct& obj) {
+        return reinterpret_cast<uintptr_t>(obj.base.get());
+    }
+
+    /**
+     * @brief Throws a runtime error if the bindings are not enabled.
+     */
+    void throw_if_disabled(void) const {
+        if (!this->enabled) {
+            throw std::runtime_error("Tried to use bindings which haven't been validated");
+        }
+    }
+
+   public:
+    /**
+     * @brief Creates a new, disabled, binding set.
+     *
+     * @param structs The locations of all structs used by the bindings.
+     * @param fields The layouts of all fields used by the bindings. Fields should be grouped by
+     *               their owning struct.
+     */
+    BindingSet(std::span<const StructLayout> structs, std::span<const FieldLayout> fields)
+        : structs(structs), fields(fields) {}
+
+    /**
+     * @brief Validates every struct and field against the live reflection data, and enables the
+     *        bindings if they all match.
+     * @note Logs every mismatch found, not just the first.
+     * @note Never adds new names, so is safe to call with names which may not exist.
+     * @note Must be called after the sdk is initialized, and the relevant packages are loaded.
+     *
+     * @return True if the bindings are now enabled.
+     */
+    bool validate(void);
+
+    /**
+     * @brief Checks if the bindings have been successfully validated.
+     *
+     * @return True if the bindings may be used.
+     */
+    [[nodiscard]] bool is_enabled(void) const { return this->enabled; }
+
+    /**
+     * @brief Gets a reference to a field at a fixed offset.
+     * @note Throws a runtime error if the bindings are not enabled.
+     * @note Throws an invalid argument error if the object isn't an instance of the bound struct.
+     *
+     * @tparam T The type of the field.
+     * @param obj The object or struct holding the field.
+     * @param struct_index The index of the struct the field was bound on.
+     * @param offset The offset of the field.
+     * @return A reference to the field.
+     */
+    template <typename T>
+    [[nodiscard]] T& field(UObject* obj, size_t struct_index, int32_t offset) const {
+        return *reinterpret_cast<T*>(this->base_of(obj, struct_index) + offset);
+    }
+    template <typename T>
+    [[nodiscard]] const T& field(const UObject* obj, size_t struct_index, int32_t offset) const {
+        return *reinterpret_cast<const T*>(this->base_of(obj, struct_index) + offset);
+    }
+    template <typename T>
+    [[nodiscard]] T& field(WrappedStruct& obj, size_t struct_index, int32_t offset) const {
+        return *reinterpret_cast<T*>(this->base_of(obj, struct_index) + offset);
+    }
+    template <typename T>
+    [[nodiscard]] const T& field(const WrappedStruct& obj,
+                                 size_t struct_index,
+                                 int32_t offset) const {
+        return *reinterpret_cast<const T*>(this->base_of(obj, struct_index) + offset);
+    }
+
+    /**
+     * @brief Gets a reference to a field at a fixed offset, without checking the bindings are
+     *        enabled, or that the object is of the bound type.
+     * @note Intended for hot paths, after the caller has already checked both of these.
+     *
+     * @tparam T The type of the field.
+     * @param obj The object or struct holding the field.
+     * @param offset The offset of the field.
+     * @return A reference to the field.
+     */
+    template <typename T>
+    [[nodiscard]] static T& field_unchecked(UObject* obj, int32_t offset) {
+        return *reinterpret_cast<T*>(unchecked_base_of(obj) + offset);
+    }
+    template <typename T>
+    [[nodiscard]] static const T& field_unchecked(const UObject* obj, int32_t offset) {
+        return *reinterpret_cast<const T*>(unchecked_base_of(obj) + offset);
+    }
+    template <typename T>
+    [[nodiscard]] static T& field_unchecked(WrappedStruct& obj, int32_t offset) {
+        return *reinterpret_cast<T*>(unchecked_base_of(obj) + offset);
+    }
+    template <typename T>
+    [[nodiscard]] static const T& field_unchecked(const WrappedStruct& obj, int32_t offset) {
+        return *reinterpret_cast<const T*>(unchecked_base_of(obj) + offset);
+    }
+
+    /**
+     * @brief Gets or sets a bool field at a fixed offset.
+     * @note Throws a runtime error if the bindings are not enabled.
+     * @note Throws an invalid argument error if the object isn't an instance of the bound struct.
+     *
+     * @tparam Base The type of the object or struct holding the field.
+     * @param obj The object or struct holding the field.
+     * @param struct_index The index of the struct the field was bound on.
+     * @param offset The offset of the field's bitfield.
+     * @param mask The field's mask within the bitfield.
+     * @param value The value to set.
+     * @return The field's value.
+     */
+    template <typename Base>
+    [[nodiscard]] bool get_bool(const Base& obj,
+                                size_t struct_index,
+                                int32_t offset,
+                                ZBoolProperty::field_mask_type mask) const {
+        return (this->field<ZBoolProperty::field_mask_type>(obj, struct_index, offset) & mask)
+               != 0;
+    }
+    template <typename Base>
+    void set_bool(Base& obj,
+                  size_t struct_index,
+                  int32_t offset,
+                  ZBoolProperty::field_mask_type mask,
+                  bool value) const {
+        auto& bitfield = this->field<ZBoolProperty::field_mask_type>(obj, struct_index, offset);
+        if (value) {
+            bitfield |= mask;
+        } else {
+            bitfield &= ~mask;
+        }
+    }
+
+    /**
+     * @brief Gets or sets a bool field at a fixed offset, without checking the bindings are
+     *        enabled, or that the object is of the bound type.
+     * @note Intended for hot paths, after the caller has already checked both of these.
+     *
+     * @tparam Base The type of the object or struct holding the field.
+     * @param obj The object or struct holding the field.
+     * @param offset The offset of the field's bitfield.
+     * @param mask The field's mask within the bitfield.
+     * @param value The value to set.
+     * @return The field's value.
+     */
+    template <typename Base>
+    [[nodiscard]] static bool get_bool_unchecked(const Base& obj,
+                                                 int32_t offset,
+                                                 ZBoolProperty::field_mask_type mask) {
+        return (field_unchecked<ZBoolProperty::field_mask_type>(obj, offset) & mask) != 0;
+    }
+    template <typename Base>
+    static void set_bool_unchecked(Base& obj,
+                                   int32_t offset,
+                                   ZBoolProperty::field_mask_type mask,
+                                   bool value) {
+        auto& bitfield = field_unchecked<ZBoolProperty::field_mask_type>(obj, offset);
+        if (value) {
+            bitfield |= mask;
+        } else {
+            bitfield &= ~mask;
+        }
+    }
+};
+
+}  // namespace unrealsdk::unreal
+
+#endif /* UNREALSDK_UNREAL_BINDINGS_H */
@@ -1,5 +1,6 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/unreal/classes/uenum.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/game/bl2/offsets.h"
 #include "unrealsdk/game/bl3/offsets.h"
 #include "unrealsdk/unreal/offset_list.h"
@@ -11,11 +12,98 @@ namespace unrealsdk::unreal {
 
 UNREALSDK_DEFINE_FIELDS_SOURCE_FILE(UEnum, UNREALSDK_UENUM_FIELDS);
 
-#if UNREALSDK_ENUM_FORMAT == UNREALSDK_ENUM_FORMAT_UE4
+namespace {
+
+/*
+Looking up enum names and values is a hot path, and may happen on many threads at once, so much like
+the flattened struct lists, reading the cached tables must be lock free. We keep a side table
+indexed by the enum's InternalIndex, split into lazily allocated chunks, where each entry points at
+the latest table built for that index. Each table records a stamp of the enum it was built from,
+which confirms it's still for the same enum - the gc generation catches the enum being destroyed and
+something else being allocated in the same slot, the names array catches it being modified. The
+mutex is only ever taken while building.
+*/
+
+/// Cached lookup tables for a single enum. Immutable once built.
+struct EnumTable {
+    // What the enum looked like when we built this table, to detect changes
+    const UEnum* uenum;
+    const void* names_data;
+    size_t names_count;
+    uint32_t generation;
+
+    std::unordered_map<FName, uint64_t> names;
+    // Sorted by value, and deduplicated, keeping the first name for each value
+    std::vector<std::pair<uint64_t, FName>> values;
+    // If the values are exactly 0 to n-1, in which case we can index directly
+    bool values_are_indexes;
+};
+
+const constexpr size_t ENUM_CHUNK_SIZE = 0x10000;
+const constexpr size_t ENUM_MAX_CHUNKS = gc::MAX_TRACKED_GENERATIONS / ENUM_CHUNK_SIZE;
+
+using EnumChunk = std::array<std::atomic<const EnumTable*>, ENUM_CHUNK_SIZE>;
+std::array<std::atomic<EnumChunk*>, ENUM_MAX_CHUNKS> enum_tables{};
+
+std::mutex enum_tables_mutex{};
+// Owns every table we've ever built. If an enum gets modified we need to rebuild it's table, but we
+// want references to the old one to stay valid, so we never free them. This should basically never
+// happen.
+std::vector<std::unique_ptr<const EnumTable>> all_enum_tables{};
+// Enums with indexes past the end of the side table, only accessed under the mutex.
+std::unordered_map<const UEnum*, const EnumTable*> overflow_enum_tables{};
+
+/**
+ * @brief Gets the entry in the side table for the given index, allocating it if needed.
+ *
+ * @param idx The enum's InternalIndex.
+ * @return A pointer to the entry, or nullptr if the index is out of range.
+ */
+std::atomic<const EnumTable*>* get_enum_entry(size_t idx) {
+    auto chunk_idx = idx / ENUM_CHUNK_SIZE;
+    if (chunk_idx >= ENUM_MAX_CHUNKS) {
+        return nullptr;
+    }
+
+    auto& chunk_ptr = enum_tables.at(chunk_idx);
+    auto chunk = chunk_ptr.load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        auto new_chunk = std::make_unique<EnumChunk>();
+        if (chunk_ptr.compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel)) {
+            chunk = new_chunk.release();
+        }
+        // Otherwise another thread beat us to it, and chunk has been set to theirs
+    }
+
+    return &chunk->at(idx % ENUM_CHUNK_SIZE);
+}
 
-std::unordered_map<FName, uint64_t> UEnum::get_names(void) const {
-    std::unordered_map<FName, uint64_t> output;
-    auto names = this->Names();
+/**
+ * @brief Checks if a table is still up to date for the given enum.
+ *
+ * @param table The table.
+ * @param uenum The enum to check against.
+ * @return True if the table may be used.
+ */
+bool is_current(const EnumTable& table, const UEnum* uenum) {
+    auto names = uenum->Names();
+    return table.uenum == uenum && table.names_data == names.data
+           && table.names_count == names.size()
+           && table.generation == gc::generation(static_cast<size_t>(uenum->InternalIndex()));
+}
+
+/**
+ * @brief Gets the raw name and value of each enum entry, in the order they're stored.
+ *
+ * @param uenum The enum to read.
+ * @return A list of name-value pairs.
+ */
+std::vector<std::pair<FName, uint64_t>> read_enum_entries(const UEnum* uenum) {
+    std::vector<std::pair<FName, uint64_t>> entries{};
+
+#if UNREALSDK_ENUM_FORMAT == UNREALSDK_ENUM_FORMAT_UE4
+    auto names = uenum->Names();
+    entries.reserve(names.size());
     for (size_t i = 0; i < names.size(); i++) {
         auto pair = names.at(i);
 
@@ -24,26 +112,126 @@ std::unordered_map<FName, uint64_t> UEnum::get_names(void) const {
         const std::wstring str_key{pair.key};
         auto after_colons = str_key.find_first_not_of(L':', str_key.find_first_of(L':'));
 
-        output.emplace(after_colons == std::string::npos ? pair.key : str_key.substr(after_colons),
-                       pair.value);
+        entries.emplace_back(
+            after_colons == std::string::npos ? pair.key : FName{str_key.substr(after_colons)},
+            pair.value);
     }
-    return output;
-}
 
 #elif UNREALSDK_ENUM_FORMAT == UNREALSDK_ENUM_FORMAT_UE3
-
-std::unordered_map<FName, uint64_t> UEnum::get_names(void) const {
-    std::unordered_map<FName, uint64_t> output;
-    auto names = this->Names();
+    auto names = uenum->Names();
+    entries.reserve(names.size());
     for (size_t i = 0; i < names.size(); i++) {
         // Willow enums just use the raw name, and are always stored in order
-        output.emplace(names.at(i), i);
+        entries.emplace_back(names.at(i), i);
     }
-    return output;
-}
 
 #else
 #error Unknown SDK flavour
 #endif
 
+    return entries;
+}
+
+/**
+ * @brief Builds the lookup tables for an enum.
+ *
+ * @param uenum The enum to build tables for.
+ * @return The new tables.
+ */
+std::unique_ptr<const EnumTable> build_enum_table(const UEnum* uenum) {
+    auto entries = read_enum_entries(uenum);
+
+    auto table = std::make_unique<EnumTable>();
+    table->uenum = uenum;
+    table->names_data = uenum->Names().data;
+    table->names_count = uenum->Names().size();
+    table->generation = gc::generation(static_cast<size_t>(uenum->InternalIndex()));
+
+    table->names.reserve(entries.size());
+    table->values.reserve(entries.size());
+    for (const auto& [name, value] : entries) {
+        table->names.emplace(name, value);
+        table->values.emplace_back(value, name);
+    }
+
+    std::ranges::stable_sort(table->values, {}, &std::pair<uint64_t, FName>::first);
+    auto duplicates = std::ranges::unique(table->values, {}, &std::pair<uint64_t, FName>::first);
+    table->values.erase(duplicates.begin(), duplicates.end());
+    table->values.shrink_to_fit();
+
+    // Since the values are sorted and unique, they're all indexes if the last one is
+    table->values_are_indexes =
+        table->values.empty() || table->values.back().first == table->values.size() - 1;
+
+    return table;
+}
+
+/**
+ * @brief Gets the lookup tables for an enum, building them if needed.
+ *
+ * @param uenum The enum to get tables for.
+ * @return The enum's tables.
+ */
+const EnumTable& get_enum_table(const UEnum* uenum) {
+    auto* entry = get_enum_entry(static_cast<size_t>(uenum->InternalIndex()));
+    if (entry != nullptr) {
+        const auto* table = entry->load(std::memory_order_acquire);
+        if (table != nullptr && is_current(*table, uenum)) {
+            return *table;
+        }
+    }
+
+    const std::scoped_lock lock(enum_tables_mutex);
+
+    // Check again, another thread may have rebuilt it while we were waiting on the lock
+    const auto* existing = entry != nullptr ? entry->load(std::memory_order_acquire)
+                                            : overflow_enum_tables[uenum];
+    if (existing != nullptr && is_current(*existing, uenum)) {
+        return *existing;
+    }
+
+    // If there was an existing table, it's now retired - but it stays in the list of all tables, so
+    // that any references to it remain valid
+    const auto* table = all_enum_tables.emplace_back(build_enum_table(uenum)).get();
+    if (entry != nullptr) {
+        entry->store(table, std::memory_order_release);
+    } else {
+        overflow_enum_tables[uenum] = table;
+    }
+    return *table;
+}
+
+}  // namespace
+
+const std::unordered_map<FName, uint64_t>& UEnum::get_names(void) const {
+    return get_enum_table(this).names;
+}
+
+std::optional<uint64_t> UEnum::lookup(const FName& name) const {
+    const auto& names = get_enum_table(this).names;
+    auto iter = names.find(name);
+    if (iter == names.end()) {
+        return std::nullopt;
+    }
+    return iter->second;
+}
+
+std::optional<FName> UEnum::name_of(uint64_t value) const {
+    const auto& table = get_enum_table(this);
+
+    if (table.values_are_indexes) {
+        if (value >= table.values.size()) {
+            return std::nullopt;
+        }
+        return table.values[value].second;
+    }
+
+    auto iter = std::ranges::lower_bound(table.values, value, {},
+                                         &std::pair<uint64_t, FName>::first);
+    if (iter == table.values.end() || iter->first != value) {
+        return std::nullopt;
+    }
+    return iter->second;
+}
+
 }  // namespace unrealsdk::unreal
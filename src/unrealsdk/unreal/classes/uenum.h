@@ -35,12 +35,31 @@ class UEnum : public UField {
     UNREALSDK_DEFINE_FIELDS_HEADER(UEnum, UNREALSDK_UENUM_FIELDS);
 
     /**
-     * @brief Converts the enum names into a more usable name to value map.
+     * @brief Gets a map of the enum's names to their values.
      * @note Keys are always the raw enum names, rather than `MyEnum::Entry` it's always `Entry`.
+     * @note Built once on first use and then cached, so the reference is always safe to hold on to.
      *
      * @return A map of names to their associated integer values.
      */
-    [[nodiscard]] std::unordered_map<FName, uint64_t> get_names(void) const;
+    [[nodiscard]] const std::unordered_map<FName, uint64_t>& get_names(void) const;
+
+    /**
+     * @brief Looks up the value of one of the enum's names.
+     * @note Uses the same raw names as `get_names`.
+     *
+     * @param name The name to look up.
+     * @return The associated value, or std::nullopt if the name isn't part of this enum.
+     */
+    [[nodiscard]] std::optional<uint64_t> lookup(const FName& name) const;
+
+    /**
+     * @brief Looks up the name associated with an enum value.
+     * @note If multiple names share the same value, returns the first one.
+     *
+     * @param value The value to look up.
+     * @return The associated name, or std::nullopt if the value isn't part of this enum.
+     */
+    [[nodiscard]] std::optional<FName> name_of(uint64_t value) const;
 };
 
 template <>
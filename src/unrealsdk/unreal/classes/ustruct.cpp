@@ -1,6 +1,7 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/unreal/classes/ustruct.h"
 #include "unrealsdk/config.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/game/bl3/offsets.h"
 #include "unrealsdk/game/bl4/offsets.h"
 #include "unrealsdk/unreal/class_name.h"
@@ -18,138 +19,291 @@ namespace unrealsdk::unreal {
 
 UNREALSDK_DEFINE_FIELDS_SOURCE_FILE(UStruct, UNREALSDK_USTRUCT_FIELDS);
 
-#pragma region Field Iterator
+#pragma region Flattened Lists
+
+namespace {
+
+/*
+A struct's fields and properties are both stored as linked lists, scattered across the heap, which
+we'd otherwise have to walk (and on FField builds, filter down to just properties) every time we
+iterate them. Since layouts basically never change once loaded, we instead flatten each struct's
+lists into arrays the first time they're used, and cache them.
+
+We do still need to handle structs being destroyed and something else being allocated in the same
+place, or structs being modified after we cached them (e.g. the mock hook does while building it's
+objects). To detect this, we record a stamp of the fields which would change, on the struct and on
+each of it's supers (since we include their fields too), and rebuild the arrays if any don't match.
+Iterators point into the old arrays, so much like enum tables, we can't free them when this happens,
+we just retire them.
+
+Iterating is a hot path, and may happen on many threads at once, so reading the cache must be lock
+free. Much like the hook manager's checked functions table, we keep a side table indexed by the
+struct's InternalIndex, split into lazily allocated chunks. Each entry points at the latest arrays
+built for that index, which the stamp then confirms are for the same struct. The mutex is only ever
+taken while building.
+
+Walking the whole super chain to compare every stamp would make each lookup linear in the depth of
+the hierarchy, so we normally only compare the struct's own stamp. The supers can only change
+without their own struct being destroyed (which the generations already catch) in rare cases like
+the mock hook, so we rely on the gc epoch to cover them - each flattened struct records the epoch at
+which it's chain was last fully checked, and while that's still current, we skip the walk. While
+not tracking destroyed objects, the epoch never changes, so we always walk the full chain.
+*/
+
+struct StructStamp {
+    const UStruct* ustruct;
+    const UStruct* super;
+    const UField* children;
+    const void* properties;
+    size_t property_size;
+    uint32_t generation;
+
+    bool operator==(const StructStamp& other) const = default;
+};
 
-UStruct::FieldIterator::FieldIterator(void) : this_struct(nullptr), field(nullptr) {}
-UStruct::FieldIterator::FieldIterator(const UStruct* this_struct, UField* field)
-    : this_struct(this_struct), field(field) {}
+const constexpr uint64_t NOT_VERIFIED = std::numeric_limits<uint64_t>::max();
 
-UStruct::FieldIterator::reference UStruct::FieldIterator::operator*() const {
-    return this->field;
-}
+struct FlatStruct {
+    // The stamps of the struct, then each of it's supers in order.
+    std::vector<StructStamp> stamps;
+    std::vector<UField*> fields;
+    std::vector<ZProperty*> properties;
 
-UStruct::FieldIterator& UStruct::FieldIterator::operator++() {
-    if (this->field != nullptr) {
-        this->field = this->field->Next();
+    // The gc epoch at which every stamp was last confirmed to match. The only part which isn't
+    // immutable once built, so updating it doesn't need the mutex.
+    mutable std::atomic<uint64_t> verified_epoch = NOT_VERIFIED;
+};
+
+const constexpr size_t FLAT_CHUNK_SIZE = 0x10000;
+const constexpr size_t FLAT_MAX_CHUNKS = gc::MAX_TRACKED_GENERATIONS / FLAT_CHUNK_SIZE;
+
+using FlatChunk = std::array<std::atomic<const FlatStruct*>, FLAT_CHUNK_SIZE>;
+std::array<std::atomic<FlatChunk*>, FLAT_MAX_CHUNKS> flat_structs{};
+
+std::mutex flat_structs_mutex{};
+// Owns every set of arrays we've ever built, including retired ones.
+std::vector<std::unique_ptr<const FlatStruct>> all_flat_structs{};
+// Structs with indexes past the end of the side table, only accessed under the mutex.
+std::unordered_map<const UStruct*, const FlatStruct*> overflow_flat_structs{};
+
+/**
+ * @brief Gets the entry in the side table for the given index, allocating it if needed.
+ *
+ * @param idx The struct's InternalIndex.
+ * @return A pointer to the entry, or nullptr if the index is out of range.
+ */
+std::atomic<const FlatStruct*>* get_flat_entry(size_t idx) {
+    auto chunk_idx = idx / FLAT_CHUNK_SIZE;
+    if (chunk_idx >= FLAT_MAX_CHUNKS) {
+        return nullptr;
     }
-    while (this->field == nullptr && this->this_struct != nullptr) {
-        this->this_struct = this->this_struct->SuperField();
 
-        if (this->this_struct != nullptr) {
-            this->field = this->this_struct->Children();
+    auto& chunk_ptr = flat_structs.at(chunk_idx);
+    auto chunk = chunk_ptr.load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        auto new_chunk = std::make_unique<FlatChunk>();
+        if (chunk_ptr.compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel)) {
+            chunk = new_chunk.release();
         }
+        // Otherwise another thread beat us to it, and chunk has been set to theirs
     }
 
-    return *this;
+    return &chunk->at(idx % FLAT_CHUNK_SIZE);
 }
-UStruct::FieldIterator UStruct::FieldIterator::operator++(int) {
-    auto tmp = *this;
-    ++(*this);
-    return tmp;
+
+/**
+ * @brief Gets the current stamp of a struct.
+ *
+ * @param ustruct The struct to get the stamp of.
+ * @return The struct's stamp.
+ */
+StructStamp get_stamp(const UStruct* ustruct) {
+    return {
+        .ustruct = ustruct,
+        .super = ustruct->SuperField(),
+        .children = ustruct->Children(),
+#if UNREALSDK_USTRUCT_PROPERTY_ITER == UNREALSDK_USTRUCT_PROPERTY_ITER_CHILDPROPERTIES
+        .properties = ustruct->ChildProperties(),
+#elif UNREALSDK_USTRUCT_PROPERTY_ITER == UNREALSDK_USTRUCT_PROPERTY_ITER_PROPERTYLINK
+        .properties = ustruct->PropertyLink(),
+#else
+#error Unknown UStruct::properties() iterator type
+#endif
+        .property_size = ustruct->PropertySize(),
+        .generation = gc::generation(static_cast<size_t>(ustruct->InternalIndex())),
+    };
 }
 
-bool UStruct::FieldIterator::operator==(const UStruct::FieldIterator& rhs) const {
-    return this->this_struct == rhs.this_struct && this->field == rhs.field;
-};
-bool UStruct::FieldIterator::operator!=(const UStruct::FieldIterator& rhs) const {
-    return !(*this == rhs);
-};
+/**
+ * @brief Checks if a set of flattened arrays are still up to date for the given struct.
+ *
+ * @param flat The flattened struct.
+ * @param ustruct The struct to check against.
+ * @return True if the arrays may be used.
+ */
+bool is_current(const FlatStruct& flat, const UStruct* ustruct) {
+    if (flat.stamps.empty() || flat.stamps.front() != get_stamp(ustruct)) {
+        return false;
+    }
 
-utils::IteratorProxy<UStruct::FieldIterator> UStruct::fields(void) const {
-    FieldIterator begin{this, this->Children()};
+    // If nothing's been destroyed since we last checked the whole chain, the supers are still fine
+    auto epoch = gc::epoch();
+    if (flat.verified_epoch.load(std::memory_order_acquire) == epoch) {
+        return true;
+    }
 
-    // If we start out pointing at null (because this struct has no direct children), increment once
-    //  to find the actual first field
-    if (*begin == nullptr) {
-        begin++;
+    auto stamp = flat.stamps.begin();
+    for (const auto* current : ustruct->superfields()) {
+        if (stamp == flat.stamps.end() || *stamp != get_stamp(current)) {
+            return false;
+        }
+        stamp++;
+    }
+    if (stamp != flat.stamps.end()) {
+        return false;
     }
 
-    return {begin, {}};
+    // Since we read the epoch before walking, if something was destroyed mid walk, the next call
+    // will just walk again
+    if (gc::is_tracking()) {
+        flat.verified_epoch.store(epoch, std::memory_order_release);
+    }
+    return true;
 }
 
-#pragma endregion
-
-#pragma region Property Iterator
+/**
+ * @brief Flattens a struct's fields and properties.
+ *
+ * @param ustruct The struct to flatten.
+ * @return The flattened struct.
+ */
+std::unique_ptr<const FlatStruct> flatten(const UStruct* ustruct) {
+    auto flat = std::make_unique<FlatStruct>();
+    auto epoch = gc::epoch();
+
+    for (const auto* current : ustruct->superfields()) {
+        flat->stamps.push_back(get_stamp(current));
+        for (auto field = current->Children(); field != nullptr; field = field->Next()) {
+            flat->fields.push_back(field);
+        }
+    }
 
 #if UNREALSDK_USTRUCT_PROPERTY_ITER == UNREALSDK_USTRUCT_PROPERTY_ITER_CHILDPROPERTIES
-// Follow the ChildProperties->Next->Next linked list
-// This is split by struct, so this is very similar to the above implementation
-
-UStruct::PropertyIterator::PropertyIterator(void) : this_struct(nullptr), field(nullptr) {}
-UStruct::PropertyIterator::PropertyIterator(const UStruct* this_struct, FField* field)
-    : this_struct(this_struct), field(field) {}
-
-UStruct::PropertyIterator::reference UStruct::PropertyIterator::operator*() const {
-    // Trust that the increment keeps this valid
-    return reinterpret_cast<ZProperty*>(this->field);
-}
-
-UStruct::PropertyIterator& UStruct::PropertyIterator::operator++() {
+    // Follow the ChildProperties->Next->Next linked list
+    // This is split by struct, and may contain non-property fields, which we need to skip over
     auto uprop_cls = find_class<ZProperty>();
+    for (const auto* current : ustruct->superfields()) {
+        for (auto field = current->ChildProperties(); field != nullptr; field = field->Next()) {
+            if (field->Class()->inherits(uprop_cls)) {
+                flat->properties.push_back(reinterpret_cast<ZProperty*>(field));
+            }
+        }
+    }
+#elif UNREALSDK_USTRUCT_PROPERTY_ITER == UNREALSDK_USTRUCT_PROPERTY_ITER_PROPERTYLINK
+    // Follow the PropertyLink->PropertyLinkNext->PropertyLinkNext linked list
+    // This already includes base classes
+    for (auto prop = ustruct->PropertyLink(); prop != nullptr; prop = prop->PropertyLinkNext()) {
+        flat->properties.push_back(prop);
+    }
+#else
+#error Unknown UStruct::properties() iterator type
+#endif
 
-    if (this->field != nullptr) {
-        do {
-            this->field = this->field->Next();
-            // If we got a field that's not a property, try again
-        } while (this->field != nullptr && !this->field->Class()->inherits(uprop_cls));
+    flat->stamps.shrink_to_fit();
+    flat->fields.shrink_to_fit();
+    flat->properties.shrink_to_fit();
+    if (gc::is_tracking()) {
+        flat->verified_epoch.store(epoch, std::memory_order_relaxed);
     }
+    return flat;
+}
 
-    while (this->field == nullptr && this->this_struct != nullptr) {
-        // Ran out of fields, try the next struct
-        this->this_struct = this->this_struct->SuperField();
-        if (this->this_struct == nullptr) {
-            break;
+/**
+ * @brief Gets the flattened lists of a struct, building them if needed.
+ *
+ * @param ustruct The struct to get the lists of.
+ * @return The flattened struct.
+ */
+const FlatStruct& get_flat_struct(const UStruct* ustruct) {
+    auto entry = get_flat_entry(static_cast<size_t>(ustruct->InternalIndex()));
+    if (entry != nullptr) {
+        const auto* flat = entry->load(std::memory_order_acquire);
+        if (flat != nullptr && is_current(*flat, ustruct)) {
+            return *flat;
         }
+    }
 
-        this->field = this->this_struct->ChildProperties();
+    const std::scoped_lock lock(flat_structs_mutex);
 
-        // If we got a field that's not a property, try again
-        while (this->field != nullptr && !this->field->Class()->inherits(uprop_cls)) {
-            this->field = this->field->Next();
-        }
+    // Check again, another thread may have rebuilt it while we were waiting on the lock
+    const auto* existing = entry != nullptr ? entry->load(std::memory_order_acquire)
+                                            : overflow_flat_structs[ustruct];
+    if (existing != nullptr && is_current(*existing, ustruct)) {
+        return *existing;
+    }
+
+    // If there was an existing entry, it's now retired - but it stays in the list of all structs,
+    // so that any iterators still pointing into it remain valid
+    const auto* flat = all_flat_structs.emplace_back(flatten(ustruct)).get();
+    if (entry != nullptr) {
+        entry->store(flat, std::memory_order_release);
+    } else {
+        overflow_flat_structs[ustruct] = flat;
     }
+    return *flat;
+}
+
+}  // namespace
+
+#pragma endregion
+
+#pragma region Field Iterator
+
+UStruct::FieldIterator::FieldIterator(void) : field(nullptr) {}
+UStruct::FieldIterator::FieldIterator(UField* const* field) : field(field) {}
+
+UStruct::FieldIterator::reference UStruct::FieldIterator::operator*() const {
+    return *this->field;
+}
 
+UStruct::FieldIterator& UStruct::FieldIterator::operator++() {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    this->field++;
     return *this;
 }
-UStruct::PropertyIterator UStruct::PropertyIterator::operator++(int) {
+UStruct::FieldIterator UStruct::FieldIterator::operator++(int) {
     auto tmp = *this;
     ++(*this);
     return tmp;
 }
 
-bool UStruct::PropertyIterator::operator==(const UStruct::PropertyIterator& rhs) const {
-    return this->this_struct == rhs.this_struct && this->field == rhs.field;
+bool UStruct::FieldIterator::operator==(const UStruct::FieldIterator& rhs) const {
+    return this->field == rhs.field;
 };
-bool UStruct::PropertyIterator::operator!=(const UStruct::PropertyIterator& rhs) const {
+bool UStruct::FieldIterator::operator!=(const UStruct::FieldIterator& rhs) const {
     return !(*this == rhs);
 };
 
-utils::IteratorProxy<UStruct::PropertyIterator> UStruct::properties(void) const {
-    PropertyIterator begin{this, this->ChildProperties()};
-
-    // Like in the previous one, a null first property is still wrong, and needs to be incremented
-    // once, but now so is a non-property type
-    ZProperty* first = *begin;
-    if (first == nullptr || !first->Class()->inherits(find_class<ZProperty>())) {
-        begin++;
-    }
-
-    return {begin, {}};
+utils::IteratorProxy<UStruct::FieldIterator> UStruct::fields(void) const {
+    const auto& fields = get_flat_struct(this).fields;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return {{fields.data()}, {fields.data() + fields.size()}};
 }
 
-#elif UNREALSDK_USTRUCT_PROPERTY_ITER == UNREALSDK_USTRUCT_PROPERTY_ITER_PROPERTYLINK
-// Follow the PropertyLink->PropertyLinkNext->PropertyLinkNext linked list
-// This includes base classes so has a much simpler implementation
+#pragma endregion
+
+#pragma region Property Iterator
 
 UStruct::PropertyIterator::PropertyIterator(void) : prop(nullptr) {}
-UStruct::PropertyIterator::PropertyIterator(ZProperty* prop) : prop(prop) {}
+UStruct::PropertyIterator::PropertyIterator(ZProperty* const* prop) : prop(prop) {}
 
 UStruct::PropertyIterator::reference UStruct::PropertyIterator::operator*() const {
-    return prop;
+    return *this->prop;
 }
 
 UStruct::PropertyIterator& UStruct::PropertyIterator::operator++() {
-    prop = prop->PropertyLinkNext();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    this->prop++;
     return *this;
 }
 UStruct::PropertyIterator UStruct::PropertyIterator::operator++(int) {
@@ -166,13 +320,11 @@ bool UStruct::PropertyIterator::operator!=(const UStruct::PropertyIterator& rhs)
 };
 
 utils::IteratorProxy<UStruct::PropertyIterator> UStruct::properties(void) const {
-    return {{this->PropertyLink()}, {}};
+    const auto& properties = get_flat_struct(this).properties;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return {{properties.data()}, {properties.data() + properties.size()}};
 }
 
-#else
-#error Unknown UStruct::properties() iterator type
-#endif
-
 #pragma endregion
 
 #pragma region SuperField Iterator
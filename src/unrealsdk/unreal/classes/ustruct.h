@@ -50,6 +50,9 @@ class UStruct : public UField {
     UNREALSDK_DEFINE_FIELDS_HEADER(UStruct, UNREALSDK_USTRUCT_FIELDS);
 
 #pragma region Iterators
+    // Both of these walk a flattened copy of the relevant linked lists, which gets built on first
+    // use, and is then cached. See `ustruct.cpp` for how they're kept up to date.
+
     struct FieldIterator {
         using iterator_category = std::forward_iterator_tag;
         using difference_type = std::ptrdiff_t;
@@ -60,10 +63,9 @@ class UStruct : public UField {
         friend class UStruct;
 
        private:
-        const UStruct* this_struct;
-        UField* field;
+        UField* const* field;
 
-        FieldIterator(const UStruct* this_struct, UField* field);
+        FieldIterator(UField* const* field);
 
        public:
         FieldIterator(void);
@@ -87,18 +89,9 @@ class UStruct : public UField {
         friend class UStruct;
 
        private:
-#if UNREALSDK_USTRUCT_PROPERTY_ITER == UNREALSDK_USTRUCT_PROPERTY_ITER_PROPERTYLINK
-        ZProperty* prop;
-
-        PropertyIterator(ZProperty* prop);
-#elif UNREALSDK_USTRUCT_PROPERTY_ITER == UNREALSDK_USTRUCT_PROPERTY_ITER_CHILDPROPERTIES
-        const UStruct* this_struct;
-        FField* field;
+        ZProperty* const* prop;
 
-        PropertyIterator(const UStruct* this_struct, FField* field);
-#else
-#error Unknown UStruct::properties() iterator type
-#endif
+        PropertyIterator(ZProperty* const* prop);
 
        public:
         PropertyIterator(void);
@@ -140,6 +133,7 @@ class UStruct : public UField {
 
     /**
      * @brief Gets an iterator over this struct's fields.
+     * @note Includes inherited fields, after this struct's own.
      *
      * @return The iterator.
      */
@@ -147,6 +141,7 @@ class UStruct : public UField {
 
     /**
      * @brief Gets an iterator over this struct's properties.
+     * @note Includes inherited properties, after this struct's own.
      *
      * @return The iterator.
      */
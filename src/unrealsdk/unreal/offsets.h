@@ -46,6 +46,18 @@ using offset_type = uint16_t;
 #define UNREALSDK_OFFSETS__PURE_FUNC_ATTR __attribute__((pure))
 #endif
 
+#ifdef UNREALSDK_STATIC_OFFSETS
+// When binding offsets at compile time, the getter is defined in `static_offsets.h`, once all the
+// game specific types are available, so that every field access becomes a constant offset
+#define UNREALSDK_OFFSETS__DECLARE_GET                            \
+    static constexpr unrealsdk::unreal::offsets::offset_type get( \
+        unrealsdk::unreal::offsets::offset_type Offsets::* field);
+#else
+#define UNREALSDK_OFFSETS__DECLARE_GET                                                    \
+    static UNREALSDK_OFFSETS__PURE_FUNC_ATTR unrealsdk::unreal::offsets::offset_type get( \
+        unrealsdk::unreal::offsets::offset_type Offsets::* field);
+#endif
+
 /**
  * @brief Header file macro to defines all the machinery for variable offset fields.
  * @note Should be placed within the class definition.
@@ -53,23 +65,22 @@ using offset_type = uint16_t;
  * @param ClassName The name of the class these fields are being defined for.
  * @param X_MACRO An X macro list of the fields to define. See the example below.
  */
-#define UNREALSDK_DEFINE_FIELDS_HEADER(ClassName, X_MACRO)                                    \
-   public:                                                                                    \
-    struct Offsets;                                                                           \
-    /* NOLINTNEXTLINE(readability-identifier-naming) */                                       \
-    X_MACRO(UNREALSDK_OFFSETS__DEFINE_GETTER)                                                 \
-    struct Offsets {                                                                          \
-        /* NOLINTNEXTLINE(readability-identifier-naming) */                                   \
-        X_MACRO(UNREALSDK_OFFSETS__DEFINE_OFFSET_MEMBERS)                                     \
-        template <typename T>                                                                 \
-        static constexpr Offsets from() {                                                     \
-            UNREALSDK_OFFSETS__OFFSETOF_PRAGMA_PUSH                                           \
-            X_MACRO(UNREALSDK_OFFSETS__OFFSETOF_ASSERTS);                                     \
-            return {X_MACRO(UNREALSDK_OFFSETS__OFFSETOF)};                                    \
-            UNREALSDK_OFFSETS__OFFSETOF_PRAGMA_POP                                            \
-        }                                                                                     \
-        static UNREALSDK_OFFSETS__PURE_FUNC_ATTR unrealsdk::unreal::offsets::offset_type get( \
-            unrealsdk::unreal::offsets::offset_type Offsets::* field);                        \
+#define UNREALSDK_DEFINE_FIELDS_HEADER(ClassName, X_MACRO)  \
+   public:                                                  \
+    struct Offsets;                                         \
+    /* NOLINTNEXTLINE(readability-identifier-naming) */     \
+    X_MACRO(UNREALSDK_OFFSETS__DEFINE_GETTER)               \
+    struct Offsets {                                        \
+        /* NOLINTNEXTLINE(readability-identifier-naming) */ \
+        X_MACRO(UNREALSDK_OFFSETS__DEFINE_OFFSET_MEMBERS)   \
+        template <typename T>                               \
+        static constexpr Offsets from() {                   \
+            UNREALSDK_OFFSETS__OFFSETOF_PRAGMA_PUSH         \
+            X_MACRO(UNREALSDK_OFFSETS__OFFSETOF_ASSERTS);   \
+            return {X_MACRO(UNREALSDK_OFFSETS__OFFSETOF)};  \
+            UNREALSDK_OFFSETS__OFFSETOF_PRAGMA_POP          \
+        }                                                   \
+        UNREALSDK_OFFSETS__DECLARE_GET                      \
     }  // deliberately no semicolon - forward declared earlier so that we could put this last
 
 /**
@@ -79,11 +90,15 @@ using offset_type = uint16_t;
  * @param ClassName The name of the class these fields are being defined for.
  * @param X_MACRO An X macro list of the fields to define. See the example below.
  */
+#ifdef UNREALSDK_STATIC_OFFSETS
+#define UNREALSDK_DEFINE_FIELDS_SOURCE_FILE(ClassName, X_MACRO) static_assert(true)
+#else
 #define UNREALSDK_DEFINE_FIELDS_SOURCE_FILE(ClassName, X_MACRO)                                    \
     UNREALSDK_OFFSETS__PURE_FUNC_ATTR unrealsdk::unreal::offsets::offset_type                      \
     ClassName::Offsets::get(unrealsdk::unreal::offsets::offset_type ClassName::Offsets::* field) { \
         return unrealsdk::internal::get_offsets().ClassName.*field;                                \
     }
+#endif
 
 #if 0  // NOLINT(readability-avoid-unconditional-preprocessor-if)
 
@@ -0,0 +1,64 @@
+#ifndef UNREALSDK_UNREAL_STATIC_OFFSETS_H
+#define UNREALSDK_UNREAL_STATIC_OFFSETS_H
+
+#include "unrealsdk/pch.h"
+
+// This file is only used when building for a single game, with `UNREALSDK_STATIC_OFFSETS` defined.
+// In that case it's force included into every translation unit, straight after the pch, since it
+// needs to provide the definitions of all the offset getters.
+
+#ifdef UNREALSDK_STATIC_OFFSETS
+
+#include "unrealsdk/unreal/offset_list.h"
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#if UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1
+#include "unrealsdk/game/bl1/offsets.h"
+#define UNREALSDK_OFFSETS__STATIC_GAME bl1
+static_assert(sizeof(uintptr_t) == sizeof(uint32_t), "BL1 static offsets require a 32-bit build");
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL1E
+#include "unrealsdk/game/bl1e/offsets.h"
+#define UNREALSDK_OFFSETS__STATIC_GAME bl1e
+static_assert(sizeof(uintptr_t) == sizeof(uint64_t), "BL1E static offsets require a 64-bit build");
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL2
+#include "unrealsdk/game/bl2/offsets.h"
+#define UNREALSDK_OFFSETS__STATIC_GAME bl2
+static_assert(sizeof(uintptr_t) == sizeof(uint32_t), "BL2 static offsets require a 32-bit build");
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_TPS
+#include "unrealsdk/game/tps/offsets.h"
+#define UNREALSDK_OFFSETS__STATIC_GAME tps
+static_assert(sizeof(uintptr_t) == sizeof(uint32_t), "TPS static offsets require a 32-bit build");
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL3
+#include "unrealsdk/game/bl3/offsets.h"
+#define UNREALSDK_OFFSETS__STATIC_GAME bl3
+#elif UNREALSDK_STATIC_OFFSETS == UNREALSDK_GAME_BL4
+#include "unrealsdk/game/bl4/offsets.h"
+#define UNREALSDK_OFFSETS__STATIC_GAME bl4
+#else
+#error Unknown static offsets game
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+namespace unrealsdk::game::UNREALSDK_OFFSETS__STATIC_GAME {
+
+/// The offsets of the single game we were compiled for.
+inline constexpr auto STATIC_OFFSETS = OFFSET_LIST_FROM_NAMESPACE();
+
+}  // namespace unrealsdk::game::UNREALSDK_OFFSETS__STATIC_GAME
+
+namespace unrealsdk::unreal {
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define UNREALSDK_OFFSETS__DEFINE_STATIC_GET(name)                                            \
+    constexpr offsets::offset_type name::Offsets::get(offsets::offset_type Offsets::* field) { \
+        return unrealsdk::game::UNREALSDK_OFFSETS__STATIC_GAME::STATIC_OFFSETS.name.*field;     \
+    }
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+UNREALSDK__DYNAMIC_OFFSET_TYPES(UNREALSDK_OFFSETS__DEFINE_STATIC_GET)
+
+}  // namespace unrealsdk::unreal
+
+#endif
+
+#endif /* UNREALSDK_UNREAL_STATIC_OFFSETS_H */
@@ -16,6 +16,33 @@ FName::FName(const std::wstring& name, uint32_t number) {
     unrealsdk::internal::fname_init(this, name, number);
 }
 
+std::optional<FName> FName::find(std::wstring_view name) {
+    const constexpr size_t max_digits = 10;
+    const constexpr uint64_t base = 10;
+
+    uint32_t number = 0;
+    auto digits_start = name.find_last_not_of(L"0123456789") + 1;
+    auto digits = name.size() - digits_start;
+    // Unreal doesn't treat numbers with leading zeros as a suffix, since they wouldn't round trip
+    if (digits > 0 && digits <= max_digits && digits_start >= 2 && name[digits_start - 1] == L'_'
+        && (digits == 1 || name[digits_start] != L'0')) {
+        uint64_t value = 0;
+        for (auto chr : name.substr(digits_start)) {
+            value = (value * base) + static_cast<uint64_t>(chr - L'0');
+        }
+        if (value < std::numeric_limits<int32_t>::max()) {
+            number = static_cast<uint32_t>(value + 1);
+            name = name.substr(0, digits_start - 1);
+        }
+    }
+
+    auto index = unrealsdk::internal::fname_find(name);
+    if (!index.has_value()) {
+        return std::nullopt;
+    }
+    return FName{*index, number};
+}
+
 bool FName::operator==(const FName& other) const {
     return this->index == other.index && this->number == other.number;
 }
@@ -24,43 +51,99 @@ bool FName::operator!=(const FName& other) const {
     return !operator==(other);
 }
 
-std::ostream& operator<<(std::ostream& stream, const FName& name) {
-    auto variant = unrealsdk::internal::fname_get_str(name);
-    if (std::holds_alternative<const std::string_view>(variant)) {
-        stream << std::get<const std::string_view>(variant);
-    } else {
-        stream << utils::narrow(std::get<const std::wstring_view>(variant));
+namespace {
+
+const constexpr auto MAX_ASCII_CHAR = 0x7F;
+
+/**
+ * @brief Writes the string representation of a name to an output iterator.
+ * @note Only allocates if the name needs to be converted, and isn't ascii.
+ *
+ * @tparam CharT The character type to write.
+ * @tparam OutputIt The output iterator type.
+ * @param name The name to write.
+ * @param out The iterator to write to.
+ * @return The iterator after writing.
+ */
+template <typename CharT, typename OutputIt>
+OutputIt write_name(const FName& name, OutputIt out) {
+    auto to_char = [](auto chr) { return static_cast<CharT>(chr); };
+
+    out = std::visit(
+        [&out, &to_char](auto str) {
+            using FromT = typename decltype(str)::value_type;
+            if constexpr (std::is_same_v<FromT, CharT>) {
+                return std::ranges::copy(str, out).out;
+            } else {
+                if (std::ranges::all_of(str, [](FromT chr) {
+                        return static_cast<std::make_unsigned_t<FromT>>(chr) <= MAX_ASCII_CHAR;
+                    })) {
+                    return std::ranges::copy(str | std::views::transform(to_char), out).out;
+                }
+
+                // Non-ascii names are rare, and need the full codec
+                if constexpr (std::is_same_v<CharT, char>) {
+                    return std::ranges::copy(utils::narrow(str), out).out;
+                } else {
+                    return std::ranges::copy(utils::widen(str), out).out;
+                }
+            }
+        },
+        name.str_view());
+
+    auto suffix = name.suffix();
+    if (suffix.has_value()) {
+        *out++ = static_cast<CharT>('_');
+
+        // Enough for any uint32
+        std::array<char, std::numeric_limits<uint32_t>::digits10 + 1> buf{};
+        auto [end, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), *suffix);
+        out = std::ranges::copy(std::ranges::subrange(buf.data(), end)
+                                    | std::views::transform(to_char),
+                                out)
+                  .out;
     }
 
-    if (name.number != 0) {
-        stream << '_' << std::to_string(name.number - 1);
+    return out;
+}
+
+}  // namespace
+
+std::variant<const std::string_view, const std::wstring_view> FName::str_view(void) const {
+    return unrealsdk::internal::fname_get_str(*this);
+}
+
+std::optional<uint32_t> FName::suffix(void) const {
+    // Numbers are stored one higher than they're displayed, so that 0 can mean no number
+    if (this->number == 0) {
+        return std::nullopt;
     }
+    return this->number - 1;
+}
+
+std::format_context::iterator FName::format_to(std::format_context::iterator out) const {
+    return write_name<char>(*this, out);
+}
+
+std::ostream& operator<<(std::ostream& stream, const FName& name) {
+    write_name<char>(name, std::ostreambuf_iterator<char>{stream});
     return stream;
 }
 
 std::wostream& operator<<(std::wostream& stream, const FName& name) {
-    auto variant = unrealsdk::internal::fname_get_str(name);
-    if (std::holds_alternative<const std::wstring_view>(variant)) {
-        stream << std::get<const std::wstring_view>(variant);
-    } else {
-        stream << utils::widen(std::get<const std::string_view>(variant));
-    }
-
-    if (name.number != 0) {
-        stream << '_' << std::to_wstring(name.number - 1);
-    }
+    write_name<wchar_t>(name, std::ostreambuf_iterator<wchar_t>{stream});
     return stream;
 }
 
 FName::operator std::string() const {
-    std::ostringstream stream;
-    stream << *this;
-    return stream.str();
+    std::string str{};
+    write_name<char>(*this, std::back_inserter(str));
+    return str;
 }
 FName::operator std::wstring() const {
-    std::wostringstream stream;
-    stream << *this;
-    return stream.str();
+    std::wstring str{};
+    write_name<wchar_t>(*this, std::back_inserter(str));
+    return str;
 }
 
 FName operator""_fn(const wchar_t* str, size_t /*len*/) {
@@ -13,6 +13,12 @@ class BL4Hook;
 
 }  // namespace unrealsdk::game
 
+namespace unrealsdk::benchmark {
+
+class MockHook;
+
+}  // namespace unrealsdk::benchmark
+
 namespace unrealsdk::unreal {
 
 UNREALSDK_UNREAL_STRUCT_PADDING_PUSH()
@@ -24,6 +30,7 @@ struct FName {
     friend class game::BL2Hook;
     friend class game::BL3Hook;
     friend class game::BL4Hook;
+    friend class benchmark::MockHook;
 
     uint32_t index{0};
     uint32_t number{0};
@@ -43,6 +50,43 @@ struct FName {
     explicit FName(const std::string& name, uint32_t number = 0);
     explicit FName(const std::wstring& name, uint32_t number = 0);
 
+    /**
+     * @brief Finds an existing name, without adding it to the names table if it doesn't exist.
+     * @note Uses a local index of the names table, so never calls into unreal.
+     * @note In UE3, like any other access to the names table, must be called from the game thread.
+     *       The first call also builds the index there, which may take a moment.
+     * @note Number suffixes are split off the same way unreal does, "Foo_12" has number 13.
+     *
+     * @param name The name to find.
+     * @return The name, or std::nullopt if it doesn't exist.
+     */
+    [[nodiscard]] static std::optional<FName> find(std::wstring_view name);
+
+    /**
+     * @brief Gets the string portion of the name, directly from the names table.
+     * @note Depending on the game and the name, this may be either a narrow or a wide string.
+     *
+     * @return A view into the names table.
+     */
+    [[nodiscard]] std::variant<const std::string_view, const std::wstring_view> str_view(
+        void) const;
+
+    /**
+     * @brief Gets the number suffix of the name, as it's displayed.
+     *
+     * @return The suffix, or std::nullopt if the name doesn't have one.
+     */
+    [[nodiscard]] std::optional<uint32_t> suffix(void) const;
+
+    /**
+     * @brief Writes the name's string representation directly into a format context.
+     * @note Used by the formatter. Only allocates if the name isn't ascii, and needs converting.
+     *
+     * @param out The iterator to write to.
+     * @return The iterator after writing.
+     */
+    std::format_context::iterator format_to(std::format_context::iterator out) const;
+
     bool operator==(const FName& other) const;
     bool operator!=(const FName& other) const;
 
@@ -99,11 +143,24 @@ FName operator""_fn(const wchar_t* str, size_t len);
 
 }  // namespace unrealsdk::unreal
 
-// Custom FName formatter, which just casts to a string first
+// Custom FName formatter, which writes straight into the output when there's no format spec, and
+// only casts to a string first when it needs to be padded
 template <>
-struct std::formatter<unrealsdk::unreal::FName> : std::formatter<std::string> {
+struct std::formatter<unrealsdk::unreal::FName> : std::formatter<std::string_view> {
+   private:
+    bool has_spec = false;
+
+   public:
+    constexpr auto parse(std::format_parse_context& ctx) {
+        this->has_spec = ctx.begin() != ctx.end() && *ctx.begin() != '}';
+        return formatter<std::string_view>::parse(ctx);
+    }
+
     auto format(unrealsdk::unreal::FName name, std::format_context& ctx) const {
-        return formatter<std::string>::format((std::string)name, ctx);
+        if (this->has_spec) {
+            return formatter<std::string_view>::format((std::string)name, ctx);
+        }
+        return name.format_to(ctx.out());
     }
 };
 
@@ -4,11 +4,54 @@
 #include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/properties/zproperty.h"
 #include "unrealsdk/unreal/wrappers/gobjects.h"
+#include "unrealsdk/unreal/wrappers/weak_pointer.h"
 #include "unrealsdk/unrealsdk.h"
 #include "unrealsdk/utils.h"
 
 namespace unrealsdk::unreal {
 
+namespace {
+
+using ResolveKey = std::pair<const UClass*, FName>;
+
+struct ResolveKeyHash {
+    [[nodiscard]] size_t operator()(const ResolveKey& key) const {
+        return std::hash<const UClass*>{}(key.first) ^ (std::hash<FName>{}(key.second) << 1);
+    }
+};
+
+struct ResolvedFunction {
+    WeakPointer cls;
+    UFunction* func;
+};
+
+// Finding a function by name is a linear search through all of the class' fields, while the same
+// few delegates tend to get called over and over, so we cache them. Since the function only depends
+// on the class, that's all we need to validate - via a weak pointer, in case it got unloaded and
+// something else was allocated in it's place.
+thread_local std::unordered_map<ResolveKey, ResolvedFunction, ResolveKeyHash> resolved_functions{};
+
+/**
+ * @brief Finds the function a delegate should call, using the cache if possible.
+ *
+ * @param cls The class of the object the delegate is bound to.
+ * @param name The name of the function.
+ * @return The function.
+ */
+UFunction* find_delegate_func(const UClass* cls, const FName& name) {
+    const ResolveKey key{cls, name};
+    auto iter = resolved_functions.find(key);
+    if (iter != resolved_functions.end() && *iter->second.cls == cls) {
+        return iter->second.func;
+    }
+
+    auto func = cls->find_func_and_validate(name);
+    resolved_functions.insert_or_assign(key, ResolvedFunction{.cls = cls, .func = func});
+    return func;
+}
+
+}  // namespace
+
 #if UNREALSDK_HAS_NATIVE_WEAK_POINTERS
 
 UObject* FScriptDelegate::get_object(void) const {
@@ -38,8 +81,7 @@ void FScriptDelegate::set_object(UObject* obj) {
         return std::nullopt;
     }
 
-    return BoundFunction{.func = obj->Class()->find_func_and_validate(this->func_name),
-                         .object = obj};
+    return BoundFunction{.func = find_delegate_func(obj->Class(), this->func_name), .object = obj};
 }
 
 void FScriptDelegate::bind(const std::optional<BoundFunction>& func) {
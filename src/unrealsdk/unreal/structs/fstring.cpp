@@ -13,13 +13,13 @@ namespace {
 using size_type = decltype(TArray<wchar_t>::count);
 
 /**
- * @brief Gets the size of an stl string, ensuring it's valid to fit into a TArray.
+ * @brief Gets the size of an FString holding a string, ensuring it's valid to fit into a TArray.
  *
- * @param str The string to get the size of.
- * @return The size of the string.
+ * @param len The length of the string, excluding the null terminator.
+ * @return The size of the FString, including the null terminator.
  */
-size_type valid_size(std::wstring_view str) {
-    const size_t size = str.size() + 1;  // Include the null terminator
+size_type valid_size(size_t len) {
+    const size_t size = len + 1;  // Include the null terminator
     if (size > static_cast<size_t>(std::numeric_limits<size_type>::max())) {
         throw std::length_error("Tried to allocate a string longer than TArray max capacity!");
     }
@@ -31,7 +31,9 @@ size_type valid_size(std::wstring_view str) {
 #pragma region TemporaryFString
 
 TemporaryFString::TemporaryFString(std::wstring_view str)
-    : TArray{.data = str.data(), .count = valid_size(str), .max = valid_size(str)} {}
+    : TArray{.data = str.data(),
+             .count = valid_size(str.size()),
+             .max = valid_size(str.size())} {}
 
 #pragma endregion
 
@@ -40,14 +42,12 @@ TemporaryFString::TemporaryFString(std::wstring_view str)
 UnmanagedFString::UnmanagedFString(decltype(data) data, decltype(count) count, decltype(max) max)
     : TArray{.data = data, .count = count, .max = max} {}
 UnmanagedFString::UnmanagedFString(std::string_view str)
-    : UnmanagedFString(unrealsdk::utils::widen(str)) {}
+    : TArray{.data = nullptr, .count = 0, .max = 0} {
+    this->set_from(str);
+}
 UnmanagedFString::UnmanagedFString(std::wstring_view str)
     : TArray{.data = nullptr, .count = 0, .max = 0} {
-    if (!str.empty()) {
-        auto size = valid_size(str);
-        this->resize(size);
-        memcpy(this->data, str.data(), size * sizeof(*this->data));
-    }
+    this->set_from(str);
 }
 UnmanagedFString::UnmanagedFString(UnmanagedFString&& other) noexcept
     : TArray{.data = std::exchange(other.data, nullptr),
@@ -55,10 +55,10 @@ UnmanagedFString::UnmanagedFString(UnmanagedFString&& other) noexcept
              .max = std::exchange(other.max, 0)} {}
 
 UnmanagedFString& UnmanagedFString::operator=(std::string_view str) {
-    return *this = UnmanagedFString{str};
+    return this->set_from(str);
 }
 UnmanagedFString& UnmanagedFString::operator=(std::wstring_view str) {
-    return *this = UnmanagedFString{str};
+    return this->set_from(str);
 }
 UnmanagedFString& UnmanagedFString::operator=(UnmanagedFString&& other) noexcept {
     std::swap(this->data, other.data);
@@ -67,6 +67,39 @@ UnmanagedFString& UnmanagedFString::operator=(UnmanagedFString&& other) noexcept
     return *this;
 }
 
+UnmanagedFString& UnmanagedFString::set_from(std::string_view str) {
+    if (str.empty()) {
+        this->count = 0;
+        return *this;
+    }
+
+    // Each utf-8 byte becomes at most one wide char, so size for that, and shrink after
+    auto max_size = valid_size(str.size());
+    this->resize(max_size);
+
+    auto len = unrealsdk::utils::widen_into(str, this->data);
+    this->data[len] = L'\0';
+    this->count = static_cast<size_type>(len + 1);
+
+    return *this;
+}
+UnmanagedFString& UnmanagedFString::set_from(std::wstring_view str) {
+    if (str.empty()) {
+        this->count = 0;
+        return *this;
+    }
+
+    auto size = valid_size(str.size());
+    this->resize(size);
+
+    // Use memmove in case we're assigning a view into ourselves - since we can only ever shrink in
+    // that case, the resize won't have reallocated
+    memmove(this->data, str.data(), str.size() * sizeof(*this->data));
+    this->data[str.size()] = L'\0';
+
+    return *this;
+}
+
 UnmanagedFString::operator std::string() const {
     return unrealsdk::utils::narrow(this->operator std::wstring_view());
 }
@@ -70,6 +70,7 @@ struct UnmanagedFString : public TArray<wchar_t> {
     /**
      * @brief Assigns to the string.
      * @note Automatically converts utf8 to utf16 if needed.
+     * @note Assigning from an stl string reuses the existing allocation if it's large enough.
      *
      * @param str The stl string to assign this one from.
      * @param other The other FString to assign this one from.
@@ -79,6 +80,17 @@ struct UnmanagedFString : public TArray<wchar_t> {
     UnmanagedFString& operator=(std::wstring_view str);
     UnmanagedFString& operator=(UnmanagedFString&& other) noexcept;
 
+    /**
+     * @brief Sets the contents of this string, reusing the existing allocation if possible.
+     * @note Utf8 strings are converted directly into this string's buffer, without a temporary.
+     * @note If the allocation is too small, grows geometrically, via the unreal allocator.
+     *
+     * @param str The stl string to copy.
+     * @return A reference to this FString.
+     */
+    UnmanagedFString& set_from(std::string_view str);
+    UnmanagedFString& set_from(std::wstring_view str);
+
     /**
      * @brief Converts the string to an stl string.
      * @note Automatically converts utf16 to utf8 if needed.
@@ -59,10 +59,46 @@ struct TArray {
     static const constexpr auto GROW_CONST = 16;
 
    public:
+    /**
+     * @brief Ensures the array has capacity for at least the given amount of elements.
+     * @note Grows geometrically, so repeatedly growing by a small amount is amortized constant time.
+     * @note Never shrinks the array. If the existing capacity is already large enough, which may be
+     *       the case for engine-owned arrays allocated with slack, this does nothing.
+     * @note Caller must ensure any added entries' values are appropriately initialized.
+     *
+     * @param min_cap The minimum capacity required, in number of elements.
+     * @param element_size The size of each element.
+     */
+    template <typename U = T,
+              typename = std::enable_if_t<std::is_same_v<U, T> && std::negation_v<std::is_void<U>>>>
+    void grow(size_t min_cap) {
+        this->grow(min_cap, sizeof(U));
+    }
+    void grow(size_t min_cap, size_t element_size) {
+        if (min_cap <= (size_t)this->max) {
+            return;
+        }
+
+        // Vaguely copying the standard UE grow with slack logic
+        size_t new_capacity =
+            (min_cap <= MIN_GROW)
+                ? MIN_GROW
+                : min_cap + (GROW_MULTIPLIER * min_cap / GROW_DIVIDER) + GROW_CONST;
+
+        // Don't let the slack push us over the max capacity - let reserve throw only if the
+        // requested size itself is too large
+        if (min_cap <= MAX_CAPACITY) {
+            new_capacity = std::min<size_t>(new_capacity, MAX_CAPACITY);
+        }
+
+        this->reserve(new_capacity, element_size);
+    }
+
     /**
      * @brief Resizes the array.
      * @note Caller must ensure any removed entries are already destroyed, so they don't leak, and
      *       that any added entries' values are appropriately initialized.
+     * @note Never shrinks the capacity, growing uses the same geometric growth as `grow`.
      *
      * @param new_size The new size, in number of elements.
      * @param element_size The size of each element.
@@ -73,16 +109,7 @@ struct TArray {
         this->resize(new_size, sizeof(U));
     }
     void resize(size_t new_size, size_t element_size) {
-        if ((size_t)this->max < new_size) {
-            // Vaguely copying the standard UE grow with slack logic
-            auto new_capacity =
-                (new_size <= MIN_GROW)
-                    ? MIN_GROW
-                    : new_size + (GROW_MULTIPLIER * new_size / GROW_DIVIDER) + GROW_CONST;
-
-            this->reserve(new_capacity, element_size);
-        }
-
+        this->grow(new_size, element_size);
         this->count = (decltype(count))new_size;
     }
 
@@ -1,5 +1,6 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/unreal/wrappers/weak_pointer.h"
+#include "unrealsdk/gc.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/wrappers/gobjects.h"
 #include "unrealsdk/unrealsdk.h"
@@ -16,6 +17,11 @@ WeakPointer& WeakPointer::operator=(const UObject* obj) {
     if (obj != nullptr) {
         this->index = obj->InternalIndex();
 
+        this->tracked = gc::is_tracking() && this->index < gc::MAX_TRACKED_GENERATIONS;
+        if (this->tracked) {
+            this->generation = gc::generation(this->index);
+        }
+
         this->outer_addr = reinterpret_cast<uintptr_t>(obj->Outer());
         this->vftable_addr = reinterpret_cast<uintptr_t>(obj->vftable);
         this->class_addr = reinterpret_cast<uintptr_t>(obj->Class());
@@ -28,7 +34,31 @@ UObject* WeakPointer::operator*(void) const {
     if (this->obj_addr == 0) {
         return nullptr;
     }
-    auto gobjects = unrealsdk::gobjects();
+    if (this->tracked) {
+        return this->get_tracked(unrealsdk::gobjects());
+    }
+    return this->get_untracked(unrealsdk::gobjects());
+}
+
+UObject* WeakPointer::get_tracked(const GObjects& gobjects) const {
+    if (gc::generation(this->index) != this->generation) {
+        return nullptr;
+    }
+
+    // The generation only changes when an object starts being destroyed, so if we were assigned an
+    // object which had already started, it won't change again when it's slot gets freed or reused.
+    // Make sure the slot still holds the same object, so that we at least never return a dead one.
+    if (this->index >= gobjects.size()) {
+        return nullptr;
+    }
+    auto obj = gobjects.obj_at(this->index);
+    if (obj == nullptr || this->obj_addr != reinterpret_cast<uintptr_t>(obj)) {
+        return nullptr;
+    }
+    return obj;
+}
+
+UObject* WeakPointer::get_untracked(const GObjects& gobjects) const {
     if (this->index >= gobjects.size()) {
         return nullptr;
     }
@@ -47,6 +77,37 @@ UObject* WeakPointer::operator*(void) const {
     return obj;
 }
 
+size_t WeakPointer::validate_all(std::span<WeakPointer> ptrs) {
+    // Only look up gobjects if we actually need it
+    const GObjects* gobjects = nullptr;
+
+    size_t valid = 0;
+    for (auto& ptr : ptrs) {
+        if (ptr.obj_addr == 0) {
+            continue;
+        }
+
+        // Check the generation first, since it lets us skip looking up gobjects when it's changed
+        if (ptr.tracked && gc::generation(ptr.index) != ptr.generation) {
+            ptr = nullptr;
+            continue;
+        }
+
+        if (gobjects == nullptr) {
+            gobjects = &unrealsdk::gobjects();
+        }
+        const bool is_valid = ptr.tracked ? ptr.get_tracked(*gobjects) != nullptr
+                                          : ptr.get_untracked(*gobjects) != nullptr;
+
+        if (is_valid) {
+            valid++;
+        } else {
+            ptr = nullptr;
+        }
+    }
+    return valid;
+}
+
 #else
 WeakPointer::WeakPointer(const UObject* obj) {
     unrealsdk::gobjects().set_weak_object(&this->ptr, obj);
@@ -60,6 +121,20 @@ WeakPointer& WeakPointer::operator=(const UObject* obj) {
 UObject* WeakPointer::operator*(void) const {
     return unrealsdk::gobjects().get_weak_object(&this->ptr);
 }
+
+size_t WeakPointer::validate_all(std::span<WeakPointer> ptrs) {
+    const auto& gobjects = unrealsdk::gobjects();
+
+    size_t valid = 0;
+    for (auto& ptr : ptrs) {
+        if (gobjects.get_weak_object(&ptr.ptr) != nullptr) {
+            valid++;
+        } else {
+            ptr = nullptr;
+        }
+    }
+    return valid;
+}
 #endif
 
 UObject* WeakPointer::operator*(void) {
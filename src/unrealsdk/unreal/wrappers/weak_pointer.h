@@ -11,14 +11,17 @@
 
 namespace unrealsdk::unreal {
 
+class GObjects;
 class UObject;
 
 /**
 Class which holds a weak reference to an unreal object.
 
-Under Unreal 3 this is emulated, as there's no built in support for weak references. This means
-there's a very rare chance that this returns a different object than what was it was set to, however
-it will be near identical, and it will always be a valid object.
+Under Unreal 3 this is emulated, as there's no built in support for weak references. If we're
+tracking destroyed objects (see `gc::is_tracking`), this works much like UE4, by checking the
+generation of the object's GObjects slot. Otherwise, there's a very rare chance that this returns a
+different object than what was it was set to, however it will be near identical, and it will always
+be a valid object.
 
 Note that there's no way to get a strong reference to an unreal object. This means if you're using
 this on a thread, it's always possible for the engine to pull the object out from under you after
@@ -39,6 +42,11 @@ struct WeakPointer {
     // Use an address of 0 as the null sentinel, since index 0 may be valid.
     uintptr_t obj_addr = 0;
 
+    // If we're tracking destroyed objects, the slot's generation, plus the address, tells us if
+    // this is still the same object, and we can skip all the other checks.
+    bool tracked = false;
+    uint32_t generation{};
+
     // A lot of transient objects are stored under a transient `PersistentLevel` package, which
     // should also change whenever you change levels.
     uintptr_t outer_addr{};
@@ -51,6 +59,23 @@ struct WeakPointer {
     // number, so this should help catch out a few more cases.
     FName name;
 
+    /**
+     * @brief Gets the referenced object by checking it's slot's generation, and that the slot still
+     *        holds the same address.
+     *
+     * @param gobjects The gobjects wrapper to use.
+     * @return The referenced object, or nullptr if it's been destroyed.
+     */
+    [[nodiscard]] UObject* get_tracked(const GObjects& gobjects) const;
+
+    /**
+     * @brief Gets the referenced object by comparing against the object currently in it's slot.
+     *
+     * @param gobjects The gobjects wrapper to use.
+     * @return The referenced object, or nullptr if it's changed.
+     */
+    [[nodiscard]] UObject* get_untracked(const GObjects& gobjects) const;
+
 #else
     FWeakObjectPtr ptr{};
 #endif
@@ -99,6 +124,16 @@ struct WeakPointer {
      */
     [[nodiscard]] operator bool(void);
     [[nodiscard]] operator bool(void) const;
+
+    /**
+     * @brief Checks a set of weak pointers all at once, clearing any which no longer hold a valid
+     *        object.
+     * @note More efficient than dereferencing each individually.
+     *
+     * @param ptrs The pointers to check.
+     * @return The number of pointers which still hold a valid object.
+     */
+    static size_t validate_all(std::span<WeakPointer> ptrs);
 };
 
 }  // namespace unrealsdk::unreal
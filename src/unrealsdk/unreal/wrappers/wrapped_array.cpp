@@ -2,6 +2,7 @@
 
 #include "unrealsdk/unreal/cast.h"
 #include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/structs/tarray_funcs.h"
 #include "unrealsdk/unreal/wrappers/unreal_pointer.h"
 #include "unrealsdk/unreal/wrappers/unreal_pointer_funcs.h"
 #include "unrealsdk/unreal/wrappers/wrapped_array.h"
@@ -53,4 +54,36 @@ void WrappedArray::resize(size_t new_size) {
     }
 }
 
+void WrappedArray::insert_n(size_t idx, size_t count) {
+    size_t old_size = this->base->size();
+    if (idx > old_size) {
+        throw std::out_of_range("WrappedArray insert index out of range");
+    }
+    if (count == 0) {
+        return;
+    }
+    if (count > TArray<void>::MAX_CAPACITY - old_size) {
+        throw std::length_error("Tried to increase TArray beyond max capacity!");
+    }
+
+    auto element_size = this->type->ElementSize();
+    this->base->resize(old_size + count, element_size);
+
+    // Unreal types are all trivially relocatable, so we can move the tail using a raw memmove
+    auto data_ptr = reinterpret_cast<uint8_t*>(this->base->data);
+    auto insert_ptr = data_ptr + (idx * element_size);
+    if (idx < old_size) {
+        memmove(insert_ptr + (count * element_size), insert_ptr, (old_size - idx) * element_size);
+    }
+
+    // 0-initialize the new entries
+    memset(insert_ptr, 0, count * element_size);
+}
+
+size_t WrappedArray::emplace_back_n(size_t count) {
+    auto idx = this->size();
+    this->insert_n(idx, count);
+    return idx;
+}
+
 }  // namespace unrealsdk::unreal
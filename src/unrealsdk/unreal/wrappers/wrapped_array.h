@@ -61,26 +61,79 @@ class WrappedArray {
      */
     void resize(size_t new_size);
 
+    /**
+     * @brief Inserts new elements into the array.
+     * @note Grows the array at most once, and moves any following elements at most once.
+     * @note New elements are 0-initialized.
+     *
+     * @param idx The index to insert at. May be equal to the size to append.
+     * @param count The amount of elements to insert.
+     */
+    void insert_n(size_t idx, size_t count);
+
+    /**
+     * @brief Appends new elements to the end of the array.
+     * @note Grows the array at most once.
+     * @note New elements are 0-initialized.
+     *
+     * @param count The amount of elements to append.
+     * @return The index of the first appended element.
+     */
+    size_t emplace_back_n(size_t count);
+
    private:
     /**
-     * @brief Type and bound check an access to this array.
+     * @brief Type check an access to this array.
      *
      * @tparam T The expected property type
-     * @param idx The index being accessed.
      */
     template <typename T>
-    void validate_access(size_t idx) const {
+    void validate_type(void) const {
         auto property_class = this->type->Class()->Name();
         if (property_class != cls_fname<T>()) {
             throw std::invalid_argument("WrappedArray property was of invalid type "
                                         + property_class);
         }
+    }
+
+    /**
+     * @brief Type and bound check an access to this array.
+     *
+     * @tparam T The expected property type
+     * @param idx The index being accessed.
+     */
+    template <typename T>
+    void validate_access(size_t idx) const {
+        this->validate_type<T>();
 
         if (idx >= (size_t)this->base->count) {
             throw std::out_of_range("WrappedArray index out of range");
         }
     }
 
+    /**
+     * @brief Inserts a range of values into the array, after it's been type checked.
+     * @note The values must not alias this array, see `insert_range`.
+     *
+     * @tparam T The expected property type.
+     * @tparam R The type of the range - should be picked up automatically.
+     * @param idx The index to insert at. May be equal to the size to append.
+     * @param count The amount of values in the range.
+     * @param values The values to insert.
+     */
+    template <typename T, std::ranges::forward_range R>
+    void insert_values(size_t idx, size_t count, R&& values) {
+        this->insert_n(idx, count);
+
+        auto prop = reinterpret_cast<const T*>(this->type);
+        auto element_size = this->type->ElementSize();
+        auto addr = reinterpret_cast<uintptr_t>(this->base->data) + (element_size * idx);
+        for (const typename PropTraits<T>::Value& value : values) {
+            set_property<T>(prop, 0, addr, value);
+            addr += element_size;
+        }
+    }
+
    public:
     /**
      * @brief Gets an element in the array, with bounds and type checking.
@@ -114,6 +167,69 @@ class WrappedArray {
             value);
     }
 
+    /**
+     * @brief Inserts a range of values into the array, with type checking.
+     * @note Grows the array at most once, and moves any following elements at most once.
+     * @note If setting a value throws, the remaining inserted elements are left 0-initialized.
+     * @note The values may come from this same array, in which case they're copied out before it's
+     *       modified. Values which are themselves views, such as a `WrappedArray`, are only copied
+     *       shallowly, so must not point into this array.
+     *
+     * @tparam T The expected property type.
+     * @tparam R The type of the range - should be picked up automatically.
+     * @param idx The index to insert at. May be equal to the size to append.
+     * @param values The values to insert.
+     */
+    template <typename T, std::ranges::forward_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>,
+                                     const typename PropTraits<T>::Value&>
+    void insert_range(size_t idx, R&& values) {
+        using Value = typename PropTraits<T>::Value;
+
+        // Check the type before we start modifying the array
+        this->validate_type<T>();
+
+        auto count = (size_t)std::ranges::distance(values);
+
+        // Growing the array or moving it's elements would invalidate any values which point into
+        // it, so if that's possible, copy them out first. Plain values in a contiguous range can
+        // only alias if the range itself overlaps the array, anything else might be lazily reading
+        // from it, or holding a reference into it, so always gets copied.
+        bool may_alias = true;
+        if constexpr (std::ranges::contiguous_range<R> && std::is_trivially_copyable_v<Value>) {
+            auto values_start = reinterpret_cast<uintptr_t>(std::ranges::data(values));
+            auto values_end = values_start + (count * sizeof(std::ranges::range_value_t<R>));
+            auto data_start = reinterpret_cast<uintptr_t>(this->base->data);
+            auto data_end = data_start + (this->size() * this->type->ElementSize());
+            may_alias = values_start < data_end && data_start < values_end;
+        }
+        if (may_alias && count > 0) {
+            std::vector<Value> copy{};
+            copy.reserve(count);
+            for (const Value& value : values) {
+                copy.push_back(value);
+            }
+            this->insert_values<T>(idx, count, copy);
+        } else {
+            this->insert_values<T>(idx, count, values);
+        }
+    }
+
+    /**
+     * @brief Appends a range of values to the end of the array, with type checking.
+     * @note Grows the array at most once.
+     *
+     * @tparam T The expected property type.
+     * @tparam R The type of the range - should be picked up automatically.
+     * @param values The values to append.
+     */
+    template <typename T, std::ranges::forward_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>,
+                                     const typename PropTraits<T>::Value&>
+    void append_range(R&& values) {
+        this->insert_range<T>(this->size(), std::forward<R>(values));
+    }
+
     /**
      * @brief Destroys n element in the array, with bounds and type checking.
      *
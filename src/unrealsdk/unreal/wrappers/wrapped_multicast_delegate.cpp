@@ -1,9 +1,12 @@
 #include "unrealsdk/pch.h"
 #include "unrealsdk/unreal/wrappers/wrapped_multicast_delegate.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
 #include "unrealsdk/unreal/structs/fscriptdelegate.h"
 #include "unrealsdk/unreal/structs/tarray.h"
 #include "unrealsdk/unreal/structs/tarray_funcs.h"
+#include "unrealsdk/unreal/wrappers/weak_pointer.h"
 #include "unrealsdk/unreal/wrappers/wrapped_struct.h"
 
 namespace unrealsdk::unreal {
@@ -27,6 +30,39 @@ struct StructTypeSwapper {
     StructTypeSwapper& operator=(StructTypeSwapper&&) = delete;
 };
 
+struct OutParamsInfo {
+    WeakPointer signature;
+    bool has_out_params;
+};
+
+// Multicast delegates tend to get broadcast over and over, while a signature's params never change,
+// so cache if each has out params rather than iterating through them every call. Like resolved
+// delegate functions, validate entries via a weak pointer, in case the signature got unloaded and
+// something else was allocated in it's place.
+thread_local std::unordered_map<const UFunction*, OutParamsInfo> out_params_cache{};
+
+/**
+ * @brief Checks if a function has any out params, which calling it could modify.
+ *
+ * @param func The function to check.
+ * @return True if the function has out params.
+ */
+bool has_out_params(const UFunction* func) {
+    auto iter = out_params_cache.find(func);
+    if (iter != out_params_cache.end() && *iter->second.signature == func) {
+        return iter->second.has_out_params;
+    }
+
+    const auto out_param = ZProperty::PROP_FLAG_PARAM | ZProperty::PROP_FLAG_OUT;
+    const bool has_out =
+        std::ranges::any_of(func->properties(), [out_param](const ZProperty* prop) {
+            return (prop->PropertyFlags() & out_param) == out_param;
+        });
+    out_params_cache.insert_or_assign(
+        func, OutParamsInfo{.signature = func, .has_out_params = has_out});
+    return has_out;
+}
+
 }  // namespace
 
 WrappedMulticastDelegate::WrappedMulticastDelegate(const UFunction* signature,
@@ -40,27 +76,32 @@ void WrappedMulticastDelegate::call(WrappedStruct& params) const {
                                  + params.type->Name());
     }
 
-    if (this->base->size() == 0) {
-        return;
-    }
+    // When calling a function, unreal copies the params into a new frame, and only copies out
+    // params back. If there aren't any, none of the calls can edit the params, so we can safely
+    // pass the same struct to all of them.
+    const bool needs_copy = has_out_params(this->signature);
 
-    // For the first N-1 entries, copy the params struct each time, in case the call edits it
-    for (size_t i = 0; i < this->base->size() - 1; i++) {
+    for (size_t i = 0; i < this->base->size(); i++) {
         auto func = this->base->data[i].as_function();
-
-        WrappedStruct params_copy = params;
+        if (!func.has_value()) {
+            continue;
+        }
 
         // Since the function is a different type to the signature, to do the call we need to swap
         // the type of the params with that of the exact function we're calling.
         // Previous code (or the engine itself) should have made sure this is compatible.
-        const StructTypeSwapper swap{params_copy, func->func};
-        func->call<void>(params_copy);
-    }
 
-    // For the last entry, we can pass the params directly
-    auto func = this->base->data[this->base->size() - 1].as_function();
-    const StructTypeSwapper swap{params, func->func};
-    func->call<void>(params);
+        // For the first N-1 entries, copy the params struct each time, in case the call edits it
+        // For the last entry, we can pass the params directly
+        if (needs_copy && i < this->base->size() - 1) {
+            WrappedStruct params_copy = params;
+            const StructTypeSwapper swap{params_copy, func->func};
+            func->call<void>(params_copy);
+        } else {
+            const StructTypeSwapper swap{params, func->func};
+            func->call<void>(params);
+        }
+    }
 }
 
 void WrappedMulticastDelegate::push_back(const BoundFunction& func) const {
@@ -172,6 +172,15 @@ void fname_init(unreal::FName* name, const std::wstring& str, uint32_t number);
 [[nodiscard]] std::variant<const std::string_view, const std::wstring_view> fname_get_str(
     const unreal::FName& name);
 
+/**
+ * @brief Finds the index of an existing name, using the local name index.
+ * @note Never adds new names.
+ *
+ * @param str The string to look up, without a number suffix.
+ * @return The name index, or std::nullopt if it doesn't exist.
+ */
+[[nodiscard]] std::optional<uint32_t> fname_find(std::wstring_view str);
+
 /**
  * @brief Calls `FFrame::Step`.
  *
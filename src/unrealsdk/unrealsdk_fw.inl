@@ -57,6 +57,7 @@ namespace internal {
 
 UNREALSDK_CAPI(void, fname_init, FName* name, const wchar_t* str, uint32_t number);
 UNREALSDK_CAPI(void, fname_get_str, FName name, const void** str, size_t* size, bool* is_wide);
+UNREALSDK_CAPI([[nodiscard]] bool, fname_find, const wchar_t* str, size_t size, uint32_t* index);
 UNREALSDK_CAPI(void, fframe_step, FFrame* frame, UObject* obj, void* param);
 UNREALSDK_CAPI(void, process_event, UObject* object, UFunction* function, void* params);
 UNREALSDK_CAPI(void, uconsole_output_text, const wchar_t* str, size_t size);
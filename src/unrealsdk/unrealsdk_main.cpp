@@ -1,9 +1,12 @@
 #include "unrealsdk/pch.h"
 
+#include "unrealsdk/async_hooks.h"
 #include "unrealsdk/config.h"
 #include "unrealsdk/game/abstract_hook.h"
+#include "unrealsdk/game/fname_index.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/logging.h"
+#include "unrealsdk/profiling.h"
 #include "unrealsdk/unreal/find_class.h"
 #include "unrealsdk/unrealsdk.h"
 #include "unrealsdk/version.h"
@@ -37,6 +40,7 @@ namespace {
 
 std::mutex init_mutex{};
 std::unique_ptr<game::AbstractHook> hook_instance;
+game::FNameIndex fname_index{};
 
 }  // namespace
 
@@ -51,25 +55,74 @@ bool init(const std::function<std::unique_ptr<game::AbstractHook>(void)>& game_g
         return false;
     }
 
+    auto init_start = profiling::clock::now();
     config::load();
+    auto config_end = profiling::clock::now();
     logging::init(utils::get_this_dll().parent_path()
                   / config::get_str("unrealsdk.log_file").value_or("unrealsdk.log"));
+    auto logging_end = profiling::clock::now();
+
+    // Can't start profiling until we've read the config, so record these retroactively
+    if (config::get_bool("unrealsdk.startup_trace").value_or(false)) {
+        profiling::init(
+            utils::get_this_dll().parent_path()
+                / config::get_str("unrealsdk.startup_trace_file").value_or("unrealsdk.trace.json"),
+            init_start);
+        profiling::record("config::load", "init", init_start, config_end);
+        profiling::record("logging::init", "init", config_end, logging_end);
+    }
+    auto finish_profiling = [init_start]() {
+        profiling::record("unrealsdk::init", "init", init_start, profiling::clock::now());
+        profiling::finish();
+    };
 
     auto version = unrealsdk::get_version_string();
     LOG(INFO, "{}", version);
     LOG(INFO, "{}", std::string(version.size(), '='));
 
-    if (MH_Initialize() != MH_OK) {
-        throw std::runtime_error("Minhook initialization failed!");
+    try {
+        {
+            const profiling::ScopedTimer timer{"MH_Initialize", "init"};
+            if (MH_Initialize() != MH_OK) {
+                throw std::runtime_error("Minhook initialization failed!");
+            }
+        }
+
+        std::unique_ptr<game::AbstractHook> game;
+        {
+            const profiling::ScopedTimer timer{"select_game", "init"};
+            game = game_getter();
+        }
+
+        // Initialize the hook before moving it, to weed out any unexpected calls to the globals.
+        {
+            const profiling::ScopedTimer timer{"hook", "init"};
+            game->hook();
+        }
+        hook_instance = std::move(game);
+
+        {
+            const profiling::ScopedTimer timer{"post_init", "init"};
+            hook_instance->post_init();
+        }
+
+        // Build the name index in the background, nothing needs it until the first lookup. If the
+        // names table can't be read from other threads, the first lookup builds it instead.
+        if constexpr (game::FNameIndex::CONCURRENT_READS) {
+            std::thread([]() {
+                SetThreadDescription(GetCurrentThread(), L"unrealsdk name index");
+                try {
+                    fname_index.build(*hook_instance);
+                } catch (const std::exception& ex) {
+                    LOG(ERROR, "Failed to build name index: {}", ex.what());
+                }
+            }).detach();
+        }
+    } catch (...) {
+        finish_profiling();
+        throw;
     }
-
-    auto game = game_getter();
-
-    // Initialize the hook before moving it, to weed out any unexpected calls to the globals.
-    game->hook();
-    hook_instance = std::move(game);
-
-    hook_instance->post_init();
+    finish_profiling();
 
     return true;
 }
@@ -121,6 +174,7 @@ UNREALSDK_CAPI([[nodiscard]] UObject*,
                const FName* name,
                uint64_t flags,
                UObject* template_obj) {
+    hook_manager::impl::ensure_not_async_hook_thread("construct objects");
     FName local_name{};
     if (name != nullptr) {
         local_name = *name;
@@ -133,6 +187,7 @@ UNREALSDK_CAPI([[nodiscard]] UObject*,
                UClass* cls,
                const wchar_t* name,
                size_t name_size) {
+    hook_manager::impl::ensure_not_async_hook_thread("find objects");
     return hook_instance->find_object(cls, {name, name_size});
 }
 
@@ -141,12 +196,14 @@ UNREALSDK_CAPI([[nodiscard]] UObject*,
                const wchar_t* name,
                size_t size,
                uint32_t flags) {
+    hook_manager::impl::ensure_not_async_hook_thread("load packages");
     return hook_instance->load_package({name, size}, flags);
 }
 
 namespace internal {
 
 UNREALSDK_CAPI(void, fname_init, FName* name, const wchar_t* str, uint32_t number) {
+    hook_manager::impl::ensure_not_async_hook_thread("create names");
     hook_instance->fname_init(name, str, number);
 }
 
@@ -160,11 +217,21 @@ UNREALSDK_CAPI(void, fname_get_str, FName name, const void** str, size_t* size,
         hook_instance->fname_get_str(name));
 }
 
+UNREALSDK_CAPI([[nodiscard]] bool, fname_find, const wchar_t* str, size_t size, uint32_t* index) {
+    auto found = fname_index.find(*hook_instance, {str, size});
+    if (found.has_value()) {
+        *index = *found;
+    }
+    return found.has_value();
+}
+
 UNREALSDK_CAPI(void, fframe_step, FFrame* frame, UObject* obj, void* param) {
+    hook_manager::impl::ensure_not_async_hook_thread("step through a stack frame");
     hook_instance->fframe_step(frame, obj, param);
 }
 
 UNREALSDK_CAPI(void, process_event, UObject* object, UFunction* function, void* params) {
+    hook_manager::impl::ensure_not_async_hook_thread("call an unreal function");
     hook_instance->process_event(object, function, params);
 }
 
@@ -177,6 +244,7 @@ UNREALSDK_CAPI(void, uconsole_output_text, const wchar_t* str, size_t size) {
 }
 
 UNREALSDK_CAPI([[nodiscard]] wchar_t*, uobject_path_name, const UObject* obj, size_t& size) {
+    hook_manager::impl::ensure_not_async_hook_thread("get an object's path name");
     auto name = hook_instance->uobject_path_name(obj);
     size = name.size();
 
@@ -187,6 +255,7 @@ UNREALSDK_CAPI([[nodiscard]] wchar_t*, uobject_path_name, const UObject* obj, si
     return mem;
 }
 UNREALSDK_CAPI([[nodiscard]] wchar_t*, ffield_path_name, const FField* obj, size_t& size) {
+    hook_manager::impl::ensure_not_async_hook_thread("get a field's path name");
     auto name = hook_instance->ffield_path_name(obj);
     size = name.size();
 
@@ -202,14 +271,17 @@ UNREALSDK_CAPI(void,
                unreal::FText* text,
                const wchar_t* str,
                size_t size) {
+    hook_manager::impl::ensure_not_async_hook_thread("create an FText");
     hook_instance->ftext_as_culture_invariant(text, {str, size});
 }
 
 UNREALSDK_CAPI(void, fsoftobjectptr_assign, FSoftObjectPtr* ptr, const unreal::UObject* obj) {
+    hook_manager::impl::ensure_not_async_hook_thread("assign a soft object pointer");
     hook_instance->fsoftobjectptr_assign(ptr, obj);
 }
 
 UNREALSDK_CAPI(void, flazyobjectptr_assign, FLazyObjectPtr* ptr, const unreal::UObject* obj) {
+    hook_manager::impl::ensure_not_async_hook_thread("assign a lazy object pointer");
     hook_instance->flazyobjectptr_assign(ptr, obj);
 }
 
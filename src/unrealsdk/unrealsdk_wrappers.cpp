@@ -78,6 +78,13 @@ std::variant<const std::string_view, const std::wstring_view> fname_get_str(
     }
     return std::string_view{reinterpret_cast<const char*>(str), size};
 }
+std::optional<uint32_t> fname_find(std::wstring_view str) {
+    uint32_t index{};
+    if (UNREALSDK_MANGLE(fname_find)(str.data(), str.size(), &index)) {
+        return index;
+    }
+    return std::nullopt;
+}
 
 void fframe_step(FFrame* frame, UObject* obj, void* param) {
     UNREALSDK_MANGLE(fframe_step(frame, obj, param));
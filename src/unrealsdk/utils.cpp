@@ -1,24 +1,45 @@
 #include "unrealsdk/pch.h"
 
+#include "unrealsdk/ascii.h"
 #include "unrealsdk/utils.h"
 
 namespace unrealsdk::utils {
 
 static_assert(sizeof(wchar_t) == sizeof(char16_t), "wchar_t is different size to char16_t");
 
+namespace {
+
+// Each utf-16 code unit becomes at most 3 utf-8 bytes - surrogate pairs take 4 bytes for 2 units
+const constexpr size_t MAX_UTF8_BYTES_PER_UTF16_UNIT = 3;
+
+}  // namespace
+
 std::string narrow(std::wstring_view wstr) {
     if (wstr.empty()) {
         return {};
     }
 
-    auto num_chars = WideCharToMultiByte(CP_UTF8, 0, wstr.data(), static_cast<int>(wstr.size()),
-                                         nullptr, 0, nullptr, nullptr);
-    std::string ret(num_chars, '\0');
-    if (WideCharToMultiByte(CP_UTF8, 0, wstr.data(), static_cast<int>(wstr.size()), ret.data(),
-                            num_chars, nullptr, nullptr)
-        != num_chars) {
+    // Start off assuming it's all ascii, which gives us the exact size
+    std::string ret(wstr.size(), '\0');
+    auto converted = narrow_ascii_prefix(reinterpret_cast<const char16_t*>(wstr.data()),
+                                         wstr.size(), ret.data());
+    if (converted == wstr.size()) {
+        return ret;
+    }
+
+    // Rather than making an extra call to find the exact size, make sure there's enough space for
+    // the worst case, and shrink it after
+    auto remaining = wstr.substr(converted);
+    auto max_chars = remaining.size() * MAX_UTF8_BYTES_PER_UTF16_UNIT;
+    ret.resize(converted + max_chars);
+
+    auto num_chars = WideCharToMultiByte(CP_UTF8, 0, remaining.data(),
+                                         static_cast<int>(remaining.size()), &ret[converted],
+                                         static_cast<int>(max_chars), nullptr, nullptr);
+    if (num_chars <= 0) {
         throw std::runtime_error("Failed to convert utf16 string!");
     }
+    ret.resize(converted + num_chars);
 
     return ret;
 }
@@ -28,17 +49,29 @@ std::wstring widen(std::string_view str) {
         return {};
     }
 
-    auto num_chars =
-        MultiByteToWideChar(CP_UTF8, 0, str.data(), static_cast<int>(str.size()), nullptr, 0);
-    std::wstring ret(num_chars, '\0');
+    // Each utf-8 byte becomes at most one utf-16 code unit, so the ascii size is also the max size
+    std::wstring ret(str.size(), L'\0');
+    ret.resize(widen_into(str, ret.data()));
+    return ret;
+}
 
-    if (MultiByteToWideChar(CP_UTF8, 0, str.data(), static_cast<int>(str.size()), ret.data(),
-                            num_chars)
-        != num_chars) {
+size_t widen_into(std::string_view str, wchar_t* buffer) {
+    auto converted =
+        widen_ascii_prefix(str.data(), str.size(), reinterpret_cast<char16_t*>(buffer));
+    if (converted == str.size()) {
+        return converted;
+    }
+
+    auto remaining = str.substr(converted);
+    auto num_chars =
+        MultiByteToWideChar(CP_UTF8, 0, remaining.data(), static_cast<int>(remaining.size()),
+                            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                            buffer + converted, static_cast<int>(remaining.size()));
+    if (num_chars <= 0) {
         throw std::runtime_error("Failed to convert utf8 string!");
     }
 
-    return ret;
+    return converted + num_chars;
 }
 
 namespace {
@@ -21,6 +21,17 @@ namespace unrealsdk::utils {
  */
 [[nodiscard]] std::wstring widen(std::string_view str);
 
+/**
+ * @brief Widens a utf-8 string directly into an existing buffer.
+ * @note Each utf-8 byte becomes at most one wide char, so a buffer of `str.size()` is enough.
+ * @note Does not write a null terminator.
+ *
+ * @param str The input string.
+ * @param buffer The buffer to write to. Must be at least `str.size()` wide chars long.
+ * @return The number of wide chars written.
+ */
+size_t widen_into(std::string_view str, wchar_t* buffer);
+
 /**
  * @brief Get the directory this dll is in.
  * @note This function is linked statically, calls from dlls linking against the shared library will